@@ -56,6 +56,119 @@ namespace detail
 			return Result;
 		}
 	};
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	// Aligned vec3 are padded to 16 bytes and aligned vec2 take 8 bytes
+	template<qualifier Q>
+	struct compute_transpose<3, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m)
+		{
+			glm_vec4 const In[3] = {glm_vec3_load(&m[0][0]), glm_vec3_load(&m[1][0]), glm_vec3_load(&m[2][0])};
+			glm_vec4 Out[3];
+			glm_mat3_transpose(In, Out);
+
+			mat<3, 3, float, Q> Result;
+			_mm_store_ps(&Result[0][0], Out[0]);
+			_mm_store_ps(&Result[1][0], Out[1]);
+			_mm_store_ps(&Result[2][0], Out[2]);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_transpose<3, 2, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<2, 3, float, Q> call(mat<3, 2, float, Q> const& m)
+		{
+			glm_vec4 const c01 = _mm_loadu_ps(&m[0][0]);
+			glm_vec4 const c2 = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const*>(&m[2][0]));
+			glm_vec4 Out[2];
+			glm_mat3x2_transpose(c01, c2, Out);
+
+			mat<2, 3, float, Q> Result;
+			_mm_store_ps(&Result[0][0], Out[0]);
+			_mm_store_ps(&Result[1][0], Out[1]);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_transpose<2, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 2, float, Q> call(mat<2, 3, float, Q> const& m)
+		{
+			glm_vec4 const In[2] = {glm_vec3_load(&m[0][0]), glm_vec3_load(&m[1][0])};
+			glm_vec4 c01, c2;
+			glm_mat2x3_transpose(In, &c01, &c2);
+
+			mat<3, 2, float, Q> Result;
+			_mm_storeu_ps(&Result[0][0], c01);
+			_mm_storel_pi(reinterpret_cast<__m64*>(&Result[2][0]), c2);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_determinant<3, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(mat<3, 3, float, Q> const& m)
+		{
+			glm_vec4 const In[3] = {glm_vec3_load(&m[0][0]), glm_vec3_load(&m[1][0]), glm_vec3_load(&m[2][0])};
+			return _mm_cvtss_f32(glm_mat3_determinant(In));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverse<3, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m)
+		{
+			glm_vec4 const In[3] = {glm_vec3_load(&m[0][0]), glm_vec3_load(&m[1][0]), glm_vec3_load(&m[2][0])};
+			glm_vec4 Out[3];
+			glm_mat3_inverse(In, Out);
+
+			mat<3, 3, float, Q> Result;
+			_mm_store_ps(&Result[0][0], Out[0]);
+			_mm_store_ps(&Result[1][0], Out[1]);
+			_mm_store_ps(&Result[2][0], Out[2]);
+			return Result;
+		}
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_transpose<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_transpose(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_determinant<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(mat<4, 4, double, Q> const& m)
+		{
+			return _mm_cvtsd_f64(_mm256_castpd256_pd128(glm_dmat4_determinant(&m[0].data)));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverse<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_inverse(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+#	endif
 }//namespace detail
 
 #	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
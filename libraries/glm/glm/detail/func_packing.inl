@@ -3,6 +3,175 @@
 
 #include "../common.hpp"
 #include "type_half.hpp"
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	template<bool UseSimd>
+	struct compute_packUnorm4x8
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec4 const& v)
+		{
+			union
+			{
+				unsigned char in[4];
+				uint out;
+			} u;
+
+			vec<4, unsigned char, defaultp> result(round(clamp(v, 0.0f, 1.0f) * 255.0f));
+
+			u.in[0] = result[0];
+			u.in[1] = result[1];
+			u.in[2] = result[2];
+			u.in[3] = result[3];
+
+			return u.out;
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_unpackUnorm4x8
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint p)
+		{
+			union
+			{
+				uint in;
+				unsigned char out[4];
+			} u;
+
+			u.in = p;
+
+			return vec4(u.out[0], u.out[1], u.out[2], u.out[3]) * 0.0039215686274509803921568627451f;
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_packSnorm4x8
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec4 const& v)
+		{
+			union
+			{
+				signed char in[4];
+				uint out;
+			} u;
+
+			vec<4, signed char, defaultp> result(round(clamp(v, -1.0f, 1.0f) * 127.0f));
+
+			u.in[0] = result[0];
+			u.in[1] = result[1];
+			u.in[2] = result[2];
+			u.in[3] = result[3];
+
+			return u.out;
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_unpackSnorm4x8
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint p)
+		{
+			union
+			{
+				uint in;
+				signed char out[4];
+			} u;
+
+			u.in = p;
+
+			return clamp(vec4(u.out[0], u.out[1], u.out[2], u.out[3]) * 0.0078740157480315f, -1.0f, 1.0f);
+		}
+	};
+
+	// The 4x16 and half kernels back the GTC_packing functions of the same name.
+
+	template<bool UseSimd>
+	struct compute_packUnorm4x16
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(vec4 const& v)
+		{
+			vec<4, unsigned short, defaultp> const Topack(round(clamp(v, 0.0f, 1.0f) * 65535.0f));
+			uint64 Packed = 0;
+			std::memcpy(&Packed, &Topack, sizeof(Packed));
+			return Packed;
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_unpackUnorm4x16
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint64 p)
+		{
+			vec<4, unsigned short, defaultp> Unpack;
+			std::memcpy(&Unpack, &p, sizeof(Unpack));
+			return vec4(Unpack) * 1.5259021896696421759365224689097e-5f; // 1.0 / 65535.0
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_packSnorm4x16
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(vec4 const& v)
+		{
+			vec<4, short, defaultp> const Topack(round(clamp(v ,-1.0f, 1.0f) * 32767.0f));
+			uint64 Packed = 0;
+			std::memcpy(&Packed, &Topack, sizeof(Packed));
+			return Packed;
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_unpackSnorm4x16
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint64 p)
+		{
+			vec<4, short, defaultp> Unpack;
+			std::memcpy(&Unpack, &p, sizeof(Unpack));
+			return clamp(
+				vec4(Unpack) * 3.0518509475997192297128208258309e-5f, //1.0f / 32767.0f,
+				-1.0f, 1.0f);
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_packHalf4x16
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(vec4 const& v)
+		{
+			vec<4, short, defaultp> const Unpack(
+				toFloat16(v.x),
+				toFloat16(v.y),
+				toFloat16(v.z),
+				toFloat16(v.w));
+			uint64 Packed = 0;
+			std::memcpy(&Packed, &Unpack, sizeof(Packed));
+			return Packed;
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_unpackHalf4x16
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint64 v)
+		{
+			vec<4, short, defaultp> Unpack;
+			std::memcpy(&Unpack, &v, sizeof(Unpack));
+			return vec4(
+				toFloat32(Unpack.x),
+				toFloat32(Unpack.y),
+				toFloat32(Unpack.z),
+				toFloat32(Unpack.w));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "func_packing_simd.inl"
+#endif
 
 namespace glm
 {
@@ -66,64 +235,22 @@ namespace glm
 
 	GLM_FUNC_QUALIFIER uint packUnorm4x8(vec4 const& v)
 	{
-		union
-		{
-			unsigned char in[4];
-			uint out;
-		} u;
-
-		vec<4, unsigned char, defaultp> result(round(clamp(v, 0.0f, 1.0f) * 255.0f));
-
-		u.in[0] = result[0];
-		u.in[1] = result[1];
-		u.in[2] = result[2];
-		u.in[3] = result[3];
-
-		return u.out;
+		return detail::compute_packUnorm4x8<GLM_CONFIG_SIMD == GLM_ENABLE>::call(v);
 	}
 
 	GLM_FUNC_QUALIFIER vec4 unpackUnorm4x8(uint p)
 	{
-		union
-		{
-			uint in;
-			unsigned char out[4];
-		} u;
-
-		u.in = p;
-
-		return vec4(u.out[0], u.out[1], u.out[2], u.out[3]) * 0.0039215686274509803921568627451f;
+		return detail::compute_unpackUnorm4x8<GLM_CONFIG_SIMD == GLM_ENABLE>::call(p);
 	}
 
 	GLM_FUNC_QUALIFIER uint packSnorm4x8(vec4 const& v)
 	{
-		union
-		{
-			signed char in[4];
-			uint out;
-		} u;
-
-		vec<4, signed char, defaultp> result(round(clamp(v, -1.0f, 1.0f) * 127.0f));
-
-		u.in[0] = result[0];
-		u.in[1] = result[1];
-		u.in[2] = result[2];
-		u.in[3] = result[3];
-
-		return u.out;
+		return detail::compute_packSnorm4x8<GLM_CONFIG_SIMD == GLM_ENABLE>::call(v);
 	}
 
 	GLM_FUNC_QUALIFIER glm::vec4 unpackSnorm4x8(uint p)
 	{
-		union
-		{
-			uint in;
-			signed char out[4];
-		} u;
-
-		u.in = p;
-
-		return clamp(vec4(u.out[0], u.out[1], u.out[2], u.out[3]) * 0.0078740157480315f, -1.0f, 1.0f);
+		return detail::compute_unpackSnorm4x8<GLM_CONFIG_SIMD == GLM_ENABLE>::call(p);
 	}
 
 	GLM_FUNC_QUALIFIER double packDouble2x32(uvec2 const& v)
@@ -182,8 +309,3 @@ namespace glm
 			detail::toFloat32(u.out[1]));
 	}
 }//namespace glm
-
-#if GLM_CONFIG_SIMD == GLM_ENABLE
-#	include "func_packing_simd.inl"
-#endif
-
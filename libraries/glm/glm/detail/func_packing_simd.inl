@@ -1,6 +1,119 @@
+/// @ref core
+/// @file glm/detail/func_packing_simd.inl
+
+#include "../simd/packing.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
 namespace glm{
 namespace detail
 {
+	template<>
+	struct compute_packUnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec4 const& v)
+		{
+			return static_cast<uint>(glm_vec4_pack_unorm4x8(_mm_loadu_ps(&v.x)));
+		}
+	};
+
+	template<>
+	struct compute_unpackUnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint p)
+		{
+			vec4 Result;
+			_mm_storeu_ps(&Result.x, glm_vec4_unpack_unorm4x8(static_cast<int>(p)));
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_packSnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec4 const& v)
+		{
+			return static_cast<uint>(glm_vec4_pack_snorm4x8(_mm_loadu_ps(&v.x)));
+		}
+	};
+
+	template<>
+	struct compute_unpackSnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint p)
+		{
+			vec4 Result;
+			_mm_storeu_ps(&Result.x, glm_vec4_unpack_snorm4x8(static_cast<int>(p)));
+			return Result;
+		}
+	};
 
+	template<>
+	struct compute_packUnorm4x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(vec4 const& v)
+		{
+			uint64 Packed;
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Packed), glm_vec4_pack_unorm4x16(_mm_loadu_ps(&v.x)));
+			return Packed;
+		}
+	};
+
+	template<>
+	struct compute_unpackUnorm4x16<true>
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint64 p)
+		{
+			vec4 Result;
+			_mm_storeu_ps(&Result.x, glm_vec4_unpack_unorm4x16(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&p))));
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_packSnorm4x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(vec4 const& v)
+		{
+			uint64 Packed;
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Packed), glm_vec4_pack_snorm4x16(_mm_loadu_ps(&v.x)));
+			return Packed;
+		}
+	};
+
+	template<>
+	struct compute_unpackSnorm4x16<true>
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint64 p)
+		{
+			vec4 Result;
+			_mm_storeu_ps(&Result.x, glm_vec4_unpack_snorm4x16(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&p))));
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_packHalf4x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(vec4 const& v)
+		{
+			uint64 Packed;
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Packed), glm_vec4_pack_half4x16(_mm_loadu_ps(&v.x)));
+			return Packed;
+		}
+	};
+
+	template<>
+	struct compute_unpackHalf4x16<true>
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint64 v)
+		{
+			vec4 Result;
+			_mm_storeu_ps(&Result.x, glm_vec4_unpack_half4x16(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&v))));
+			return Result;
+		}
+	};
 }//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
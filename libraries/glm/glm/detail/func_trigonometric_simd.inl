@@ -0,0 +1,66 @@
+/// @ref core
+/// @file glm/detail/func_trigonometric_simd.inl
+
+#include "../simd/trigonometric.h"
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && (GLM_CONFIG_SIMD_TRIGONOMETRIC == GLM_ENABLE)
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_sin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(!glm_vec4_trig_in_range(v.data))
+				return compute_sin<4, float, Q, false>::call(v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_sin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(!glm_vec4_trig_in_range(v.data))
+				return compute_cos<4, float, Q, false>::call(v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_cos(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_tan<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(!glm_vec4_trig_in_range(v.data))
+				return compute_tan<4, float, Q, false>::call(v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_tan(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_atan<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_atan(v.data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) && (GLM_CONFIG_SIMD_TRIGONOMETRIC == GLM_ENABLE)
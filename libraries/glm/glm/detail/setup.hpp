@@ -850,6 +850,15 @@ namespace detail
 #	define GLM_CONFIG_SIMD GLM_DISABLE
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////
+// Use SIMD polynomial approximations of trigonometric functions (a few ULPs from libm)
+
+#if (GLM_CONFIG_SIMD == GLM_ENABLE) && defined(GLM_FORCE_SIMD_TRIGONOMETRIC)
+#	define GLM_CONFIG_SIMD_TRIGONOMETRIC GLM_ENABLE
+#else
+#	define GLM_CONFIG_SIMD_TRIGONOMETRIC GLM_DISABLE
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Configure the use of defaulted function
 
@@ -1030,7 +1039,12 @@ namespace detail
 #	endif
 
 	// Report build target
-#	if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_64)
+#	if (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_MODEL == GLM_MODEL_64)
+#		pragma message("GLM: x86 64 bits with AVX-512 instruction set build target")
+#	elif (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_MODEL == GLM_MODEL_32)
+#		pragma message("GLM: x86 32 bits with AVX-512 instruction set build target")
+
+#	elif (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_64)
 #		pragma message("GLM: x86 64 bits with AVX2 instruction set build target")
 #	elif (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_32)
 #		pragma message("GLM: x86 32 bits with AVX2 instruction set build target")
@@ -1121,6 +1135,11 @@ namespace detail
 	// Report whether only xyzw component are used
 #	if defined GLM_FORCE_XYZW_ONLY
 #		pragma message("GLM: GLM_FORCE_XYZW_ONLY is defined. Only x, y, z and w component are available in vector type. This define disables swizzle operators and SIMD instruction sets.")
+#	endif
+
+	// Report trigonometric approximations
+#	if GLM_CONFIG_SIMD_TRIGONOMETRIC == GLM_ENABLE
+#		pragma message("GLM: GLM_FORCE_SIMD_TRIGONOMETRIC is defined. sin, cos, tan and atan of aligned vec4 use SIMD polynomial approximations.")
 #	endif
 
 	// Report swizzle operator support
@@ -508,3 +508,7 @@ namespace glm
 		return (m1[0] != m2[0]) || (m1[1] != m2[1]);
 	}
 } //namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "type_mat2x3_simd.inl"
+#endif
@@ -0,0 +1,40 @@
+/// @ref core
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && (GLM_LANG & GLM_LANG_CXX11_FLAG)
+
+#include "../simd/matrix.h"
+#include <type_traits>
+
+namespace glm
+{
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER
+	typename std::enable_if<detail::is_aligned<Q>::value, vec<3, float, Q> >::type
+	operator*(mat<2, 3, float, Q> const& m, vec<2, float, Q> const& v)
+	{
+		glm_vec4 const In[2] = {glm_vec3_load(&m[0][0]), glm_vec3_load(&m[1][0])};
+		glm_vec4 const Vec = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const*>(&v[0]));
+
+		vec<3, float, Q> Result;
+		_mm_store_ps(&Result[0], glm_mat2x3_mul_vec2(In, Vec));
+		return Result;
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER
+	typename std::enable_if<detail::is_aligned<Q>::value, mat<3, 3, float, Q> >::type
+	operator*(mat<2, 3, float, Q> const& m1, mat<3, 2, float, Q> const& m2)
+	{
+		glm_vec4 const In[2] = {glm_vec3_load(&m1[0][0]), glm_vec3_load(&m1[1][0])};
+		glm_vec4 const c01 = _mm_loadu_ps(&m2[0][0]);
+		glm_vec4 const c2 = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const*>(&m2[2][0]));
+
+		mat<3, 3, float, Q> Result;
+		_mm_store_ps(&Result[0][0], glm_mat2x3_mul_vec2(In, c01));
+		_mm_store_ps(&Result[1][0], glm_mat2x3_mul_vec2(In, _mm_movehl_ps(c01, c01)));
+		_mm_store_ps(&Result[2][0], glm_mat2x3_mul_vec2(In, c2));
+		return Result;
+	}
+}//namespace glm
+
+#endif
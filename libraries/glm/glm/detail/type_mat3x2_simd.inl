@@ -0,0 +1,44 @@
+/// @ref core
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && (GLM_LANG & GLM_LANG_CXX11_FLAG)
+
+#include "../simd/matrix.h"
+#include <type_traits>
+
+namespace glm
+{
+	// Aligned vec2 are 8 bytes: the first two columns load as one unaligned register, the last one as a half register.
+	// Vectors are often built just before the product: loading their components one by one does not
+	// wait on the stores of the constructor, and folds into a constant when it is one.
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER
+	typename std::enable_if<detail::is_aligned<Q>::value, vec<2, float, Q> >::type
+	operator*(mat<3, 2, float, Q> const& m, vec<3, float, Q> const& v)
+	{
+		glm_vec4 const c01 = _mm_loadu_ps(&m[0][0]);
+		glm_vec4 const c2 = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const*>(&m[2][0]));
+
+		vec<2, float, Q> Result;
+		_mm_storel_pi(reinterpret_cast<__m64*>(&Result[0]), glm_mat3x2_mul_vec3(c01, c2, _mm_setr_ps(v[0], v[1], v[2], 0.0f)));
+		return Result;
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER
+	typename std::enable_if<detail::is_aligned<Q>::value, mat<3, 2, float, Q> >::type
+	operator*(mat<3, 2, float, Q> const& m1, mat<3, 3, float, Q> const& m2)
+	{
+		glm_vec4 const c01 = _mm_loadu_ps(&m1[0][0]);
+		glm_vec4 const c2 = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const*>(&m1[2][0]));
+		glm_vec4 const b0 = glm_vec3_load(&m2[0][0]);
+		glm_vec4 const b1 = glm_vec3_load(&m2[1][0]);
+		glm_vec4 const b2 = glm_vec3_load(&m2[2][0]);
+
+		mat<3, 2, float, Q> Result;
+		_mm_storeu_ps(&Result[0][0], glm_mat3x2_mul_cols(c01, c2, b0, b1));
+		_mm_storel_pi(reinterpret_cast<__m64*>(&Result[2][0]), glm_mat3x2_mul_cols(c01, c2, b2, b2));
+		return Result;
+	}
+}//namespace glm
+
+#endif
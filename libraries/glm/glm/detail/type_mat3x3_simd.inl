@@ -0,0 +1,43 @@
+/// @ref core
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && (GLM_LANG & GLM_LANG_CXX11_FLAG)
+
+#include "../simd/matrix.h"
+#include <type_traits>
+
+namespace glm
+{
+	// Aligned vec3 are padded to 16 bytes, so each column loads as a whole register
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER
+	typename std::enable_if<detail::is_aligned<Q>::value, mat<3, 3, float, Q> >::type
+	operator*(mat<3, 3, float, Q> const& m1, mat<3, 3, float, Q> const& m2)
+	{
+		glm_vec4 const In1[3] = {glm_vec3_load(&m1[0][0]), glm_vec3_load(&m1[1][0]), glm_vec3_load(&m1[2][0])};
+		glm_vec4 const In2[3] = {glm_vec3_load(&m2[0][0]), glm_vec3_load(&m2[1][0]), glm_vec3_load(&m2[2][0])};
+		glm_vec4 Out[3];
+		glm_mat3_mul(In1, In2, Out);
+
+		mat<3, 3, float, Q> Result;
+		_mm_store_ps(&Result[0][0], Out[0]);
+		_mm_store_ps(&Result[1][0], Out[1]);
+		_mm_store_ps(&Result[2][0], Out[2]);
+		return Result;
+	}
+
+	// Vectors are often built just before the product: loading their components one by one
+	// does not wait on the stores of the constructor, and folds into a constant when it is one
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER
+	typename std::enable_if<detail::is_aligned<Q>::value, vec<3, float, Q> >::type
+	operator*(mat<3, 3, float, Q> const& m, vec<3, float, Q> const& v)
+	{
+		glm_vec4 const In[3] = {glm_vec3_load(&m[0][0]), glm_vec3_load(&m[1][0]), glm_vec3_load(&m[2][0])};
+
+		vec<3, float, Q> Result;
+		_mm_store_ps(&Result[0], glm_mat3_mul_vec3(In, _mm_setr_ps(v[0], v[1], v[2], 0.0f)));
+		return Result;
+	}
+}//namespace glm
+
+#endif
@@ -1,6 +1,31 @@
 /// @ref core
 
+#if (GLM_ARCH & GLM_ARCH_AVX_BIT) && (GLM_LANG & GLM_LANG_CXX11_FLAG)
+
+#include "../simd/matrix.h"
+#include <type_traits>
+
 namespace glm
 {
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER
+	typename std::enable_if<detail::is_aligned<Q>::value, mat<4, 4, double, Q> >::type
+	operator*(mat<4, 4, double, Q> const& m1, mat<4, 4, double, Q> const& m2)
+	{
+		mat<4, 4, double, Q> Result;
+		glm_dmat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+		return Result;
+	}
 
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER
+	typename std::enable_if<detail::is_aligned<Q>::value, vec<4, double, Q> >::type
+	operator*(mat<4, 4, double, Q> const& m, vec<4, double, Q> const& v)
+	{
+		vec<4, double, Q> Result;
+		Result.data = glm_dmat4_mul_dvec4(&m[0].data, v.data);
+		return Result;
+	}
 }//namespace glm
+
+#endif
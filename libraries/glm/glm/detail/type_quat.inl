@@ -41,6 +41,19 @@ namespace detail
 		}
 	};
 
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_quat_mul
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static qua<T, Q> call(qua<T, Q> const& p, qua<T, Q> const& q)
+		{
+			return qua<T, Q>::wxyz(
+				p.w * q.w - p.x * q.x - p.y * q.y - p.z * q.z,
+				p.w * q.x + p.x * q.w + p.y * q.z - p.z * q.y,
+				p.w * q.y + p.y * q.w + p.z * q.x - p.x * q.z,
+				p.w * q.z + p.z * q.w + p.x * q.y - p.y * q.x);
+		}
+	};
+
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_quat_mul_scalar
 	{
@@ -59,6 +72,19 @@ namespace detail
 		}
 	};
 
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_quat_mul_vec3
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<3, T, Q> call(qua<T, Q> const& q, vec<3, T, Q> const& v)
+		{
+			vec<3, T, Q> const QuatVector(q.x, q.y, q.z);
+			vec<3, T, Q> const uv(glm::cross(QuatVector, v));
+			vec<3, T, Q> const uuv(glm::cross(QuatVector, uv));
+
+			return v + ((uv * q.w) + uuv) * static_cast<T>(2);
+		}
+	};
+
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_quat_mul_vec4
 	{
@@ -297,14 +323,7 @@ namespace detail
 	template<typename U>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR qua<T, Q> & qua<T, Q>::operator*=(qua<U, Q> const& r)
 	{
-		qua<T, Q> const p(*this);
-		qua<T, Q> const q(r);
-
-		this->w = p.w * q.w - p.x * q.x - p.y * q.y - p.z * q.z;
-		this->x = p.w * q.x + p.x * q.w + p.y * q.z - p.z * q.y;
-		this->y = p.w * q.y + p.y * q.w + p.z * q.x - p.x * q.z;
-		this->z = p.w * q.z + p.z * q.w + p.x * q.y - p.y * q.x;
-		return *this;
+		return (*this = detail::compute_quat_mul<T, Q, detail::is_aligned<Q>::value>::call(*this, qua<T, Q>(r)));
 	}
 
 	template<typename T, qualifier Q>
@@ -358,11 +377,7 @@ namespace detail
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, T, Q> operator*(qua<T, Q> const& q, vec<3, T, Q> const& v)
 	{
-		vec<3, T, Q> const QuatVector(q.x, q.y, q.z);
-		vec<3, T, Q> const uv(glm::cross(QuatVector, v));
-		vec<3, T, Q> const uuv(glm::cross(QuatVector, uv));
-
-		return v + ((uv * q.w) + uuv) * static_cast<T>(2);
+		return detail::compute_quat_mul_vec3<T, Q, detail::is_aligned<Q>::value>::call(q, v);
 	}
 
 	template<typename T, qualifier Q>
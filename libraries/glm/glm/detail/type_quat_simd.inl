@@ -1,64 +1,63 @@
 /// @ref core
 
+#include "../simd/quaternion.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
 namespace glm{
 namespace detail
 {
-/*
 	template<qualifier Q>
 	struct compute_quat_mul<float, Q, true>
 	{
-		static qua<float, Q> call(qua<float, Q> const& q1, qua<float, Q> const& q2)
+		static qua<float, Q> call(qua<float, Q> const& p, qua<float, Q> const& q)
 		{
-			// SSE2 STATS: 11 shuffle, 8 mul, 8 add
-			// SSE4 STATS: 3 shuffle, 4 mul, 4 dpps
-
-			__m128 const mul0 = _mm_mul_ps(q1.data, _mm_shuffle_ps(q2.data, q2.data, _MM_SHUFFLE(0, 1, 2, 3)));
-			__m128 const mul1 = _mm_mul_ps(q1.data, _mm_shuffle_ps(q2.data, q2.data, _MM_SHUFFLE(1, 0, 3, 2)));
-			__m128 const mul2 = _mm_mul_ps(q1.data, _mm_shuffle_ps(q2.data, q2.data, _MM_SHUFFLE(2, 3, 0, 1)));
-			__m128 const mul3 = _mm_mul_ps(q1.data, q2.data);
-
-#			if GLM_ARCH & GLM_ARCH_SSE41_BIT
-				__m128 const add0 = _mm_dp_ps(mul0, _mm_set_ps(1.0f, -1.0f,  1.0f,  1.0f), 0xff);
-				__m128 const add1 = _mm_dp_ps(mul1, _mm_set_ps(1.0f,  1.0f,  1.0f, -1.0f), 0xff);
-				__m128 const add2 = _mm_dp_ps(mul2, _mm_set_ps(1.0f,  1.0f, -1.0f,  1.0f), 0xff);
-				__m128 const add3 = _mm_dp_ps(mul3, _mm_set_ps(1.0f, -1.0f, -1.0f, -1.0f), 0xff);
+			qua<float, Q> Result;
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				__m128 const p0 = _mm_shuffle_ps(p.data, p.data, _MM_SHUFFLE(0, 3, 2, 1));
+				__m128 const q0 = _mm_shuffle_ps(q.data, q.data, _MM_SHUFFLE(0, 3, 2, 1));
+				__m128 const r0 = glm_quat_mul(p0, q0);
+				Result.data = _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(2, 1, 0, 3));
 #			else
-				__m128 const mul4 = _mm_mul_ps(mul0, _mm_set_ps(1.0f, -1.0f,  1.0f,  1.0f));
-				__m128 const add0 = _mm_add_ps(mul0, _mm_movehl_ps(mul4, mul4));
-				__m128 const add4 = _mm_add_ss(add0, _mm_shuffle_ps(add0, add0, 1));
-
-				__m128 const mul5 = _mm_mul_ps(mul1, _mm_set_ps(1.0f,  1.0f,  1.0f, -1.0f));
-				__m128 const add1 = _mm_add_ps(mul1, _mm_movehl_ps(mul5, mul5));
-				__m128 const add5 = _mm_add_ss(add1, _mm_shuffle_ps(add1, add1, 1));
-
-				__m128 const mul6 = _mm_mul_ps(mul2, _mm_set_ps(1.0f,  1.0f, -1.0f,  1.0f));
-				__m128 const add2 = _mm_add_ps(mul6, _mm_movehl_ps(mul6, mul6));
-				__m128 const add6 = _mm_add_ss(add2, _mm_shuffle_ps(add2, add2, 1));
-
-				__m128 const mul7 = _mm_mul_ps(mul3, _mm_set_ps(1.0f, -1.0f, -1.0f, -1.0f));
-				__m128 const add3 = _mm_add_ps(mul3, _mm_movehl_ps(mul7, mul7));
-				__m128 const add7 = _mm_add_ss(add3, _mm_shuffle_ps(add3, add3, 1));
-		#endif
-
-			// This SIMD code is a politically correct way of doing this, but in every test I've tried it has been slower than
-			// the final code below. I'll keep this here for reference - maybe somebody else can do something better...
-			//
-			//__m128 xxyy = _mm_shuffle_ps(add4, add5, _MM_SHUFFLE(0, 0, 0, 0));
-			//__m128 zzww = _mm_shuffle_ps(add6, add7, _MM_SHUFFLE(0, 0, 0, 0));
-			//
-			//return _mm_shuffle_ps(xxyy, zzww, _MM_SHUFFLE(2, 0, 2, 0));
+				Result.data = glm_quat_mul(p.data, q.data);
+#			endif
+			return Result;
+		}
+	};
 
-			qua<float, Q> Result;
-			_mm_store_ss(&Result.x, add4);
-			_mm_store_ss(&Result.y, add5);
-			_mm_store_ss(&Result.z, add6);
-			_mm_store_ss(&Result.w, add7);
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	template<qualifier Q>
+	struct compute_quat_mul<double, Q, true>
+	{
+		static qua<double, Q> call(qua<double, Q> const& p, qua<double, Q> const& q)
+		{
+			// Same lane order and operation order as glm_quat_mul
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				__m256d const p0 = _mm256_permute4x64_pd(p.data, _MM_SHUFFLE(0, 3, 2, 1));
+				__m256d const q0 = _mm256_permute4x64_pd(q.data, _MM_SHUFFLE(0, 3, 2, 1));
+#			else
+				__m256d const p0 = p.data;
+				__m256d const q0 = q.data;
+#			endif
+			__m256d const sgn0 = _mm256_set_pd(-0.0, 0.0, 0.0, 0.0);
+			__m256d const mul0 = _mm256_mul_pd(_mm256_permute4x64_pd(p0, _MM_SHUFFLE(3, 3, 3, 3)), q0);
+			__m256d const mul1 = _mm256_mul_pd(_mm256_permute4x64_pd(p0, _MM_SHUFFLE(0, 2, 1, 0)), _mm256_permute4x64_pd(q0, _MM_SHUFFLE(0, 3, 3, 3)));
+			__m256d const mul2 = _mm256_mul_pd(_mm256_permute4x64_pd(p0, _MM_SHUFFLE(1, 0, 2, 1)), _mm256_permute4x64_pd(q0, _MM_SHUFFLE(1, 1, 0, 2)));
+			__m256d const mul3 = _mm256_mul_pd(_mm256_permute4x64_pd(p0, _MM_SHUFFLE(2, 1, 0, 2)), _mm256_permute4x64_pd(q0, _MM_SHUFFLE(2, 0, 2, 1)));
+			__m256d const add0 = _mm256_add_pd(mul0, _mm256_xor_pd(mul1, sgn0));
+			__m256d const add1 = _mm256_add_pd(add0, _mm256_xor_pd(mul2, sgn0));
+			__m256d const r0 = _mm256_sub_pd(add1, mul3);
+
+			qua<double, Q> Result;
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				Result.data = _mm256_permute4x64_pd(r0, _MM_SHUFFLE(2, 1, 0, 3));
+#			else
+				Result.data = r0;
+#			endif
 			return Result;
 		}
 	};
-*/
+#	endif
 
 	template<qualifier Q>
 	struct compute_quat_add<float, Q, true>
@@ -126,7 +125,7 @@ namespace detail
 		static qua<double, Q> call(qua<double, Q> const& q, double s)
 		{
 			qua<double, Q> Result;
-			Result.data = _mm256_mul_pd(q.data, _mm_set_ps1(s));
+			Result.data = _mm256_mul_pd(q.data, _mm256_set1_pd(s));
 			return Result;
 		}
 	};
@@ -150,12 +149,30 @@ namespace detail
 		static qua<double, Q> call(qua<double, Q> const& q, double s)
 		{
 			qua<double, Q> Result;
-			Result.data = _mm256_div_pd(q.data, _mm_set_ps1(s));
+			Result.data = _mm256_div_pd(q.data, _mm256_set1_pd(s));
 			return Result;
 		}
 	};
 #	endif
 
+	template<qualifier Q>
+	struct compute_quat_mul_vec3<float, Q, true>
+	{
+		static vec<3, float, Q> call(qua<float, Q> const& q, vec<3, float, Q> const& v)
+		{
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				__m128 const q0 = _mm_shuffle_ps(q.data, q.data, _MM_SHUFFLE(0, 3, 2, 1));
+#			else
+				__m128 const q0 = q.data;
+#			endif
+			glm_vec4 const r0 = glm_quat_rotate(q0, _mm_set_ps(0.0f, v.z, v.y, v.x));
+
+			vec<4, float, Q> Result;
+			Result.data = r0;
+			return vec<3, float, Q>(Result);
+		}
+	};
+
 	template<qualifier Q>
 	struct compute_quat_mul_vec4<float, Q, true>
 	{
@@ -1,28 +1,76 @@
 namespace glm
 {
-	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER qua<T, Q> mix(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+namespace detail
+{
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_quat_mix
 	{
-		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'mix' only accept floating-point inputs");
-
-		T const cosTheta = dot(x, y);
-
-		// Perform a linear interpolation when cosTheta is close to 1 to avoid side effect of sin(angle) becoming a zero denominator
-		if(cosTheta > static_cast<T>(1) - epsilon<T>())
+		GLM_FUNC_QUALIFIER static qua<T, Q> call(qua<T, Q> const& x, qua<T, Q> const& y, T a)
 		{
-			// Linear interpolation
-			return qua<T, Q>::wxyz(
-				mix(x.w, y.w, a),
-				mix(x.x, y.x, a),
-				mix(x.y, y.y, a),
-				mix(x.z, y.z, a));
+			T const cosTheta = dot(x, y);
+
+			// Perform a linear interpolation when cosTheta is close to 1 to avoid side effect of sin(angle) becoming a zero denominator
+			if(cosTheta > static_cast<T>(1) - epsilon<T>())
+			{
+				// Linear interpolation
+				return qua<T, Q>::wxyz(
+					mix(x.w, y.w, a),
+					mix(x.x, y.x, a),
+					mix(x.y, y.y, a),
+					mix(x.z, y.z, a));
+			}
+			else
+			{
+				// Essential Mathematics, page 467
+				T angle = acos(cosTheta);
+				return (sin((static_cast<T>(1) - a) * angle) * x + sin(a * angle) * y) / sin(angle);
+			}
 		}
-		else
+	};
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_quat_slerp
+	{
+		GLM_FUNC_QUALIFIER static qua<T, Q> call(qua<T, Q> const& x, qua<T, Q> const& y, T a)
 		{
-			// Essential Mathematics, page 467
-			T angle = acos(cosTheta);
-			return (sin((static_cast<T>(1) - a) * angle) * x + sin(a * angle) * y) / sin(angle);
+			qua<T, Q> z = y;
+
+			T cosTheta = dot(x, y);
+
+			// If cosTheta < 0, the interpolation will take the long way around the sphere.
+			// To fix this, one quat must be negated.
+			if(cosTheta < static_cast<T>(0))
+			{
+				z = -y;
+				cosTheta = -cosTheta;
+			}
+
+			// Perform a linear interpolation when cosTheta is close to 1 to avoid side effect of sin(angle) becoming a zero denominator
+			if(cosTheta > static_cast<T>(1) - epsilon<T>())
+			{
+				// Linear interpolation
+				return qua<T, Q>::wxyz(
+					mix(x.w, z.w, a),
+					mix(x.x, z.x, a),
+					mix(x.y, z.y, a),
+					mix(x.z, z.z, a));
+			}
+			else
+			{
+				// Essential Mathematics, page 467
+				T angle = acos(cosTheta);
+				return (sin((static_cast<T>(1) - a) * angle) * x + sin(a * angle) * z) / sin(angle);
+			}
 		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER qua<T, Q> mix(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'mix' only accept floating-point inputs");
+
+		return detail::compute_quat_mix<T, Q, detail::is_aligned<Q>::value>::call(x, y, a);
 	}
 
 	template<typename T, qualifier Q>
@@ -42,34 +90,7 @@ namespace glm
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'slerp' only accept floating-point inputs");
 
-		qua<T, Q> z = y;
-
-		T cosTheta = dot(x, y);
-
-		// If cosTheta < 0, the interpolation will take the long way around the sphere.
-		// To fix this, one quat must be negated.
-		if(cosTheta < static_cast<T>(0))
-		{
-			z = -y;
-			cosTheta = -cosTheta;
-		}
-
-		// Perform a linear interpolation when cosTheta is close to 1 to avoid side effect of sin(angle) becoming a zero denominator
-		if(cosTheta > static_cast<T>(1) - epsilon<T>())
-		{
-			// Linear interpolation
-			return qua<T, Q>::wxyz(
-				mix(x.w, z.w, a),
-				mix(x.x, z.x, a),
-				mix(x.y, z.y, a),
-				mix(x.z, z.z, a));
-		}
-		else
-		{
-			// Essential Mathematics, page 467
-			T angle = acos(cosTheta);
-			return (sin((static_cast<T>(1) - a) * angle) * x + sin(a * angle) * z) / sin(angle);
-		}
+		return detail::compute_quat_slerp<T, Q, detail::is_aligned<Q>::value>::call(x, y, a);
 	}
 
     template<typename T, typename S, qualifier Q>
@@ -1,3 +1,6 @@
+#include "../simd/quaternion.h"
+#include <cmath>
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
 namespace glm{
@@ -11,6 +14,55 @@ namespace detail
 			return _mm_cvtss_f32(glm_vec1_dot(x.data, y.data));
 		}
 	};
+
+	// sin((1 - a) * angle), sin(a * angle) and sin(angle); one polynomial evaluation with GLM_FORCE_SIMD_TRIGONOMETRIC
+	GLM_FUNC_QUALIFIER glm_vec4 compute_quat_slerp_sin(float a, float angle)
+	{
+#		if GLM_CONFIG_SIMD_TRIGONOMETRIC == GLM_ENABLE
+			return glm_vec4_sin(_mm_setr_ps((1.0f - a) * angle, a * angle, angle, 0.0f));
+#		else
+			return _mm_setr_ps(std::sin((1.0f - a) * angle), std::sin(a * angle), std::sin(angle), 0.0f);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER glm_vec4 compute_quat_interpolate(glm_vec4 x, glm_vec4 y, float cosTheta, float a)
+	{
+		// Perform a linear interpolation when cosTheta is close to 1 to avoid side effect of sin(angle) becoming a zero denominator
+		if(cosTheta > 1.0f - epsilon<float>())
+			return _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(1.0f - a)), _mm_mul_ps(y, _mm_set1_ps(a)));
+
+		glm_vec4 const sin0 = compute_quat_slerp_sin(a, std::acos(cosTheta));
+		glm_vec4 const mul0 = _mm_mul_ps(_mm_shuffle_ps(sin0, sin0, _MM_SHUFFLE(0, 0, 0, 0)), x);
+		glm_vec4 const mul1 = _mm_mul_ps(_mm_shuffle_ps(sin0, sin0, _MM_SHUFFLE(1, 1, 1, 1)), y);
+		return _mm_div_ps(_mm_add_ps(mul0, mul1), _mm_shuffle_ps(sin0, sin0, _MM_SHUFFLE(2, 2, 2, 2)));
+	}
+
+	template<qualifier Q>
+	struct compute_quat_mix<float, Q, true>
+	{
+		static qua<float, Q> call(qua<float, Q> const& x, qua<float, Q> const& y, float a)
+		{
+			qua<float, Q> Result;
+			Result.data = compute_quat_interpolate(x.data, y.data, _mm_cvtss_f32(glm_vec1_dot(x.data, y.data)), a);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_quat_slerp<float, Q, true>
+	{
+		static qua<float, Q> call(qua<float, Q> const& x, qua<float, Q> const& y, float a)
+		{
+			// If cosTheta < 0, the interpolation will take the long way around the sphere: negate y
+			glm_vec4 const dot0 = glm_vec1_dot(x.data, y.data);
+			glm_vec4 const neg0 = _mm_cmplt_ps(_mm_shuffle_ps(dot0, dot0, _MM_SHUFFLE(0, 0, 0, 0)), _mm_setzero_ps());
+			glm_vec4 const sgn0 = _mm_and_ps(neg0, _mm_set1_ps(-0.0f));
+
+			qua<float, Q> Result;
+			Result.data = compute_quat_interpolate(x.data, _mm_xor_ps(y.data, sgn0), std::abs(_mm_cvtss_f32(dot0)), a);
+			return Result;
+		}
+	};
 }//namespace detail
 }//namespace glm
 
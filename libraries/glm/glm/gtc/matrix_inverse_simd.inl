@@ -0,0 +1,42 @@
+/// @ref gtc_matrix_inverse
+
+#include "../simd/matrix.h"
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+namespace glm{
+namespace detail
+{
+	// The last row is known to be (0, 0, 1): only the upper 2x2 block is inverted
+	template<qualifier Q>
+	struct compute_affine_inverse<3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m)
+		{
+			glm_vec4 const In[3] = {glm_vec3_load(&m[0][0]), glm_vec3_load(&m[1][0]), glm_vec3_load(&m[2][0])};
+			glm_vec4 Out[3];
+			glm_mat3_affine_inverse(In, Out);
+
+			mat<3, 3, float, Q> Result;
+			_mm_store_ps(&Result[0][0], Out[0]);
+			_mm_store_ps(&Result[1][0], Out[1]);
+			_mm_store_ps(&Result[2][0], Out[2]);
+			return Result;
+		}
+	};
+
+	// The last row is known to be (0, 0, 0, 1): only the upper 3x3 block is inverted
+	template<qualifier Q>
+	struct compute_affine_inverse<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_affine_inverse(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif
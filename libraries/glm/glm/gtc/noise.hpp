@@ -26,6 +26,7 @@
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_noise extension included")
@@ -55,6 +56,52 @@ namespace glm
 	GLM_FUNC_DECL T simplex(
 		vec<L, T, Q> const& p);
 
+	/// Classic perlin noise of Count positions: Out[i] = perlin(In[i]).
+	/// Float 2D and 3D positions are evaluated 4, 8 or 16 at a time with SSE2, AVX or AVX-512
+	/// and give exactly the results for packed single positions, as long as the compiler does not
+	/// contract those to FMA.
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlin(
+		vec<L, T, Q> const* In,
+		T* Out,
+		std::size_t Count);
+
+	/// Simplex noise of Count positions: Out[i] = simplex(In[i]).
+	/// Float 2D and 3D positions are evaluated like perlin arrays.
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void simplex(
+		vec<L, T, Q> const* In,
+		T* Out,
+		std::size_t Count);
+
+	/// Classic perlin noise sampled on rows [RowBegin, RowEnd) of a grid Width samples wide:
+	/// Out[y * Width + x] = perlin(Origin + Step * vec2(x, y)).
+	/// A Height rows grid is rows [0, Height). Calls on disjoint rows may run on
+	/// different threads, which leaves threading to the caller's own workers.
+	/// @see gtc_noise
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlinGrid(
+		vec<2, T, Q> const& Origin,
+		vec<2, T, Q> const& Step,
+		std::size_t Width,
+		std::size_t RowBegin,
+		std::size_t RowEnd,
+		T* Out);
+
+	/// Simplex noise sampled on rows [RowBegin, RowEnd) of a grid Width samples wide:
+	/// Out[y * Width + x] = simplex(Origin + Step * vec2(x, y)), rows split like perlinGrid.
+	/// @see gtc_noise
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void simplexGrid(
+		vec<2, T, Q> const& Origin,
+		vec<2, T, Q> const& Step,
+		std::size_t Width,
+		std::size_t RowBegin,
+		std::size_t RowEnd,
+		T* Out);
+
 	/// @}
 }//namespace glm
 
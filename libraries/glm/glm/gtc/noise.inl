@@ -804,4 +804,73 @@ namespace detail
 			(dot(m0 * m0, vec<3, T, Q>(dot(p0, x0), dot(p1, x1), dot(p2, x2))) +
 			dot(m1 * m1, vec<2, T, Q>(dot(p3, x3), dot(p4, x4))));
 	}
+
+namespace detail
+{
+	template<length_t L, typename T, qualifier Q, bool UseSimd>
+	struct compute_noise_array
+	{
+		GLM_FUNC_QUALIFIER static void perlin(vec<L, T, Q> const* In, T* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::perlin(In[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void simplex(vec<L, T, Q> const* In, T* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::simplex(In[i]);
+		}
+	};
+
+	// Fills rows [RowBegin, RowEnd) of a grid
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_noise_grid
+	{
+		GLM_FUNC_QUALIFIER static void perlin(vec<2, T, Q> const& Origin, vec<2, T, Q> const& Step, std::size_t Width, std::size_t RowBegin, std::size_t RowEnd, T* Out)
+		{
+			for(std::size_t y = RowBegin; y < RowEnd; ++y)
+			for(std::size_t x = 0; x < Width; ++x)
+				Out[y * Width + x] = glm::perlin(Origin + Step * vec<2, T, Q>(static_cast<T>(x), static_cast<T>(y)));
+		}
+
+		GLM_FUNC_QUALIFIER static void simplex(vec<2, T, Q> const& Origin, vec<2, T, Q> const& Step, std::size_t Width, std::size_t RowBegin, std::size_t RowEnd, T* Out)
+		{
+			for(std::size_t y = RowBegin; y < RowEnd; ++y)
+			for(std::size_t x = 0; x < Width; ++x)
+				Out[y * Width + x] = glm::simplex(Origin + Step * vec<2, T, Q>(static_cast<T>(x), static_cast<T>(y)));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "noise_simd.inl"
+#endif
+
+namespace glm
+{
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlin(vec<L, T, Q> const* In, T* Out, std::size_t Count)
+	{
+		detail::compute_noise_array<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::perlin(In, Out, Count);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplex(vec<L, T, Q> const* In, T* Out, std::size_t Count)
+	{
+		detail::compute_noise_array<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::simplex(In, Out, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinGrid(vec<2, T, Q> const& Origin, vec<2, T, Q> const& Step, std::size_t Width, std::size_t RowBegin, std::size_t RowEnd, T* Out)
+	{
+		detail::compute_noise_grid<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::perlin(Origin, Step, Width, RowBegin, RowEnd, Out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexGrid(vec<2, T, Q> const& Origin, vec<2, T, Q> const& Step, std::size_t Width, std::size_t RowBegin, std::size_t RowEnd, T* Out)
+	{
+		detail::compute_noise_grid<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::simplex(Origin, Step, Width, RowBegin, RowEnd, Out);
+	}
 }//namespace glm
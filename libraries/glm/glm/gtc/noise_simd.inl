@@ -0,0 +1,684 @@
+/// @ref gtc_noise
+
+#include "../simd/common.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// A register of Size floats, one position per lane. The kernels below are written once against
+	// its operators and repeat the scalar functions operation for operation, so every lane gets
+	// the scalar result. Offsets of 0 are left out: they can only change the sign of a zero.
+	template<length_t Size>
+	struct noise_lanes;
+
+	template<>
+	struct noise_lanes<4>
+	{
+		static length_t const size = 4;
+
+		GLM_FUNC_QUALIFIER static noise_lanes set(float x)
+		{
+			noise_lanes const Result = {_mm_set1_ps(x)};
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes load(float const* p)
+		{
+			noise_lanes const Result = {_mm_loadu_ps(p)};
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER void store(float* p) const
+		{
+			_mm_storeu_ps(p, data);
+		}
+
+		// x + Base + i in lane i
+		GLM_FUNC_QUALIFIER static noise_lanes index(float Base)
+		{
+			noise_lanes const Result = {_mm_add_ps(_mm_set1_ps(Base), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f))};
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes add(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm_add_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes sub(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm_sub_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes mul(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm_mul_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes div(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm_div_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes min(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm_min_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes max(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm_max_ps(a.data, b.data)}; return r;}
+
+		GLM_FUNC_QUALIFIER static noise_lanes neg(noise_lanes a)
+		{
+			noise_lanes const r = {_mm_xor_ps(a.data, _mm_set1_ps(-0.0f))};
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes abs(noise_lanes a)
+		{
+			noise_lanes const r = {glm_vec4_abs(a.data)};
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes floor(noise_lanes a)
+		{
+#			if GLM_ARCH & GLM_ARCH_SSE41_BIT
+				noise_lanes const r = {_mm_floor_ps(a.data)};
+#			else
+				// glm_vec4_floor is exact below 2^23, above which every float is an integer already
+				__m128 const Small = _mm_cmplt_ps(glm_vec4_abs(a.data), _mm_set1_ps(8388608.0f));
+				noise_lanes const r = {_mm_or_ps(_mm_and_ps(Small, glm_vec4_floor(a.data)), _mm_andnot_ps(Small, a.data))};
+#			endif
+			return r;
+		}
+
+		// step(Edge, x): x < Edge ? 0 : 1
+		GLM_FUNC_QUALIFIER static noise_lanes step(noise_lanes Edge, noise_lanes x)
+		{
+			noise_lanes const r = {_mm_andnot_ps(_mm_cmplt_ps(x.data, Edge.data), _mm_set1_ps(1.0f))};
+			return r;
+		}
+
+		__m128 data;
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<>
+	struct noise_lanes<8>
+	{
+		static length_t const size = 8;
+
+		GLM_FUNC_QUALIFIER static noise_lanes set(float x)
+		{
+			noise_lanes const Result = {_mm256_set1_ps(x)};
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes load(float const* p)
+		{
+			noise_lanes const Result = {_mm256_loadu_ps(p)};
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER void store(float* p) const
+		{
+			_mm256_storeu_ps(p, data);
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes index(float Base)
+		{
+			noise_lanes const Result = {_mm256_add_ps(_mm256_set1_ps(Base), _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f))};
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes add(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm256_add_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes sub(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm256_sub_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes mul(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm256_mul_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes div(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm256_div_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes min(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm256_min_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes max(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm256_max_ps(a.data, b.data)}; return r;}
+
+		GLM_FUNC_QUALIFIER static noise_lanes neg(noise_lanes a)
+		{
+			noise_lanes const r = {_mm256_xor_ps(a.data, _mm256_set1_ps(-0.0f))};
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes abs(noise_lanes a)
+		{
+			noise_lanes const r = {_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.data)};
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes floor(noise_lanes a)
+		{
+			noise_lanes const r = {_mm256_floor_ps(a.data)};
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes step(noise_lanes Edge, noise_lanes x)
+		{
+			noise_lanes const r = {_mm256_andnot_ps(_mm256_cmp_ps(x.data, Edge.data, _CMP_LT_OQ), _mm256_set1_ps(1.0f))};
+			return r;
+		}
+
+		__m256 data;
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	template<>
+	struct noise_lanes<16>
+	{
+		static length_t const size = 16;
+
+		GLM_FUNC_QUALIFIER static noise_lanes set(float x)
+		{
+			noise_lanes const Result = {_mm512_set1_ps(x)};
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes load(float const* p)
+		{
+			noise_lanes const Result = {_mm512_loadu_ps(p)};
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER void store(float* p) const
+		{
+			_mm512_storeu_ps(p, data);
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes index(float Base)
+		{
+			noise_lanes const Result = {_mm512_add_ps(_mm512_set1_ps(Base), _mm512_setr_ps(
+				0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f))};
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes add(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm512_add_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes sub(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm512_sub_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes mul(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm512_mul_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes div(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm512_div_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes min(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm512_min_ps(a.data, b.data)}; return r;}
+		GLM_FUNC_QUALIFIER static noise_lanes max(noise_lanes a, noise_lanes b) {noise_lanes const r = {_mm512_max_ps(a.data, b.data)}; return r;}
+
+		// AVX-512 F has no float logic, the integer one does the same
+		GLM_FUNC_QUALIFIER static noise_lanes neg(noise_lanes a)
+		{
+			noise_lanes const r = {_mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(a.data), _mm512_set1_epi32(static_cast<int>(0x80000000))))};
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes abs(noise_lanes a)
+		{
+			noise_lanes const r = {_mm512_castsi512_ps(_mm512_and_epi32(_mm512_castps_si512(a.data), _mm512_set1_epi32(0x7FFFFFFF)))};
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static noise_lanes floor(noise_lanes a)
+		{
+			noise_lanes const r = {_mm512_roundscale_ps(a.data, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)};
+			return r;
+		}
+
+		// Not less than, unordered included, like the andnot of the narrower registers
+		GLM_FUNC_QUALIFIER static noise_lanes step(noise_lanes Edge, noise_lanes x)
+		{
+			noise_lanes const r = {_mm512_maskz_mov_ps(_mm512_cmp_ps_mask(x.data, Edge.data, _CMP_NLT_UQ), _mm512_set1_ps(1.0f))};
+			return r;
+		}
+
+		__m512 data;
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		typedef noise_lanes<16> noise_simd;
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+		typedef noise_lanes<8> noise_simd;
+#	else
+		typedef noise_lanes<4> noise_simd;
+#	endif
+
+	template<length_t N> GLM_FUNC_QUALIFIER noise_lanes<N> operator+(noise_lanes<N> a, noise_lanes<N> b) {return noise_lanes<N>::add(a, b);}
+	template<length_t N> GLM_FUNC_QUALIFIER noise_lanes<N> operator-(noise_lanes<N> a, noise_lanes<N> b) {return noise_lanes<N>::sub(a, b);}
+	template<length_t N> GLM_FUNC_QUALIFIER noise_lanes<N> operator*(noise_lanes<N> a, noise_lanes<N> b) {return noise_lanes<N>::mul(a, b);}
+	template<length_t N> GLM_FUNC_QUALIFIER noise_lanes<N> operator/(noise_lanes<N> a, noise_lanes<N> b) {return noise_lanes<N>::div(a, b);}
+	template<length_t N> GLM_FUNC_QUALIFIER noise_lanes<N> operator+(noise_lanes<N> a, float b) {return a + noise_lanes<N>::set(b);}
+	template<length_t N> GLM_FUNC_QUALIFIER noise_lanes<N> operator-(noise_lanes<N> a, float b) {return a - noise_lanes<N>::set(b);}
+	template<length_t N> GLM_FUNC_QUALIFIER noise_lanes<N> operator*(noise_lanes<N> a, float b) {return a * noise_lanes<N>::set(b);}
+	template<length_t N> GLM_FUNC_QUALIFIER noise_lanes<N> operator/(noise_lanes<N> a, float b) {return a / noise_lanes<N>::set(b);}
+	template<length_t N> GLM_FUNC_QUALIFIER noise_lanes<N> operator-(float a, noise_lanes<N> b) {return noise_lanes<N>::set(a) - b;}
+	template<length_t N> GLM_FUNC_QUALIFIER noise_lanes<N> operator*(float a, noise_lanes<N> b) {return noise_lanes<N>::set(a) * b;}
+	template<length_t N> GLM_FUNC_QUALIFIER noise_lanes<N> operator-(noise_lanes<N> a) {return noise_lanes<N>::neg(a);}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_fract(noise_lanes<N> x)
+	{
+		return x - noise_lanes<N>::floor(x);
+	}
+
+	// mod(x, vec(289))
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_mod(noise_lanes<N> x)
+	{
+		return x - 289.0f * noise_lanes<N>::floor(x / 289.0f);
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_mod289(noise_lanes<N> x)
+	{
+		return x - noise_lanes<N>::floor(x * (static_cast<float>(1.0) / static_cast<float>(289.0))) * static_cast<float>(289.0);
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_permute(noise_lanes<N> x)
+	{
+		return noise_mod289(((x * static_cast<float>(34)) + static_cast<float>(1)) * x);
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_taylorInvSqrt(noise_lanes<N> r)
+	{
+		return static_cast<float>(1.79284291400159) - static_cast<float>(0.85373472095314) * r;
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_fade(noise_lanes<N> t)
+	{
+		return (t * t * t) * (t * (t * static_cast<float>(6) - static_cast<float>(15)) + static_cast<float>(10));
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_mix(noise_lanes<N> x, noise_lanes<N> y, noise_lanes<N> a)
+	{
+		return x * (1.0f - a) + y * a;
+	}
+
+	// One corner of perlin(vec2): the gradient hashed from i, normalised, dotted with the offset (fx, fy)
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_perlin_corner(noise_lanes<N> i, noise_lanes<N> fx, noise_lanes<N> fy)
+	{
+		noise_lanes<N> gx = static_cast<float>(2) * noise_fract(i / static_cast<float>(41)) - static_cast<float>(1);
+		noise_lanes<N> const gy = noise_lanes<N>::abs(gx) - static_cast<float>(0.5);
+		noise_lanes<N> const tx = noise_lanes<N>::floor(gx + static_cast<float>(0.5));
+		gx = gx - tx;
+
+		noise_lanes<N> const norm = noise_taylorInvSqrt(gx * gx + gy * gy);
+		return (gx * norm) * fx + (gy * norm) * fy;
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_perlin(noise_lanes<N> x, noise_lanes<N> y)
+	{
+		typedef noise_lanes<N> lanes;
+
+		lanes const Fx = lanes::floor(x);
+		lanes const Fy = lanes::floor(y);
+		lanes const ix0 = noise_mod(Fx);
+		lanes const iy0 = noise_mod(Fy);
+		lanes const ix1 = noise_mod(Fx + 1.0f);
+		lanes const iy1 = noise_mod(Fy + 1.0f);
+		lanes const fx0 = noise_fract(x);
+		lanes const fy0 = noise_fract(y);
+		lanes const fx1 = fx0 - 1.0f;
+		lanes const fy1 = fy0 - 1.0f;
+
+		lanes const px0 = noise_permute(ix0);
+		lanes const px1 = noise_permute(ix1);
+		lanes const n00 = noise_perlin_corner(noise_permute(px0 + iy0), fx0, fy0);
+		lanes const n10 = noise_perlin_corner(noise_permute(px1 + iy0), fx1, fy0);
+		lanes const n01 = noise_perlin_corner(noise_permute(px0 + iy1), fx0, fy1);
+		lanes const n11 = noise_perlin_corner(noise_permute(px1 + iy1), fx1, fy1);
+
+		lanes const fade_x = noise_fade(fx0);
+		lanes const fade_y = noise_fade(fy0);
+		lanes const n_x0 = noise_mix(n00, n10, fade_x);
+		lanes const n_x1 = noise_mix(n01, n11, fade_x);
+		return static_cast<float>(2.3) * noise_mix(n_x0, n_x1, fade_y);
+	}
+
+	// One corner of perlin(vec3)
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_perlin_corner(noise_lanes<N> ixy, noise_lanes<N> fx, noise_lanes<N> fy, noise_lanes<N> fz)
+	{
+		typedef noise_lanes<N> lanes;
+
+		lanes gx = ixy * static_cast<float>(1.0 / 7.0);
+		lanes gy = noise_fract(lanes::floor(gx) * static_cast<float>(1.0 / 7.0)) - static_cast<float>(0.5);
+		gx = noise_fract(gx);
+		lanes const gz = lanes::set(0.5f) - lanes::abs(gx) - lanes::abs(gy);
+		lanes const sz = lanes::step(gz, lanes::set(0.0f));
+		gx = gx - sz * (lanes::step(lanes::set(0.0f), gx) - static_cast<float>(0.5));
+		gy = gy - sz * (lanes::step(lanes::set(0.0f), gy) - static_cast<float>(0.5));
+
+		lanes const norm = noise_taylorInvSqrt(gx * gx + gy * gy + gz * gz);
+		return (gx * norm) * fx + (gy * norm) * fy + (gz * norm) * fz;
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_perlin(noise_lanes<N> x, noise_lanes<N> y, noise_lanes<N> z)
+	{
+		typedef noise_lanes<N> lanes;
+
+		lanes const Fx = lanes::floor(x);
+		lanes const Fy = lanes::floor(y);
+		lanes const Fz = lanes::floor(z);
+		lanes const ix0 = noise_mod289(Fx);
+		lanes const iy0 = noise_mod289(Fy);
+		lanes const iz0 = noise_mod289(Fz);
+		lanes const ix1 = noise_mod289(Fx + static_cast<float>(1));
+		lanes const iy1 = noise_mod289(Fy + static_cast<float>(1));
+		lanes const iz1 = noise_mod289(Fz + static_cast<float>(1));
+		lanes const fx0 = noise_fract(x);
+		lanes const fy0 = noise_fract(y);
+		lanes const fz0 = noise_fract(z);
+		lanes const fx1 = fx0 - static_cast<float>(1);
+		lanes const fy1 = fy0 - static_cast<float>(1);
+		lanes const fz1 = fz0 - static_cast<float>(1);
+
+		lanes const px0 = noise_permute(ix0);
+		lanes const px1 = noise_permute(ix1);
+		lanes const ixy00 = noise_permute(px0 + iy0);
+		lanes const ixy10 = noise_permute(px1 + iy0);
+		lanes const ixy01 = noise_permute(px0 + iy1);
+		lanes const ixy11 = noise_permute(px1 + iy1);
+
+		lanes const n000 = noise_perlin_corner(noise_permute(ixy00 + iz0), fx0, fy0, fz0);
+		lanes const n100 = noise_perlin_corner(noise_permute(ixy10 + iz0), fx1, fy0, fz0);
+		lanes const n010 = noise_perlin_corner(noise_permute(ixy01 + iz0), fx0, fy1, fz0);
+		lanes const n110 = noise_perlin_corner(noise_permute(ixy11 + iz0), fx1, fy1, fz0);
+		lanes const n001 = noise_perlin_corner(noise_permute(ixy00 + iz1), fx0, fy0, fz1);
+		lanes const n101 = noise_perlin_corner(noise_permute(ixy10 + iz1), fx1, fy0, fz1);
+		lanes const n011 = noise_perlin_corner(noise_permute(ixy01 + iz1), fx0, fy1, fz1);
+		lanes const n111 = noise_perlin_corner(noise_permute(ixy11 + iz1), fx1, fy1, fz1);
+
+		lanes const fade_x = noise_fade(fx0);
+		lanes const fade_y = noise_fade(fy0);
+		lanes const fade_z = noise_fade(fz0);
+		lanes const n_z00 = noise_mix(n000, n001, fade_z);
+		lanes const n_z10 = noise_mix(n100, n101, fade_z);
+		lanes const n_z01 = noise_mix(n010, n011, fade_z);
+		lanes const n_z11 = noise_mix(n110, n111, fade_z);
+		lanes const n_yz0 = noise_mix(n_z00, n_z01, fade_y);
+		lanes const n_yz1 = noise_mix(n_z10, n_z11, fade_y);
+		return static_cast<float>(2.2) * noise_mix(n_yz0, n_yz1, fade_x);
+	}
+
+	// One corner of simplex(vec2): the falloff m times the gradient hashed from p dotted with (dx, dy)
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_simplex_corner(noise_lanes<N> p, noise_lanes<N> dx, noise_lanes<N> dy)
+	{
+		typedef noise_lanes<N> lanes;
+
+		lanes m = lanes::max(static_cast<float>(0.5) - (dx * dx + dy * dy), lanes::set(0.0f));
+		m = m * m;
+		m = m * m;
+
+		lanes const x = static_cast<float>(2) * noise_fract(p * static_cast<float>(0.024390243902439)) - static_cast<float>(1);
+		lanes const h = lanes::abs(x) - static_cast<float>(0.5);
+		lanes const ox = lanes::floor(x + static_cast<float>(0.5));
+		lanes const a0 = x - ox;
+
+		m = m * (static_cast<float>(1.79284291400159) - static_cast<float>(0.85373472095314) * (a0 * a0 + h * h));
+		return m * (a0 * dx + h * dy);
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_simplex(noise_lanes<N> x, noise_lanes<N> y)
+	{
+		typedef noise_lanes<N> lanes;
+
+		float const C0 = static_cast<float>(0.211324865405187);
+		float const C1 = static_cast<float>(0.366025403784439);
+		float const C2 = static_cast<float>(-0.577350269189626);
+
+		// First corner
+		lanes const d = x * C1 + y * C1;
+		lanes ix = lanes::floor(x + d);
+		lanes iy = lanes::floor(y + d);
+		lanes const di = ix * C0 + iy * C0;
+		lanes const x0 = x - ix + di;
+		lanes const y0 = y - iy + di;
+
+		// Other corners: i1 = x0.x > x0.y ? (1, 0) : (0, 1)
+		lanes const i1y = lanes::step(x0, y0);
+		lanes const i1x = 1.0f - i1y;
+		lanes const x1 = x0 + C0 - i1x;
+		lanes const y1 = y0 + C0 - i1y;
+		lanes const x2 = x0 + C2;
+		lanes const y2 = y0 + C2;
+
+		// Permutations
+		ix = noise_mod(ix);
+		iy = noise_mod(iy);
+		lanes const p0 = noise_permute(noise_permute(iy) + ix);
+		lanes const p1 = noise_permute(noise_permute(iy + i1y) + ix + i1x);
+		lanes const p2 = noise_permute(noise_permute(iy + static_cast<float>(1)) + ix + static_cast<float>(1));
+
+		lanes const g0 = noise_simplex_corner(p0, x0, y0);
+		lanes const g1 = noise_simplex_corner(p1, x1, y1);
+		lanes const g2 = noise_simplex_corner(p2, x2, y2);
+		return static_cast<float>(130) * (g0 + g1 + g2);
+	}
+
+	// One corner of simplex(vec3): the gradient hashed from p, normalised, dotted with (dx, dy, dz)
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_simplex_corner(noise_lanes<N> p, noise_lanes<N> dx, noise_lanes<N> dy, noise_lanes<N> dz, noise_lanes<N> const ns[3], noise_lanes<N>* m)
+	{
+		typedef noise_lanes<N> lanes;
+
+		lanes const j = p - static_cast<float>(49) * lanes::floor(p * ns[2] * ns[2]);
+		lanes const x_ = lanes::floor(j * ns[2]);
+		lanes const y_ = lanes::floor(j - static_cast<float>(7) * x_);
+
+		lanes const x = x_ * ns[0] + ns[1];
+		lanes const y = y_ * ns[0] + ns[1];
+		lanes const h = static_cast<float>(1) - lanes::abs(x) - lanes::abs(y);
+
+		lanes const sx = lanes::floor(x) * static_cast<float>(2) + static_cast<float>(1);
+		lanes const sy = lanes::floor(y) * static_cast<float>(2) + static_cast<float>(1);
+		lanes const sh = -lanes::step(h, lanes::set(0.0f));
+		lanes const ax = x + sx * sh;
+		lanes const ay = y + sy * sh;
+
+		lanes const norm = noise_taylorInvSqrt(ax * ax + ay * ay + h * h);
+
+		lanes const falloff = lanes::max(static_cast<float>(0.6) - (dx * dx + dy * dy + dz * dz), lanes::set(0.0f));
+		*m = falloff * falloff;
+		return (ax * norm) * dx + (ay * norm) * dy + (h * norm) * dz;
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER noise_lanes<N> noise_simplex(noise_lanes<N> x, noise_lanes<N> y, noise_lanes<N> z)
+	{
+		typedef noise_lanes<N> lanes;
+
+		float const Cx = static_cast<float>(1.0 / 6.0);
+		float const Cy = static_cast<float>(1.0 / 3.0);
+
+		// First corner
+		lanes const d = x * Cy + y * Cy + z * Cy;
+		lanes ix = lanes::floor(x + d);
+		lanes iy = lanes::floor(y + d);
+		lanes iz = lanes::floor(z + d);
+		lanes const di = ix * Cx + iy * Cx + iz * Cx;
+		lanes const x0 = x - ix + di;
+		lanes const y0 = y - iy + di;
+		lanes const z0 = z - iz + di;
+
+		// Other corners
+		lanes const gx = lanes::step(y0, x0);
+		lanes const gy = lanes::step(z0, y0);
+		lanes const gz = lanes::step(x0, z0);
+		lanes const lx = static_cast<float>(1) - gx;
+		lanes const ly = static_cast<float>(1) - gy;
+		lanes const lz = static_cast<float>(1) - gz;
+		lanes const i1x = lanes::min(gx, lz);
+		lanes const i1y = lanes::min(gy, lx);
+		lanes const i1z = lanes::min(gz, ly);
+		lanes const i2x = lanes::max(gx, lz);
+		lanes const i2y = lanes::max(gy, lx);
+		lanes const i2z = lanes::max(gz, ly);
+
+		lanes const x1 = x0 - i1x + Cx;
+		lanes const y1 = y0 - i1y + Cx;
+		lanes const z1 = z0 - i1z + Cx;
+		lanes const x2 = x0 - i2x + Cy;
+		lanes const y2 = y0 - i2y + Cy;
+		lanes const z2 = z0 - i2z + Cy;
+		lanes const x3 = x0 - static_cast<float>(0.5);
+		lanes const y3 = y0 - static_cast<float>(0.5);
+		lanes const z3 = z0 - static_cast<float>(0.5);
+
+		// Permutations
+		ix = noise_mod289(ix);
+		iy = noise_mod289(iy);
+		iz = noise_mod289(iz);
+		lanes const p0 = noise_permute(noise_permute(noise_permute(iz) + iy) + ix);
+		lanes const p1 = noise_permute(noise_permute(noise_permute(iz + i1z) + iy + i1y) + ix + i1x);
+		lanes const p2 = noise_permute(noise_permute(noise_permute(iz + i2z) + iy + i2y) + ix + i2x);
+		lanes const p3 = noise_permute(noise_permute(noise_permute(iz + 1.0f) + iy + 1.0f) + ix + 1.0f);
+
+		float const n_ = static_cast<float>(0.142857142857); // 1.0/7.0
+		lanes const ns[3] = {lanes::set(n_ * 2.0f - 0.0f), lanes::set(n_ * 0.5f - 1.0f), lanes::set(n_ * 1.0f - 0.0f)};
+
+		lanes m0, m1, m2, m3;
+		lanes const d0 = noise_simplex_corner(p0, x0, y0, z0, ns, &m0);
+		lanes const d1 = noise_simplex_corner(p1, x1, y1, z1, ns, &m1);
+		lanes const d2 = noise_simplex_corner(p2, x2, y2, z2, ns, &m2);
+		lanes const d3 = noise_simplex_corner(p3, x3, y3, z3, ns, &m3);
+		return static_cast<float>(42) * ((m0 * m0 * d0 + m1 * m1 * d1) + (m2 * m2 * d2 + m3 * m3 * d3));
+	}
+
+	struct noise_perlin_kernel
+	{
+		template<length_t N>
+		GLM_FUNC_QUALIFIER static noise_lanes<N> call(noise_lanes<N> x, noise_lanes<N> y) {return noise_perlin(x, y);}
+
+		template<length_t N>
+		GLM_FUNC_QUALIFIER static noise_lanes<N> call(noise_lanes<N> x, noise_lanes<N> y, noise_lanes<N> z) {return noise_perlin(x, y, z);}
+	};
+
+	struct noise_simplex_kernel
+	{
+		template<length_t N>
+		GLM_FUNC_QUALIFIER static noise_lanes<N> call(noise_lanes<N> x, noise_lanes<N> y) {return noise_simplex(x, y);}
+
+		template<length_t N>
+		GLM_FUNC_QUALIFIER static noise_lanes<N> call(noise_lanes<N> x, noise_lanes<N> y, noise_lanes<N> z) {return noise_simplex(x, y, z);}
+	};
+
+	// Positions are gathered in lane order, which works for any qualifier; the last group is padded
+	// with zeros and only its first Count results are copied out
+	template<typename Kernel, qualifier Q>
+	GLM_FUNC_QUALIFIER void noise_array(vec<2, float, Q> const* In, float* Out, std::size_t Count)
+	{
+		length_t const Size = noise_simd::size;
+
+		for(std::size_t i = 0; i < Count; i += Size)
+		{
+			std::size_t const Group = glm::min(static_cast<std::size_t>(Size), Count - i);
+
+			float x[Size] = {0}, y[Size] = {0};
+			for(std::size_t k = 0; k < Group; ++k)
+			{
+				x[k] = In[i + k].x;
+				y[k] = In[i + k].y;
+			}
+
+			noise_simd const n = Kernel::call(noise_simd::load(x), noise_simd::load(y));
+			if(Group == Size)
+				n.store(Out + i);
+			else
+			{
+				n.store(x);
+				for(std::size_t k = 0; k < Group; ++k)
+					Out[i + k] = x[k];
+			}
+		}
+	}
+
+	template<typename Kernel, qualifier Q>
+	GLM_FUNC_QUALIFIER void noise_array(vec<3, float, Q> const* In, float* Out, std::size_t Count)
+	{
+		length_t const Size = noise_simd::size;
+
+		for(std::size_t i = 0; i < Count; i += Size)
+		{
+			std::size_t const Group = glm::min(static_cast<std::size_t>(Size), Count - i);
+
+			float x[Size] = {0}, y[Size] = {0}, z[Size] = {0};
+			for(std::size_t k = 0; k < Group; ++k)
+			{
+				x[k] = In[i + k].x;
+				y[k] = In[i + k].y;
+				z[k] = In[i + k].z;
+			}
+
+			noise_simd const n = Kernel::call(noise_simd::load(x), noise_simd::load(y), noise_simd::load(z));
+			if(Group == Size)
+				n.store(Out + i);
+			else
+			{
+				n.store(x);
+				for(std::size_t k = 0; k < Group; ++k)
+					Out[i + k] = x[k];
+			}
+		}
+	}
+
+	// The column index counts up in the lanes, exact as a float for any grid that fits in memory
+	// along one row, so x = Origin.x + Step.x * index matches the scalar position
+	template<typename Kernel, qualifier Q>
+	GLM_FUNC_QUALIFIER void noise_grid(vec<2, float, Q> const& Origin, vec<2, float, Q> const& Step, std::size_t Width, std::size_t RowBegin, std::size_t RowEnd, float* Out)
+	{
+		length_t const Size = noise_simd::size;
+		noise_simd const OriginX = noise_simd::set(Origin.x);
+		noise_simd const StepX = noise_simd::set(Step.x);
+
+		for(std::size_t y = RowBegin; y < RowEnd; ++y)
+		{
+			float* Row = Out + y * Width;
+			noise_simd const Y = noise_simd::set(Origin.y + Step.y * static_cast<float>(y));
+
+			std::size_t x = 0;
+			for(; x + Size <= Width; x += Size)
+				Kernel::call(OriginX + StepX * noise_simd::index(static_cast<float>(x)), Y).store(Row + x);
+			if(x < Width)
+			{
+				float Tail[Size];
+				Kernel::call(OriginX + StepX * noise_simd::index(static_cast<float>(x)), Y).store(Tail);
+				for(std::size_t k = 0; x + k < Width; ++k)
+					Row[x + k] = Tail[k];
+			}
+		}
+	}
+
+	template<qualifier Q>
+	struct compute_noise_array<2, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void perlin(vec<2, float, Q> const* In, float* Out, std::size_t Count)
+		{
+			noise_array<noise_perlin_kernel>(In, Out, Count);
+		}
+
+		GLM_FUNC_QUALIFIER static void simplex(vec<2, float, Q> const* In, float* Out, std::size_t Count)
+		{
+			noise_array<noise_simplex_kernel>(In, Out, Count);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_noise_array<3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void perlin(vec<3, float, Q> const* In, float* Out, std::size_t Count)
+		{
+			noise_array<noise_perlin_kernel>(In, Out, Count);
+		}
+
+		GLM_FUNC_QUALIFIER static void simplex(vec<3, float, Q> const* In, float* Out, std::size_t Count)
+		{
+			noise_array<noise_simplex_kernel>(In, Out, Count);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_noise_grid<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void perlin(vec<2, float, Q> const& Origin, vec<2, float, Q> const& Step, std::size_t Width, std::size_t RowBegin, std::size_t RowEnd, float* Out)
+		{
+			noise_grid<noise_perlin_kernel>(Origin, Step, Width, RowBegin, RowEnd, Out);
+		}
+
+		GLM_FUNC_QUALIFIER static void simplex(vec<2, float, Q> const& Origin, vec<2, float, Q> const& Step, std::size_t Width, std::size_t RowBegin, std::size_t RowEnd, float* Out)
+		{
+			noise_grid<noise_simplex_kernel>(Origin, Step, Width, RowBegin, RowEnd, Out);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
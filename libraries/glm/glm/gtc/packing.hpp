@@ -15,6 +15,7 @@
 
 // Dependency:
 #include "type_precision.hpp"
+#include "../packing.hpp"
 #include "../ext/vector_packing.hpp"
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
@@ -305,6 +306,55 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.4 Floating-Point Pack and Unpack Functions</a>
 	GLM_FUNC_DECL vec4 unpackHalf4x16(uint64 p);
 
+	/// Span versions of the four-component pack and unpack functions: convert Count
+	/// values from In and write them to Out, which may not overlap In.
+	/// Each value is converted exactly as the single value function would do it.
+	/// With GLM_FORCE_INTRINSICS, a vector goes through SSE2 in a few instructions.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packUnorm4x8(vec4 const& v)
+	GLM_FUNC_DISCARD_DECL void packUnorm4x8(vec4 const* In, uint32* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see vec4 unpackUnorm4x8(uint32 p)
+	GLM_FUNC_DISCARD_DECL void unpackUnorm4x8(uint32 const* In, vec4* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see uint32 packSnorm4x8(vec4 const& v)
+	GLM_FUNC_DISCARD_DECL void packSnorm4x8(vec4 const* In, uint32* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see vec4 unpackSnorm4x8(uint32 p)
+	GLM_FUNC_DISCARD_DECL void unpackSnorm4x8(uint32 const* In, vec4* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see uint64 packUnorm4x16(vec4 const& v)
+	GLM_FUNC_DISCARD_DECL void packUnorm4x16(vec4 const* In, uint64* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see vec4 unpackUnorm4x16(uint64 p)
+	GLM_FUNC_DISCARD_DECL void unpackUnorm4x16(uint64 const* In, vec4* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see uint64 packSnorm4x16(vec4 const& v)
+	GLM_FUNC_DISCARD_DECL void packSnorm4x16(vec4 const* In, uint64* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see vec4 unpackSnorm4x16(uint64 p)
+	GLM_FUNC_DISCARD_DECL void unpackSnorm4x16(uint64 const* In, vec4* Out, std::size_t Count);
+
+	/// Half values round ties away from zero, as packHalf4x16(vec4 const& v) does.
+	///
+	/// @see gtc_packing
+	/// @see uint64 packHalf4x16(vec4 const& v)
+	GLM_FUNC_DISCARD_DECL void packHalf4x16(vec4 const* In, uint64* Out, std::size_t Count);
+
+	/// When F16C is enabled, signaling NaNs are returned quiet.
+	///
+	/// @see gtc_packing
+	/// @see vec4 unpackHalf4x16(uint64 p)
+	GLM_FUNC_DISCARD_DECL void unpackHalf4x16(uint64 const* In, vec4* Out, std::size_t Count);
+
 	/// Returns an unsigned integer obtained by converting the components of a four-component signed integer vector
 	/// to the 10-10-10-2-bit signed integer representation found in the OpenGL Specification,
 	/// and then packing these four values into a 32-bit unsigned integer.
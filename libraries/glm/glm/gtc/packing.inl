@@ -439,17 +439,12 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 packUnorm4x16(vec4 const& v)
 	{
-		u16vec4 const Topack(round(clamp(v , 0.0f, 1.0f) * 65535.0f));
-		uint64 Packed = 0;
-		memcpy(&Packed, &Topack, sizeof(Packed));
-		return Packed;
+		return detail::compute_packUnorm4x16<GLM_CONFIG_SIMD == GLM_ENABLE>::call(v);
 	}
 
 	GLM_FUNC_QUALIFIER vec4 unpackUnorm4x16(uint64 p)
 	{
-		u16vec4 Unpack;
-		memcpy(&Unpack, &p, sizeof(Unpack));
-		return vec4(Unpack) * 1.5259021896696421759365224689097e-5f; // 1.0 / 65535.0
+		return detail::compute_unpackUnorm4x16<GLM_CONFIG_SIMD == GLM_ENABLE>::call(p);
 	}
 
 	GLM_FUNC_QUALIFIER uint16 packSnorm1x16(float v)
@@ -471,19 +466,12 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 packSnorm4x16(vec4 const& v)
 	{
-		i16vec4 const Topack(round(clamp(v ,-1.0f, 1.0f) * 32767.0f));
-		uint64 Packed = 0;
-		memcpy(&Packed, &Topack, sizeof(Packed));
-		return Packed;
+		return detail::compute_packSnorm4x16<GLM_CONFIG_SIMD == GLM_ENABLE>::call(v);
 	}
 
 	GLM_FUNC_QUALIFIER vec4 unpackSnorm4x16(uint64 p)
 	{
-		i16vec4 Unpack;
-		memcpy(&Unpack, &p, sizeof(Unpack));
-		return clamp(
-			vec4(Unpack) * 3.0518509475997192297128208258309e-5f, //1.0f / 32767.0f,
-			-1.0f, 1.0f);
+		return detail::compute_unpackSnorm4x16<GLM_CONFIG_SIMD == GLM_ENABLE>::call(p);
 	}
 
 	GLM_FUNC_QUALIFIER uint16 packHalf1x16(float v)
@@ -503,25 +491,72 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 packHalf4x16(glm::vec4 const& v)
 	{
-		i16vec4 const Unpack(
-			detail::toFloat16(v.x),
-			detail::toFloat16(v.y),
-			detail::toFloat16(v.z),
-			detail::toFloat16(v.w));
-		uint64 Packed = 0;
-		memcpy(&Packed, &Unpack, sizeof(Packed));
-		return Packed;
+		return detail::compute_packHalf4x16<GLM_CONFIG_SIMD == GLM_ENABLE>::call(v);
 	}
 
 	GLM_FUNC_QUALIFIER glm::vec4 unpackHalf4x16(uint64 v)
 	{
-		i16vec4 Unpack;
-		memcpy(&Unpack, &v, sizeof(Unpack));
-		return vec4(
-			detail::toFloat32(Unpack.x),
-			detail::toFloat32(Unpack.y),
-			detail::toFloat32(Unpack.z),
-			detail::toFloat32(Unpack.w));
+		return detail::compute_unpackHalf4x16<GLM_CONFIG_SIMD == GLM_ENABLE>::call(v);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm4x8(vec4 const* In, uint32* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = detail::compute_packUnorm4x8<GLM_CONFIG_SIMD == GLM_ENABLE>::call(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm4x8(uint32 const* In, vec4* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = detail::compute_unpackUnorm4x8<GLM_CONFIG_SIMD == GLM_ENABLE>::call(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm4x8(vec4 const* In, uint32* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = detail::compute_packSnorm4x8<GLM_CONFIG_SIMD == GLM_ENABLE>::call(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm4x8(uint32 const* In, vec4* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = detail::compute_unpackSnorm4x8<GLM_CONFIG_SIMD == GLM_ENABLE>::call(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm4x16(vec4 const* In, uint64* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = detail::compute_packUnorm4x16<GLM_CONFIG_SIMD == GLM_ENABLE>::call(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm4x16(uint64 const* In, vec4* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = detail::compute_unpackUnorm4x16<GLM_CONFIG_SIMD == GLM_ENABLE>::call(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm4x16(vec4 const* In, uint64* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = detail::compute_packSnorm4x16<GLM_CONFIG_SIMD == GLM_ENABLE>::call(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm4x16(uint64 const* In, vec4* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = detail::compute_unpackSnorm4x16<GLM_CONFIG_SIMD == GLM_ENABLE>::call(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packHalf4x16(vec4 const* In, uint64* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = detail::compute_packHalf4x16<GLM_CONFIG_SIMD == GLM_ENABLE>::call(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf4x16(uint64 const* In, vec4* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = detail::compute_unpackHalf4x16<GLM_CONFIG_SIMD == GLM_ENABLE>::call(In[i]);
 	}
 
 	GLM_FUNC_QUALIFIER uint32 packI3x10_1x2(ivec4 const& v)
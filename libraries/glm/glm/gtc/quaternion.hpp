@@ -30,6 +30,7 @@
 #include "../detail/type_mat4x4.hpp"
 #include "../detail/type_vec3.hpp"
 #include "../detail/type_vec4.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_quaternion extension included")
@@ -167,6 +168,23 @@ namespace glm
 	GLM_FUNC_DECL qua<T, Q> quatLookAtLH(
 		vec<3, T, Q> const& direction,
 		vec<3, T, Q> const& up);
+
+	/// Span versions of slerp: Out[i] = slerp(x[i], y[i], a[i]) for Count quaternions.
+	/// Out may alias x or y. For float quaternions with SIMD enabled, four
+	/// quaternions are interpolated at once with polynomial acos and sin: results
+	/// are within 1e-6 of slerp for unit quaternions and factors in [0, 1].
+	///
+	/// @see gtc_quaternion
+	/// @see qua<T, Q> slerp(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, qua<T, Q>* Out, std::size_t Count);
+
+	/// Out[i] = slerp(x[i], y[i], a) for Count quaternions, with a shared factor.
+	///
+	/// @see gtc_quaternion
+	/// @see void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, qua<T, Q>* Out, std::size_t Count)
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T a, qua<T, Q>* Out, std::size_t Count);
 	/// @}
 } //namespace glm
 
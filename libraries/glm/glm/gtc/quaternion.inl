@@ -200,9 +200,43 @@ namespace glm
 
 		return quat_cast(Result);
 	}
+
+namespace detail
+{
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_quat_slerp_span
+	{
+		GLM_FUNC_QUALIFIER static void call(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, qua<T, Q>* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = slerp(x[i], y[i], a[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void call(qua<T, Q> const* x, qua<T, Q> const* y, T a, qua<T, Q>* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = slerp(x[i], y[i], a);
+		}
+	};
+}//namespace detail
 }//namespace glm
 
 #if GLM_CONFIG_SIMD == GLM_ENABLE
 #	include "quaternion_simd.inl"
 #endif
 
+namespace glm
+{
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, qua<T, Q>* Out, std::size_t Count)
+	{
+		detail::compute_quat_slerp_span<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(x, y, a, Out, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T a, qua<T, Q>* Out, std::size_t Count)
+	{
+		detail::compute_quat_slerp_span<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(x, y, a, Out, Count);
+	}
+}//namespace glm
+
@@ -0,0 +1,54 @@
+/// @ref gtc_quaternion
+
+#include "../simd/quaternion.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Interpolates four quaternions per iteration: transposed to one component per
+	// vector, the components are independent of the storage order.
+	template<qualifier Q>
+	struct compute_quat_slerp_span<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void slerp4(qua<float, Q> const* x, qua<float, Q> const* y, glm_vec4 a, qua<float, Q>* Out)
+		{
+			glm_vec4 x0[4], y0[4], Out0[4];
+			for(int i = 0; i < 4; ++i)
+			{
+				x0[i] = _mm_loadu_ps(&x[i][0]);
+				y0[i] = _mm_loadu_ps(&y[i][0]);
+			}
+			_MM_TRANSPOSE4_PS(x0[0], x0[1], x0[2], x0[3]);
+			_MM_TRANSPOSE4_PS(y0[0], y0[1], y0[2], y0[3]);
+
+			glm_quat4_slerp(x0, y0, a, Out0);
+
+			_MM_TRANSPOSE4_PS(Out0[0], Out0[1], Out0[2], Out0[3]);
+			for(int i = 0; i < 4; ++i)
+				_mm_storeu_ps(&Out[i][0], Out0[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void call(qua<float, Q> const* x, qua<float, Q> const* y, float const* a, qua<float, Q>* Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+				slerp4(x + i, y + i, _mm_loadu_ps(a + i), Out + i);
+			for(; i < Count; ++i)
+				Out[i] = slerp(x[i], y[i], a[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void call(qua<float, Q> const* x, qua<float, Q> const* y, float a, qua<float, Q>* Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+				slerp4(x + i, y + i, _mm_set1_ps(a), Out + i);
+			for(; i < Count; ++i)
+				Out[i] = slerp(x[i], y[i], a);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -10,6 +10,10 @@
 /// Include <glm/gtc/random.hpp> to use the features of this extension.
 ///
 /// Generate random number from various distribution methods.
+///
+/// The functions without a generator argument draw from std::rand. The ones taking a
+/// xoshiro128 draw from that explicit state instead, and have array versions filling
+/// Count values per call with SSE2, AVX2 or AVX-512 when SIMD is enabled.
 
 #pragma once
 
@@ -17,6 +21,7 @@
 #include "../ext/scalar_int_sized.hpp"
 #include "../ext/scalar_uint_sized.hpp"
 #include "../detail/qualifier.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_random extension included")
@@ -76,6 +81,124 @@ namespace glm
 	template<typename T>
 	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius);
 
+	/// Pseudo random generator with explicit state: eight xoshiro128** streams
+	/// (Blackman and Vigna) advanced in turn, so array functions run them side by side
+	/// in SIMD registers. Output i comes from lane i % 8.
+	///
+	/// A generator is not shared between threads without locking: give each thread its
+	/// own, for instance with the thread index as Stream. Also meets the
+	/// UniformRandomBitGenerator requirements of <random>.
+	///
+	/// @see gtc_random
+	struct xoshiro128
+	{
+		typedef uint32 result_type;
+
+		/// Seeds the lanes from splitmix64. Generators with the same Seed and different Stream
+		/// give independent sequences; the same Seed and Stream always give the same one.
+		GLM_FUNC_DECL explicit xoshiro128(uint64 Seed = 0, uint64 Stream = 0);
+
+		/// Next 32 uniform random bits
+		GLM_FUNC_DECL result_type operator()();
+
+		// <random> needs these as constant expressions even where GLM_CONSTEXPR is empty
+#		if GLM_LANG & GLM_LANG_CXX11_FLAG
+			static constexpr result_type (min)() {return 0;}
+			static constexpr result_type (max)() {return 0xFFFFFFFFu;}
+#		else
+			static result_type (min)() {return 0;}
+			static result_type (max)() {return 0xFFFFFFFFu;}
+#		endif
+
+		/// State[i][k] is the word i of lane k
+		uint32 State[4][8];
+
+		/// Lane of the next single value
+		length_t Lane;
+	};
+
+	/// Fills Out with Count values, the same as Count calls to Generator().
+	///
+	/// @see gtc_random
+	GLM_FUNC_DISCARD_DECL void generate(xoshiro128& Generator, uint32* Out, std::size_t Count);
+
+	/// Generate random numbers in the interval [Min, Max] from Generator, according a linear distribution
+	///
+	/// @tparam genType Value type. Currently supported: float or double scalars.
+	/// @see gtc_random
+	template<typename genType>
+	GLM_FUNC_DECL genType linearRand(xoshiro128& Generator, genType Min, genType Max);
+
+	/// Generate random numbers in the interval [Min, Max] from Generator, according a linear distribution
+	///
+	/// @tparam T Value type. Currently supported: float or double.
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> linearRand(xoshiro128& Generator, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max);
+
+	/// Fills Out with Count values, the same as Count calls to linearRand(Generator, Min, Max).
+	///
+	/// @see gtc_random
+	GLM_FUNC_DISCARD_DECL void linearRand(xoshiro128& Generator, float Min, float Max, float* Out, std::size_t Count);
+
+	/// Generate random numbers from Generator, according a gaussian distribution.
+	/// Like gaussRand(Mean, Deviation), the standard deviation is Deviation * Deviation.
+	///
+	/// @see gtc_random
+	template<typename genType>
+	GLM_FUNC_DECL genType gaussRand(xoshiro128& Generator, genType Mean, genType Deviation);
+
+	/// Fills Out with Count values of a gaussian distribution of standard deviation Deviation * Deviation,
+	/// as gaussRand(Mean, Deviation). Each accepted polar method pair gives two values, so the sequence differs from single calls.
+	///
+	/// @see gtc_random
+	GLM_FUNC_DISCARD_DECL void gaussRand(xoshiro128& Generator, float Mean, float Deviation, float* Out, std::size_t Count);
+
+	/// Generate a random 2D vector from Generator, regularly distributed on a circle of a given radius
+	///
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DECL vec<2, T, defaultp> circularRand(xoshiro128& Generator, T Radius);
+
+	/// Generate a random 3D vector from Generator, regularly distributed on a sphere of a given radius
+	///
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DECL vec<3, T, defaultp> sphericalRand(xoshiro128& Generator, T Radius);
+
+	/// Generate a random 2D vector from Generator, regularly distributed within the area of a disk of a given radius
+	///
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DECL vec<2, T, defaultp> diskRand(xoshiro128& Generator, T Radius);
+
+	/// Generate a random 3D vector from Generator, regularly distributed within the volume of a ball of a given radius
+	///
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(xoshiro128& Generator, T Radius);
+
+	/// Fills Out with Count points on a circle. The array versions of the rejection samplers draw
+	/// candidates eight at a time, so their sequences differ from single calls.
+	///
+	/// @see gtc_random
+	GLM_FUNC_DISCARD_DECL void circularRand(xoshiro128& Generator, float Radius, vec<2, float, defaultp>* Out, std::size_t Count);
+
+	/// Fills Out with Count points on a sphere.
+	///
+	/// @see gtc_random
+	GLM_FUNC_DISCARD_DECL void sphericalRand(xoshiro128& Generator, float Radius, vec<3, float, defaultp>* Out, std::size_t Count);
+
+	/// Fills Out with Count points within a disk.
+	///
+	/// @see gtc_random
+	GLM_FUNC_DISCARD_DECL void diskRand(xoshiro128& Generator, float Radius, vec<2, float, defaultp>* Out, std::size_t Count);
+
+	/// Fills Out with Count points within a ball.
+	///
+	/// @see gtc_random
+	GLM_FUNC_DISCARD_DECL void ballRand(xoshiro128& Generator, float Radius, vec<3, float, defaultp>* Out, std::size_t Count);
+
 	/// @}
 }//namespace glm
 
@@ -301,3 +301,314 @@ namespace detail
 		return vec<3, T, defaultp>(x, y, z) * Radius;
 	}
 }//namespace glm
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER uint64 splitmix64(uint64& x)
+	{
+		x += 0x9E3779B97F4A7C15ull;
+		uint64 z = x;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	template<int Shift>
+	GLM_FUNC_QUALIFIER uint32 xoshiro128_rotl(uint32 x)
+	{
+		return (x << Shift) | (x >> (32 - Shift));
+	}
+
+	GLM_FUNC_QUALIFIER uint32 xoshiro128_next(uint32 (&State)[4][8], length_t Lane)
+	{
+		uint32 const Result = xoshiro128_rotl<7>(State[1][Lane] * 5u) * 9u;
+		uint32 const t = State[1][Lane] << 9;
+
+		State[2][Lane] ^= State[0][Lane];
+		State[3][Lane] ^= State[1][Lane];
+		State[1][Lane] ^= State[2][Lane];
+		State[0][Lane] ^= State[3][Lane];
+		State[2][Lane] ^= t;
+		State[3][Lane] = xoshiro128_rotl<11>(State[3][Lane]);
+
+		return Result;
+	}
+
+	// The high 24 bits as a float in [0, 1) and in [-1, 1), both exact
+	GLM_FUNC_QUALIFIER float xoshiro128_unorm(uint32 x)
+	{
+		return static_cast<float>(x >> 8) * (1.0f / 16777216.0f);
+	}
+
+	GLM_FUNC_QUALIFIER float xoshiro128_snorm(uint32 x)
+	{
+		return static_cast<float>(x >> 8) * (1.0f / 8388608.0f) - 1.0f;
+	}
+
+	template<typename T>
+	struct compute_xoshiro128_unorm
+	{
+		GLM_FUNC_QUALIFIER static T call(xoshiro128& Generator)
+		{
+			GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'linearRand' with a generator only accepts float or double inputs");
+			return static_cast<T>(xoshiro128_unorm(Generator()));
+		}
+	};
+
+	template<>
+	struct compute_xoshiro128_unorm<double>
+	{
+		GLM_FUNC_QUALIFIER static double call(xoshiro128& Generator)
+		{
+			uint32 const a = Generator() >> 5;
+			uint32 const b = Generator() >> 6;
+			return (static_cast<double>(a) * 67108864.0 + static_cast<double>(b)) * (1.0 / 9007199254740992.0);
+		}
+	};
+
+	// Whole steps of the eight lanes. The SIMD specializations give the same values as this one.
+	template<bool UseSimd>
+	struct compute_random_block
+	{
+		// Steps values of each lane, in lane order
+		GLM_FUNC_QUALIFIER static void bits(uint32 (&State)[4][8], uint32* Out, std::size_t Steps)
+		{
+			for(std::size_t i = 0; i < Steps; ++i)
+			for(length_t k = 0; k < 8; ++k)
+				Out[i * 8 + k] = xoshiro128_next(State, k);
+		}
+
+		GLM_FUNC_QUALIFIER static void linear(uint32 (&State)[4][8], float Min, float Range, float* Out, std::size_t Steps)
+		{
+			for(std::size_t i = 0; i < Steps; ++i)
+			for(length_t k = 0; k < 8; ++k)
+				Out[i * 8 + k] = xoshiro128_unorm(xoshiro128_next(State, k)) * Range + Min;
+		}
+
+		// One candidate per lane, uniform in [-1, 1)^Dims, returned scaled by Radius or, with Surface,
+		// projected on the sphere of that radius. W holds the squared lengths and the mask has bit k
+		// set when candidate k is inside the unit ball, but not at its centre.
+		GLM_FUNC_QUALIFIER static unsigned int ball(uint32 (&State)[4][8], length_t Dims, float Radius, bool Surface, float Out[3][8], float W[8])
+		{
+			for(length_t d = 0; d < Dims; ++d)
+			for(length_t k = 0; k < 8; ++k)
+				Out[d][k] = xoshiro128_snorm(xoshiro128_next(State, k));
+
+			unsigned int Mask = 0;
+			for(length_t k = 0; k < 8; ++k)
+			{
+				float w = Out[0][k] * Out[0][k] + Out[1][k] * Out[1][k];
+				if(Dims == 3)
+					w = w + Out[2][k] * Out[2][k];
+				W[k] = w;
+
+				if(!(w < 1.0f && w > 0.0f))
+					continue;
+				Mask |= 1u << k;
+
+				float const Scale = Surface ? Radius / std::sqrt(w) : Radius;
+				for(length_t d = 0; d < Dims; ++d)
+					Out[d][k] = Out[d][k] * Scale;
+			}
+			return Mask;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "random_simd.inl"
+#endif
+
+namespace glm{
+namespace detail
+{
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void ball_array(xoshiro128& Generator, float Radius, bool Surface, vec<L, float, defaultp>* Out, std::size_t Count)
+	{
+		assert(Radius > 0.0f);
+
+		float Candidates[3][8];
+		float W[8];
+		for(std::size_t i = 0; i < Count;)
+		{
+			unsigned int const Mask = compute_random_block<GLM_CONFIG_SIMD == GLM_ENABLE>::ball(Generator.State, L, Radius, Surface, Candidates, W);
+			for(length_t k = 0; k < 8 && i < Count; ++k)
+			{
+				if(!(Mask & (1u << k)))
+					continue;
+				for(length_t d = 0; d < L; ++d)
+					Out[i][d] = Candidates[d][k];
+				++i;
+			}
+		}
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER vec<L, T, defaultp> ball_rand(xoshiro128& Generator, T Radius, bool Surface)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		vec<L, T, defaultp> Result(T(0));
+		T w(0);
+		do
+		{
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = linearRand(Generator, T(-1), T(1));
+			w = dot(Result, Result);
+		}
+		while(!(w < T(1) && w > T(0)));
+
+		return Result * (Surface ? Radius / std::sqrt(w) : Radius);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER xoshiro128::xoshiro128(uint64 Seed, uint64 Stream) :
+		Lane(0)
+	{
+		uint64 y = Stream;
+		uint64 x = Seed ^ detail::splitmix64(y);
+		for(length_t k = 0; k < 8; ++k)
+		{
+			uint64 const a = detail::splitmix64(x);
+			uint64 const b = detail::splitmix64(x);
+			State[0][k] = static_cast<uint32>(a);
+			State[1][k] = static_cast<uint32>(a >> 32);
+			State[2][k] = static_cast<uint32>(b);
+			State[3][k] = static_cast<uint32>(b >> 32);
+
+			// An all zero state only ever gives zeros
+			if((a | b) == 0)
+				State[0][k] = 1;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128::result_type xoshiro128::operator()()
+	{
+		uint32 const Result = detail::xoshiro128_next(State, Lane);
+		Lane = (Lane + 1) % 8;
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER void generate(xoshiro128& Generator, uint32* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i < Count && Generator.Lane != 0; ++i)
+			Out[i] = Generator();
+
+		std::size_t const Steps = (Count - i) / 8;
+		detail::compute_random_block<GLM_CONFIG_SIMD == GLM_ENABLE>::bits(Generator.State, Out + i, Steps);
+
+		for(i += Steps * 8; i < Count; ++i)
+			Out[i] = Generator();
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType linearRand(xoshiro128& Generator, genType Min, genType Max)
+	{
+		return detail::compute_xoshiro128_unorm<genType>::call(Generator) * (Max - Min) + Min;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> linearRand(xoshiro128& Generator, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max)
+	{
+		vec<L, T, Q> Result(T(0));
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = linearRand(Generator, Min[i], Max[i]);
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER void linearRand(xoshiro128& Generator, float Min, float Max, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i < Count && Generator.Lane != 0; ++i)
+			Out[i] = linearRand(Generator, Min, Max);
+
+		std::size_t const Steps = (Count - i) / 8;
+		detail::compute_random_block<GLM_CONFIG_SIMD == GLM_ENABLE>::linear(Generator.State, Min, Max - Min, Out + i, Steps);
+
+		for(i += Steps * 8; i < Count; ++i)
+			Out[i] = linearRand(Generator, Min, Max);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType gaussRand(xoshiro128& Generator, genType Mean, genType Deviation)
+	{
+		genType w, x1, x2;
+
+		do
+		{
+			x1 = linearRand(Generator, genType(-1), genType(1));
+			x2 = linearRand(Generator, genType(-1), genType(1));
+
+			w = x1 * x1 + x2 * x2;
+		} while(!(w < genType(1) && w > genType(0)));
+
+		return x2 * std::sqrt(genType(-2) * std::log(w) / w) * (Deviation * Deviation) + Mean;
+	}
+
+	GLM_FUNC_QUALIFIER void gaussRand(xoshiro128& Generator, float Mean, float Deviation, float* Out, std::size_t Count)
+	{
+		float Candidates[3][8];
+		float W[8];
+		for(std::size_t i = 0; i < Count;)
+		{
+			unsigned int const Mask = detail::compute_random_block<GLM_CONFIG_SIMD == GLM_ENABLE>::ball(Generator.State, 2, 1.0f, false, Candidates, W);
+			for(length_t k = 0; k < 8 && i < Count; ++k)
+			{
+				if(!(Mask & (1u << k)))
+					continue;
+
+				float const Factor = std::sqrt(-2.0f * std::log(W[k]) / W[k]) * (Deviation * Deviation);
+				Out[i++] = Candidates[0][k] * Factor + Mean;
+				if(i < Count)
+					Out[i++] = Candidates[1][k] * Factor + Mean;
+			}
+		}
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> circularRand(xoshiro128& Generator, T Radius)
+	{
+		return detail::ball_rand<2>(Generator, Radius, true);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> sphericalRand(xoshiro128& Generator, T Radius)
+	{
+		return detail::ball_rand<3>(Generator, Radius, true);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> diskRand(xoshiro128& Generator, T Radius)
+	{
+		return detail::ball_rand<2>(Generator, Radius, false);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> ballRand(xoshiro128& Generator, T Radius)
+	{
+		return detail::ball_rand<3>(Generator, Radius, false);
+	}
+
+	GLM_FUNC_QUALIFIER void circularRand(xoshiro128& Generator, float Radius, vec<2, float, defaultp>* Out, std::size_t Count)
+	{
+		detail::ball_array(Generator, Radius, true, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void sphericalRand(xoshiro128& Generator, float Radius, vec<3, float, defaultp>* Out, std::size_t Count)
+	{
+		detail::ball_array(Generator, Radius, true, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void diskRand(xoshiro128& Generator, float Radius, vec<2, float, defaultp>* Out, std::size_t Count)
+	{
+		detail::ball_array(Generator, Radius, false, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void ballRand(xoshiro128& Generator, float Radius, vec<3, float, defaultp>* Out, std::size_t Count)
+	{
+		detail::ball_array(Generator, Radius, false, Out, Count);
+	}
+}//namespace glm
@@ -0,0 +1,247 @@
+/// @ref gtc_random
+
+#include "../simd/platform.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Size lanes of xoshiro128** held in registers, Size being 4 with SSE2 and 8 with AVX2.
+	// The float helpers repeat the scalar operations so each lane gets the scalar value.
+	template<length_t Size>
+	struct random_lanes;
+
+	template<>
+	struct random_lanes<4>
+	{
+		static length_t const size = 4;
+		typedef __m128 float_type;
+
+		__m128i s[4];
+
+		GLM_FUNC_QUALIFIER void load(uint32 (&State)[4][8], length_t Offset)
+		{
+			for(length_t i = 0; i < 4; ++i)
+				s[i] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&State[i][Offset]));
+		}
+
+		GLM_FUNC_QUALIFIER void store(uint32 (&State)[4][8], length_t Offset) const
+		{
+			for(length_t i = 0; i < 4; ++i)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&State[i][Offset]), s[i]);
+		}
+
+		template<int Shift>
+		GLM_FUNC_QUALIFIER static __m128i rotl(__m128i x)
+		{
+			return _mm_or_si128(_mm_slli_epi32(x, Shift), _mm_srli_epi32(x, 32 - Shift));
+		}
+
+		GLM_FUNC_QUALIFIER __m128i next()
+		{
+			// Multiplications by 5 and 9 as shifts and adds: SSE2 has no 32-bit multiply
+			__m128i const x5 = _mm_add_epi32(_mm_slli_epi32(s[1], 2), s[1]);
+			__m128i const r = rotl<7>(x5);
+			__m128i const Result = _mm_add_epi32(_mm_slli_epi32(r, 3), r);
+			__m128i const t = _mm_slli_epi32(s[1], 9);
+
+			s[2] = _mm_xor_si128(s[2], s[0]);
+			s[3] = _mm_xor_si128(s[3], s[1]);
+			s[1] = _mm_xor_si128(s[1], s[2]);
+			s[0] = _mm_xor_si128(s[0], s[3]);
+			s[2] = _mm_xor_si128(s[2], t);
+			s[3] = rotl<11>(s[3]);
+
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void store(uint32* p, __m128i x)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p), x);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float* p, __m128 x)
+		{
+			_mm_storeu_ps(p, x);
+		}
+
+		GLM_FUNC_QUALIFIER static __m128 set(float x)
+		{
+			return _mm_set1_ps(x);
+		}
+
+		GLM_FUNC_QUALIFIER static __m128 unorm(__m128i x)
+		{
+			return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(x, 8)), _mm_set1_ps(1.0f / 16777216.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static __m128 snorm(__m128i x)
+		{
+			return _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(x, 8)), _mm_set1_ps(1.0f / 8388608.0f)), _mm_set1_ps(1.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static __m128 add(__m128 a, __m128 b) {return _mm_add_ps(a, b);}
+		GLM_FUNC_QUALIFIER static __m128 mul(__m128 a, __m128 b) {return _mm_mul_ps(a, b);}
+		GLM_FUNC_QUALIFIER static __m128 div(__m128 a, __m128 b) {return _mm_div_ps(a, b);}
+		GLM_FUNC_QUALIFIER static __m128 sqrt(__m128 a) {return _mm_sqrt_ps(a);}
+
+		// Bit k set when 0 < w[k] < 1
+		GLM_FUNC_QUALIFIER static unsigned int inside(__m128 w)
+		{
+			__m128 const Inside = _mm_and_ps(_mm_cmplt_ps(w, _mm_set1_ps(1.0f)), _mm_cmpgt_ps(w, _mm_setzero_ps()));
+			return static_cast<unsigned int>(_mm_movemask_ps(Inside));
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	template<>
+	struct random_lanes<8>
+	{
+		static length_t const size = 8;
+		typedef __m256 float_type;
+
+		__m256i s[4];
+
+		GLM_FUNC_QUALIFIER void load(uint32 (&State)[4][8], length_t Offset)
+		{
+			for(length_t i = 0; i < 4; ++i)
+				s[i] = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&State[i][Offset]));
+		}
+
+		GLM_FUNC_QUALIFIER void store(uint32 (&State)[4][8], length_t Offset) const
+		{
+			for(length_t i = 0; i < 4; ++i)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(&State[i][Offset]), s[i]);
+		}
+
+		template<int Shift>
+		GLM_FUNC_QUALIFIER static __m256i rotl(__m256i x)
+		{
+#			if GLM_ARCH & GLM_ARCH_AVX512_BIT
+				return _mm256_rol_epi32(x, Shift);
+#			else
+				return _mm256_or_si256(_mm256_slli_epi32(x, Shift), _mm256_srli_epi32(x, 32 - Shift));
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER __m256i next()
+		{
+			__m256i const x5 = _mm256_add_epi32(_mm256_slli_epi32(s[1], 2), s[1]);
+			__m256i const r = rotl<7>(x5);
+			__m256i const Result = _mm256_add_epi32(_mm256_slli_epi32(r, 3), r);
+			__m256i const t = _mm256_slli_epi32(s[1], 9);
+
+			s[2] = _mm256_xor_si256(s[2], s[0]);
+			s[3] = _mm256_xor_si256(s[3], s[1]);
+			s[1] = _mm256_xor_si256(s[1], s[2]);
+			s[0] = _mm256_xor_si256(s[0], s[3]);
+			s[2] = _mm256_xor_si256(s[2], t);
+			s[3] = rotl<11>(s[3]);
+
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void store(uint32* p, __m256i x)
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float* p, __m256 x)
+		{
+			_mm256_storeu_ps(p, x);
+		}
+
+		GLM_FUNC_QUALIFIER static __m256 set(float x)
+		{
+			return _mm256_set1_ps(x);
+		}
+
+		GLM_FUNC_QUALIFIER static __m256 unorm(__m256i x)
+		{
+			return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(x, 8)), _mm256_set1_ps(1.0f / 16777216.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static __m256 snorm(__m256i x)
+		{
+			return _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(x, 8)), _mm256_set1_ps(1.0f / 8388608.0f)), _mm256_set1_ps(1.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static __m256 add(__m256 a, __m256 b) {return _mm256_add_ps(a, b);}
+		GLM_FUNC_QUALIFIER static __m256 mul(__m256 a, __m256 b) {return _mm256_mul_ps(a, b);}
+		GLM_FUNC_QUALIFIER static __m256 div(__m256 a, __m256 b) {return _mm256_div_ps(a, b);}
+		GLM_FUNC_QUALIFIER static __m256 sqrt(__m256 a) {return _mm256_sqrt_ps(a);}
+
+		GLM_FUNC_QUALIFIER static unsigned int inside(__m256 w)
+		{
+			__m256 const Inside = _mm256_and_ps(_mm256_cmp_ps(w, _mm256_set1_ps(1.0f), _CMP_LT_OQ), _mm256_cmp_ps(w, _mm256_setzero_ps(), _CMP_GT_OQ));
+			return static_cast<unsigned int>(_mm256_movemask_ps(Inside));
+		}
+	};
+
+	typedef random_lanes<8> random_lanes_simd;
+#	else
+	typedef random_lanes<4> random_lanes_simd;
+#	endif
+
+	template<>
+	struct compute_random_block<true>
+	{
+		typedef random_lanes_simd lanes;
+		static length_t const Groups = 8 / lanes::size;
+
+		GLM_FUNC_QUALIFIER static void bits(uint32 (&State)[4][8], uint32* Out, std::size_t Steps)
+		{
+			for(length_t g = 0; g < Groups; ++g)
+			{
+				lanes Lanes;
+				Lanes.load(State, g * lanes::size);
+				for(std::size_t i = 0; i < Steps; ++i)
+					lanes::store(Out + i * 8 + g * lanes::size, Lanes.next());
+				Lanes.store(State, g * lanes::size);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void linear(uint32 (&State)[4][8], float Min, float Range, float* Out, std::size_t Steps)
+		{
+			for(length_t g = 0; g < Groups; ++g)
+			{
+				lanes Lanes;
+				Lanes.load(State, g * lanes::size);
+				for(std::size_t i = 0; i < Steps; ++i)
+					lanes::store(Out + i * 8 + g * lanes::size, lanes::add(lanes::mul(lanes::unorm(Lanes.next()), lanes::set(Range)), lanes::set(Min)));
+				Lanes.store(State, g * lanes::size);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static unsigned int ball(uint32 (&State)[4][8], length_t Dims, float Radius, bool Surface, float Out[3][8], float W[8])
+		{
+			unsigned int Mask = 0;
+			for(length_t g = 0; g < Groups; ++g)
+			{
+				lanes Lanes;
+				Lanes.load(State, g * lanes::size);
+
+				lanes::float_type x[3];
+				for(length_t d = 0; d < Dims; ++d)
+					x[d] = lanes::snorm(Lanes.next());
+				Lanes.store(State, g * lanes::size);
+
+				lanes::float_type w = lanes::add(lanes::mul(x[0], x[0]), lanes::mul(x[1], x[1]));
+				if(Dims == 3)
+					w = lanes::add(w, lanes::mul(x[2], x[2]));
+
+				lanes::float_type const Scale = Surface ? lanes::div(lanes::set(Radius), lanes::sqrt(w)) : lanes::set(Radius);
+				for(length_t d = 0; d < Dims; ++d)
+					lanes::store(Out[d] + g * lanes::size, lanes::mul(x[d], Scale));
+				lanes::store(W + g * lanes::size, w);
+
+				Mask |= lanes::inside(w) << (g * lanes::size);
+			}
+			return Mask;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,79 @@
+/// @ref gtx_batch
+/// @file glm/gtx/batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_batch GLM_GTX_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/batch.hpp> to use the features of this extension.
+///
+/// Array versions of common transforms: one call processes Count elements read
+/// from In and written to Out, which may be In but may not partially overlap it.
+/// Each element gives exactly what the single value expression would give for
+/// the packed types, as long as the compiler does not contract it to FMA.
+///
+/// With AVX, each instruction handles eight vectors or two matrix columns; with
+/// AVX-512, sixteen vectors or a whole matrix, and array ends are masked instead
+/// of finished one element at a time. Outputs too large to stay in cache are
+/// written with non-temporal stores when Out is aligned to the register size.
+
+#pragma once
+
+// Dependency:
+#include "../mat4x4.hpp"
+#include "../mat3x2.hpp"
+#include "../vec2.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include "../geometric.hpp"
+#include "../matrix.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_batch extension included")
+#endif
+
+namespace glm{
+namespace batch
+{
+	/// @addtogroup gtx_batch
+	/// @{
+
+	/// Out[i] = m * In[i]
+	GLM_FUNC_DISCARD_DECL void transform(mat4 const& m, vec4 const* In, vec4* Out, std::size_t Count);
+
+	/// Transforms points: Out[i] = vec3(m * vec4(In[i], 1)), without perspective divide.
+	GLM_FUNC_DISCARD_DECL void transform(mat4 const& m, vec3 const* In, vec3* Out, std::size_t Count);
+
+	/// Transforms points of the z = 0 plane: Out[i] = vec2(m * vec4(In[i], 0, 1)), without perspective divide.
+	GLM_FUNC_DISCARD_DECL void transform(mat4 const& m, vec2 const* In, vec2* Out, std::size_t Count);
+
+	/// Transforms 2D points by an affine matrix: Out[i] = m * vec3(In[i], 1).
+	GLM_FUNC_DISCARD_DECL void transform(mat3x2 const& m, vec2 const* In, vec2* Out, std::size_t Count);
+
+	/// Out[i] = a[i] * b[i]
+	GLM_FUNC_DISCARD_DECL void multiply(mat4 const* a, mat4 const* b, mat4* Out, std::size_t Count);
+
+	/// Out[i] = a * b[i], for instance a parent transform applied to local ones.
+	GLM_FUNC_DISCARD_DECL void multiply(mat4 const& a, mat4 const* b, mat4* Out, std::size_t Count);
+
+	/// Out[i] = transpose(In[i])
+	GLM_FUNC_DISCARD_DECL void transpose(mat4 const* In, mat4* Out, std::size_t Count);
+
+	/// Out[i] = normalize(In[i])
+	GLM_FUNC_DISCARD_DECL void normalize(vec2 const* In, vec2* Out, std::size_t Count);
+
+	/// Out[i] = normalize(In[i])
+	GLM_FUNC_DISCARD_DECL void normalize(vec3 const* In, vec3* Out, std::size_t Count);
+
+	/// Out[i] = normalize(In[i])
+	GLM_FUNC_DISCARD_DECL void normalize(vec4 const* In, vec4* Out, std::size_t Count);
+
+	/// @}
+}//namespace batch
+}//namespace glm
+
+#include "batch.inl"
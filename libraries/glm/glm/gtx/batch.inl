@@ -0,0 +1,118 @@
+/// @ref gtx_batch
+
+namespace glm{
+namespace detail
+{
+	template<bool UseSimd>
+	struct compute_batch
+	{
+		GLM_FUNC_QUALIFIER static void transform(mat4 const& m, vec4 const* In, vec4* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = m * In[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void transform(mat4 const& m, vec3 const* In, vec3* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = vec3(m * vec4(In[i], 1.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static void transform(mat4 const& m, vec2 const* In, vec2* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = vec2(m * vec4(In[i], 0.0f, 1.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static void transform(mat3x2 const& m, vec2 const* In, vec2* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = m * vec3(In[i], 1.0f);
+		}
+
+		GLM_FUNC_QUALIFIER static void multiply(mat4 const* a, mat4 const* b, mat4* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = a[i] * b[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void multiply(mat4 const& a, mat4 const* b, mat4* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = a * b[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void transpose(mat4 const* In, mat4* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::transpose(In[i]);
+		}
+
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void normalize(vec<L, float, defaultp> const* In, vec<L, float, defaultp>* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::normalize(In[i]);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "batch_simd.inl"
+#endif
+
+namespace glm{
+namespace batch
+{
+	GLM_FUNC_QUALIFIER void transform(mat4 const& m, vec4 const* In, vec4* Out, std::size_t Count)
+	{
+		detail::compute_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::transform(m, In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void transform(mat4 const& m, vec3 const* In, vec3* Out, std::size_t Count)
+	{
+		detail::compute_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::transform(m, In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void transform(mat4 const& m, vec2 const* In, vec2* Out, std::size_t Count)
+	{
+		detail::compute_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::transform(m, In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void transform(mat3x2 const& m, vec2 const* In, vec2* Out, std::size_t Count)
+	{
+		detail::compute_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::transform(m, In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void multiply(mat4 const* a, mat4 const* b, mat4* Out, std::size_t Count)
+	{
+		detail::compute_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::multiply(a, b, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void multiply(mat4 const& a, mat4 const* b, mat4* Out, std::size_t Count)
+	{
+		detail::compute_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::multiply(a, b, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void transpose(mat4 const* In, mat4* Out, std::size_t Count)
+	{
+		detail::compute_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::transpose(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void normalize(vec2 const* In, vec2* Out, std::size_t Count)
+	{
+		detail::compute_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::normalize(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void normalize(vec3 const* In, vec3* Out, std::size_t Count)
+	{
+		detail::compute_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::normalize(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void normalize(vec4 const* In, vec4* Out, std::size_t Count)
+	{
+		detail::compute_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::normalize(In, Out, Count);
+	}
+}//namespace batch
+}//namespace glm
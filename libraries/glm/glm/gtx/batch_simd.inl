@@ -0,0 +1,614 @@
+/// @ref gtx_batch
+
+#include "../simd/batch.h"
+#include "../simd/matrix.h"
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+namespace glm{
+namespace detail
+{
+	// Non-temporal stores skip the cache, which only pays off when the output would evict the working set anyway
+	GLM_FUNC_QUALIFIER bool batch_stream(void const* Out, std::size_t Bytes)
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			std::size_t const AlignMask = 63;
+#		else
+			std::size_t const AlignMask = 31;
+#		endif
+		return (reinterpret_cast<std::size_t>(Out) & AlignMask) == 0 && Bytes >= (static_cast<std::size_t>(4) << 20);
+	}
+
+	template<bool Stream>
+	struct batch_store
+	{
+		GLM_FUNC_QUALIFIER static void call(float* p, __m256 v)
+		{
+			_mm256_storeu_ps(p, v);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			GLM_FUNC_QUALIFIER static void call(float* p, __m512 v)
+			{
+				_mm512_storeu_ps(p, v);
+			}
+#		endif
+
+		GLM_FUNC_QUALIFIER static void fence()
+		{}
+	};
+
+	template<>
+	struct batch_store<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(float* p, __m256 v)
+		{
+			_mm256_stream_ps(p, v);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			GLM_FUNC_QUALIFIER static void call(float* p, __m512 v)
+			{
+				_mm512_stream_ps(p, v);
+			}
+#		endif
+
+		GLM_FUNC_QUALIFIER static void fence()
+		{
+			_mm_sfence();
+		}
+	};
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+	// With AVX-512 the loops finish the arrays themselves: the last group is loaded and stored with masks,
+	// which never touch memory past Count
+
+	template<length_t Regs>
+	struct batch_tail
+	{
+		GLM_FUNC_QUALIFIER batch_tail(std::size_t Floats)
+		{
+			for(length_t k = 0; k < Regs; ++k)
+				Mask[k] = glm_mask16(Floats > std::size_t(k * 16) ? static_cast<unsigned int>(Floats - k * 16) : 0u);
+		}
+
+		GLM_FUNC_QUALIFIER void load(float const* p, __m512 v[Regs]) const
+		{
+			for(length_t k = 0; k < Regs; ++k)
+				v[k] = _mm512_maskz_loadu_ps(Mask[k], p + k * 16);
+		}
+
+		GLM_FUNC_QUALIFIER void store(float* p, __m512 const v[Regs]) const
+		{
+			for(length_t k = 0; k < Regs; ++k)
+				_mm512_mask_storeu_ps(p + k * 16, Mask[k], v[k]);
+		}
+
+		__mmask16 Mask[Regs];
+	};
+
+	// Same sums as mat4 * vec4 with w = 1: (m0 * x + m1 * y) + (m2 * z + m3)
+	GLM_FUNC_QUALIFIER void batch_transform_vec3x16(__m512 const M[3][4], __m512 const In[3], __m512 Out[3])
+	{
+		__m512 x, y, z;
+		glm_vec3x16_deinterleave(In[0], In[1], In[2], &x, &y, &z);
+
+		__m512 r[3];
+		for(length_t j = 0; j < 3; ++j)
+		{
+			__m512 const add0 = _mm512_add_ps(_mm512_mul_ps(M[j][0], x), _mm512_mul_ps(M[j][1], y));
+			__m512 const add1 = _mm512_add_ps(_mm512_mul_ps(M[j][2], z), M[j][3]);
+			r[j] = _mm512_add_ps(add0, add1);
+		}
+
+		glm_vec3x16_interleave(r[0], r[1], r[2], Out);
+	}
+
+	GLM_FUNC_QUALIFIER void batch_transform_vec2x16(__m512 const C[2][3], __m512 const In[2], __m512 Out[2])
+	{
+		__m512 x, y;
+		glm_vec2x16_deinterleave(In[0], In[1], &x, &y);
+
+		__m512 r[2];
+		for(length_t j = 0; j < 2; ++j)
+			r[j] = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(C[j][0], x), _mm512_mul_ps(C[j][1], y)), C[j][2]);
+
+		glm_vec2x16_interleave(r[0], r[1], Out);
+	}
+
+	GLM_FUNC_QUALIFIER void batch_normalize_vec3x16(__m512 const In[3], __m512 Out[3])
+	{
+		__m512 x, y, z;
+		glm_vec3x16_deinterleave(In[0], In[1], In[2], &x, &y, &z);
+
+		__m512 const dot0 = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(x, x), _mm512_mul_ps(y, y)), _mm512_mul_ps(z, z));
+		__m512 const inv0 = _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_sqrt_ps(dot0));
+
+		glm_vec3x16_interleave(_mm512_mul_ps(x, inv0), _mm512_mul_ps(y, inv0), _mm512_mul_ps(z, inv0), Out);
+	}
+
+	GLM_FUNC_QUALIFIER void batch_normalize_vec2x16(__m512 const In[2], __m512 Out[2])
+	{
+		__m512 x, y;
+		glm_vec2x16_deinterleave(In[0], In[1], &x, &y);
+
+		__m512 const dot0 = _mm512_add_ps(_mm512_mul_ps(x, x), _mm512_mul_ps(y, y));
+		__m512 const inv0 = _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_sqrt_ps(dot0));
+
+		glm_vec2x16_interleave(_mm512_mul_ps(x, inv0), _mm512_mul_ps(y, inv0), Out);
+	}
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER std::size_t batch_transform_vec4(mat4 const& m, float const* In, float* Out, std::size_t Count)
+	{
+		__m512 const Col[4] = {
+			_mm512_broadcast_f32x4(_mm_loadu_ps(&m[0][0])),
+			_mm512_broadcast_f32x4(_mm_loadu_ps(&m[1][0])),
+			_mm512_broadcast_f32x4(_mm_loadu_ps(&m[2][0])),
+			_mm512_broadcast_f32x4(_mm_loadu_ps(&m[3][0]))};
+
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+			batch_store<Stream>::call(Out + i * 4, glm_mat4x4_mul_vec4(Col, _mm512_loadu_ps(In + i * 4)));
+		if(i < Count)
+		{
+			batch_tail<1> const Tail((Count - i) * 4);
+			__m512 v[1];
+			Tail.load(In + i * 4, v);
+			v[0] = glm_mat4x4_mul_vec4(Col, v[0]);
+			Tail.store(Out + i * 4, v);
+		}
+		batch_store<Stream>::fence();
+		return Count;
+	}
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER std::size_t batch_transform_vec3(mat4 const& m, float const* In, float* Out, std::size_t Count)
+	{
+		__m512 M[3][4];
+		for(length_t j = 0; j < 3; ++j)
+		for(length_t k = 0; k < 4; ++k)
+			M[j][k] = _mm512_set1_ps(m[k][j]);
+
+		std::size_t i = 0;
+		for(; i + 16 <= Count; i += 16)
+		{
+			__m512 const v[3] = {_mm512_loadu_ps(In + i * 3 + 0), _mm512_loadu_ps(In + i * 3 + 16), _mm512_loadu_ps(In + i * 3 + 32)};
+			__m512 o[3];
+			batch_transform_vec3x16(M, v, o);
+			batch_store<Stream>::call(Out + i * 3 + 0, o[0]);
+			batch_store<Stream>::call(Out + i * 3 + 16, o[1]);
+			batch_store<Stream>::call(Out + i * 3 + 32, o[2]);
+		}
+		if(i < Count)
+		{
+			batch_tail<3> const Tail((Count - i) * 3);
+			__m512 v[3], o[3];
+			Tail.load(In + i * 3, v);
+			batch_transform_vec3x16(M, v, o);
+			Tail.store(Out + i * 3, o);
+		}
+		batch_store<Stream>::fence();
+		return Count;
+	}
+
+	// Out = (c0 * x + c1 * y) + c2, the order of both mat3x2 * vec3(v, 1) and mat4 * vec4(v, 0, 1) once c2 folds the constant terms
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER std::size_t batch_transform_vec2(vec2 const& c0, vec2 const& c1, vec2 const& c2, float const* In, float* Out, std::size_t Count)
+	{
+		__m512 const C[2][3] = {
+			{_mm512_set1_ps(c0.x), _mm512_set1_ps(c1.x), _mm512_set1_ps(c2.x)},
+			{_mm512_set1_ps(c0.y), _mm512_set1_ps(c1.y), _mm512_set1_ps(c2.y)}};
+
+		std::size_t i = 0;
+		for(; i + 16 <= Count; i += 16)
+		{
+			__m512 const v[2] = {_mm512_loadu_ps(In + i * 2 + 0), _mm512_loadu_ps(In + i * 2 + 16)};
+			__m512 o[2];
+			batch_transform_vec2x16(C, v, o);
+			batch_store<Stream>::call(Out + i * 2 + 0, o[0]);
+			batch_store<Stream>::call(Out + i * 2 + 16, o[1]);
+		}
+		if(i < Count)
+		{
+			batch_tail<2> const Tail((Count - i) * 2);
+			__m512 v[2], o[2];
+			Tail.load(In + i * 2, v);
+			batch_transform_vec2x16(C, v, o);
+			Tail.store(Out + i * 2, o);
+		}
+		batch_store<Stream>::fence();
+		return Count;
+	}
+
+	// One matrix of b per register; the columns of a are broadcast straight from memory, which costs no shuffle
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER void batch_multiply(float const* a, std::size_t StrideA, float const* b, float* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const* const ai = a + i * StrideA;
+			__m512 const Col[4] = {
+				_mm512_broadcast_f32x4(_mm_loadu_ps(ai + 0)),
+				_mm512_broadcast_f32x4(_mm_loadu_ps(ai + 4)),
+				_mm512_broadcast_f32x4(_mm_loadu_ps(ai + 8)),
+				_mm512_broadcast_f32x4(_mm_loadu_ps(ai + 12))};
+
+			// b is read before writing, so Out may be a or b
+			batch_store<Stream>::call(Out + i * 16, glm_mat4x4_mul_cols(Col, _mm512_loadu_ps(b + i * 16)));
+		}
+		batch_store<Stream>::fence();
+	}
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER void batch_transpose(float const* In, float* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			batch_store<Stream>::call(Out + i * 16, glm_mat4x4_transpose(_mm512_loadu_ps(In + i * 16)));
+		batch_store<Stream>::fence();
+	}
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER std::size_t batch_normalize_vec4(float const* In, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+			batch_store<Stream>::call(Out + i * 4, glm_vec4x4_normalize(_mm512_loadu_ps(In + i * 4)));
+		if(i < Count)
+		{
+			batch_tail<1> const Tail((Count - i) * 4);
+			__m512 v[1];
+			Tail.load(In + i * 4, v);
+			v[0] = glm_vec4x4_normalize(v[0]);
+			Tail.store(Out + i * 4, v);
+		}
+		batch_store<Stream>::fence();
+		return Count;
+	}
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER std::size_t batch_normalize_vec3(float const* In, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 16 <= Count; i += 16)
+		{
+			__m512 const v[3] = {_mm512_loadu_ps(In + i * 3 + 0), _mm512_loadu_ps(In + i * 3 + 16), _mm512_loadu_ps(In + i * 3 + 32)};
+			__m512 o[3];
+			batch_normalize_vec3x16(v, o);
+			batch_store<Stream>::call(Out + i * 3 + 0, o[0]);
+			batch_store<Stream>::call(Out + i * 3 + 16, o[1]);
+			batch_store<Stream>::call(Out + i * 3 + 32, o[2]);
+		}
+		if(i < Count)
+		{
+			batch_tail<3> const Tail((Count - i) * 3);
+			__m512 v[3], o[3];
+			Tail.load(In + i * 3, v);
+			batch_normalize_vec3x16(v, o);
+			Tail.store(Out + i * 3, o);
+		}
+		batch_store<Stream>::fence();
+		return Count;
+	}
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER std::size_t batch_normalize_vec2(float const* In, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 16 <= Count; i += 16)
+		{
+			__m512 const v[2] = {_mm512_loadu_ps(In + i * 2 + 0), _mm512_loadu_ps(In + i * 2 + 16)};
+			__m512 o[2];
+			batch_normalize_vec2x16(v, o);
+			batch_store<Stream>::call(Out + i * 2 + 0, o[0]);
+			batch_store<Stream>::call(Out + i * 2 + 16, o[1]);
+		}
+		if(i < Count)
+		{
+			batch_tail<2> const Tail((Count - i) * 2);
+			__m512 v[2], o[2];
+			Tail.load(In + i * 2, v);
+			batch_normalize_vec2x16(v, o);
+			Tail.store(Out + i * 2, o);
+		}
+		batch_store<Stream>::fence();
+		return Count;
+	}
+
+#else
+
+	// The loops below process whole groups and return how many elements they did, the caller finishes the rest
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER std::size_t batch_transform_vec4(mat4 const& m, float const* In, float* Out, std::size_t Count)
+	{
+		__m256 const Col[4] = {
+			_mm256_broadcast_ps(reinterpret_cast<__m128 const*>(&m[0][0])),
+			_mm256_broadcast_ps(reinterpret_cast<__m128 const*>(&m[1][0])),
+			_mm256_broadcast_ps(reinterpret_cast<__m128 const*>(&m[2][0])),
+			_mm256_broadcast_ps(reinterpret_cast<__m128 const*>(&m[3][0]))};
+
+		std::size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+			batch_store<Stream>::call(Out + i * 4, glm_mat4x2_mul_vec4(Col, _mm256_loadu_ps(In + i * 4)));
+		batch_store<Stream>::fence();
+		return i;
+	}
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER std::size_t batch_transform_vec3(mat4 const& m, float const* In, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			__m256 x, y, z;
+			glm_vec3x8_load(In + i * 3, &x, &y, &z);
+
+			// Same sums as mat4 * vec4 with w = 1: (m0 * x + m1 * y) + (m2 * z + m3)
+			__m256 r[3];
+			for(length_t j = 0; j < 3; ++j)
+			{
+				__m256 const add0 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(m[0][j]), x), _mm256_mul_ps(_mm256_set1_ps(m[1][j]), y));
+				__m256 const add1 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(m[2][j]), z), _mm256_set1_ps(m[3][j]));
+				r[j] = _mm256_add_ps(add0, add1);
+			}
+
+			__m256 o[3];
+			glm_vec3x8_interleave(r[0], r[1], r[2], o);
+			batch_store<Stream>::call(Out + i * 3 + 0, o[0]);
+			batch_store<Stream>::call(Out + i * 3 + 8, o[1]);
+			batch_store<Stream>::call(Out + i * 3 + 16, o[2]);
+		}
+		batch_store<Stream>::fence();
+		return i;
+	}
+
+	// Out = (c0 * x + c1 * y) + c2, the order of both mat3x2 * vec3(v, 1) and mat4 * vec4(v, 0, 1) once c2 folds the constant terms
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER std::size_t batch_transform_vec2(vec2 const& c0, vec2 const& c1, vec2 const& c2, float const* In, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			__m256 x, y;
+			glm_vec2x8_load(In + i * 2, &x, &y);
+
+			__m256 r[2];
+			for(length_t j = 0; j < 2; ++j)
+			{
+				__m256 const add0 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(c0[j]), x), _mm256_mul_ps(_mm256_set1_ps(c1[j]), y));
+				r[j] = _mm256_add_ps(add0, _mm256_set1_ps(c2[j]));
+			}
+
+			__m256 o[2];
+			glm_vec2x8_interleave(r[0], r[1], o);
+			batch_store<Stream>::call(Out + i * 2 + 0, o[0]);
+			batch_store<Stream>::call(Out + i * 2 + 8, o[1]);
+		}
+		batch_store<Stream>::fence();
+		return i;
+	}
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER void batch_multiply(float const* a, std::size_t StrideA, float const* b, float* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const* const ai = a + i * StrideA;
+			__m256 const Col[4] = {
+				_mm256_broadcast_ps(reinterpret_cast<__m128 const*>(ai + 0)),
+				_mm256_broadcast_ps(reinterpret_cast<__m128 const*>(ai + 4)),
+				_mm256_broadcast_ps(reinterpret_cast<__m128 const*>(ai + 8)),
+				_mm256_broadcast_ps(reinterpret_cast<__m128 const*>(ai + 12))};
+
+			// Both column pairs are read before writing, so Out may be a or b
+			__m256 const b01 = _mm256_loadu_ps(b + i * 16 + 0);
+			__m256 const b23 = _mm256_loadu_ps(b + i * 16 + 8);
+			batch_store<Stream>::call(Out + i * 16 + 0, glm_mat4x2_mul_cols(Col, b01));
+			batch_store<Stream>::call(Out + i * 16 + 8, glm_mat4x2_mul_cols(Col, b23));
+		}
+		batch_store<Stream>::fence();
+	}
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER std::size_t batch_normalize_vec4(float const* In, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+			batch_store<Stream>::call(Out + i * 4, glm_vec4x2_normalize(_mm256_loadu_ps(In + i * 4)));
+		batch_store<Stream>::fence();
+		return i;
+	}
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER std::size_t batch_normalize_vec3(float const* In, float* Out, std::size_t Count)
+	{
+		__m256 const one = _mm256_set1_ps(1.0f);
+
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			__m256 x, y, z;
+			glm_vec3x8_load(In + i * 3, &x, &y, &z);
+
+			__m256 const dot0 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z));
+			__m256 const inv0 = _mm256_div_ps(one, _mm256_sqrt_ps(dot0));
+
+			__m256 o[3];
+			glm_vec3x8_interleave(_mm256_mul_ps(x, inv0), _mm256_mul_ps(y, inv0), _mm256_mul_ps(z, inv0), o);
+			batch_store<Stream>::call(Out + i * 3 + 0, o[0]);
+			batch_store<Stream>::call(Out + i * 3 + 8, o[1]);
+			batch_store<Stream>::call(Out + i * 3 + 16, o[2]);
+		}
+		batch_store<Stream>::fence();
+		return i;
+	}
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER std::size_t batch_normalize_vec2(float const* In, float* Out, std::size_t Count)
+	{
+		__m256 const one = _mm256_set1_ps(1.0f);
+
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			__m256 x, y;
+			glm_vec2x8_load(In + i * 2, &x, &y);
+
+			__m256 const dot0 = _mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y));
+			__m256 const inv0 = _mm256_div_ps(one, _mm256_sqrt_ps(dot0));
+
+			__m256 o[2];
+			glm_vec2x8_interleave(_mm256_mul_ps(x, inv0), _mm256_mul_ps(y, inv0), o);
+			batch_store<Stream>::call(Out + i * 2 + 0, o[0]);
+			batch_store<Stream>::call(Out + i * 2 + 8, o[1]);
+		}
+		batch_store<Stream>::fence();
+		return i;
+	}
+
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER void batch_transpose(float const* In, float* Out, std::size_t Count)
+	{
+		// A 4x4 transpose has no cross-lane shuffle pattern worth it on AVX, the SSE one is used and stores are never streamed
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm_vec4 const m[4] = {
+				_mm_loadu_ps(In + i * 16 + 0), _mm_loadu_ps(In + i * 16 + 4),
+				_mm_loadu_ps(In + i * 16 + 8), _mm_loadu_ps(In + i * 16 + 12)};
+			glm_vec4 r[4];
+			glm_mat4_transpose(m, r);
+			for(length_t j = 0; j < 4; ++j)
+				_mm_storeu_ps(Out + i * 16 + j * 4, r[j]);
+		}
+	}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+	// The vec3 kernels need tightly packed vec3, which GLM_FORCE_DEFAULT_ALIGNED_GENTYPES pads to 16 bytes
+	template<>
+	struct compute_batch<true>
+	{
+		GLM_FUNC_QUALIFIER static void transform(mat4 const& m, vec4 const* In, vec4* Out, std::size_t Count)
+		{
+			float const* const Src = reinterpret_cast<float const*>(In);
+			float* const Dst = reinterpret_cast<float*>(Out);
+			std::size_t const Done = batch_stream(Out, Count * sizeof(vec4))
+				? batch_transform_vec4<true>(m, Src, Dst, Count)
+				: batch_transform_vec4<false>(m, Src, Dst, Count);
+			compute_batch<false>::transform(m, In + Done, Out + Done, Count - Done);
+		}
+
+		GLM_FUNC_QUALIFIER static void transform(mat4 const& m, vec3 const* In, vec3* Out, std::size_t Count)
+		{
+			if(sizeof(vec3) != 3 * sizeof(float))
+				return compute_batch<false>::transform(m, In, Out, Count);
+
+			float const* const Src = reinterpret_cast<float const*>(In);
+			float* const Dst = reinterpret_cast<float*>(Out);
+			std::size_t const Done = batch_stream(Out, Count * sizeof(vec3))
+				? batch_transform_vec3<true>(m, Src, Dst, Count)
+				: batch_transform_vec3<false>(m, Src, Dst, Count);
+			compute_batch<false>::transform(m, In + Done, Out + Done, Count - Done);
+		}
+
+		GLM_FUNC_QUALIFIER static void transform(mat4 const& m, vec2 const* In, vec2* Out, std::size_t Count)
+		{
+			// The z column is multiplied by zero, like mat4 * vec4(v, 0, 1) does
+			vec2 const c2 = vec2(m[2] * 0.0f + m[3]);
+			float const* const Src = reinterpret_cast<float const*>(In);
+			float* const Dst = reinterpret_cast<float*>(Out);
+			std::size_t const Done = batch_stream(Out, Count * sizeof(vec2))
+				? batch_transform_vec2<true>(vec2(m[0]), vec2(m[1]), c2, Src, Dst, Count)
+				: batch_transform_vec2<false>(vec2(m[0]), vec2(m[1]), c2, Src, Dst, Count);
+			compute_batch<false>::transform(m, In + Done, Out + Done, Count - Done);
+		}
+
+		GLM_FUNC_QUALIFIER static void transform(mat3x2 const& m, vec2 const* In, vec2* Out, std::size_t Count)
+		{
+			float const* const Src = reinterpret_cast<float const*>(In);
+			float* const Dst = reinterpret_cast<float*>(Out);
+			std::size_t const Done = batch_stream(Out, Count * sizeof(vec2))
+				? batch_transform_vec2<true>(m[0], m[1], m[2], Src, Dst, Count)
+				: batch_transform_vec2<false>(m[0], m[1], m[2], Src, Dst, Count);
+			compute_batch<false>::transform(m, In + Done, Out + Done, Count - Done);
+		}
+
+		GLM_FUNC_QUALIFIER static void multiply(mat4 const* a, mat4 const* b, mat4* Out, std::size_t Count)
+		{
+			float const* const A = reinterpret_cast<float const*>(a);
+			float const* const B = reinterpret_cast<float const*>(b);
+			float* const Dst = reinterpret_cast<float*>(Out);
+			if(batch_stream(Out, Count * sizeof(mat4)))
+				batch_multiply<true>(A, 16, B, Dst, Count);
+			else
+				batch_multiply<false>(A, 16, B, Dst, Count);
+		}
+
+		GLM_FUNC_QUALIFIER static void multiply(mat4 const& a, mat4 const* b, mat4* Out, std::size_t Count)
+		{
+			// Out may be b, never a: keep a copy of the shared matrix
+			mat4 const Shared(a);
+			float const* const A = reinterpret_cast<float const*>(&Shared);
+			float const* const B = reinterpret_cast<float const*>(b);
+			float* const Dst = reinterpret_cast<float*>(Out);
+			if(batch_stream(Out, Count * sizeof(mat4)))
+				batch_multiply<true>(A, 0, B, Dst, Count);
+			else
+				batch_multiply<false>(A, 0, B, Dst, Count);
+		}
+
+		GLM_FUNC_QUALIFIER static void transpose(mat4 const* In, mat4* Out, std::size_t Count)
+		{
+			float const* const Src = reinterpret_cast<float const*>(In);
+			float* const Dst = reinterpret_cast<float*>(Out);
+			if(batch_stream(Out, Count * sizeof(mat4)))
+				batch_transpose<true>(Src, Dst, Count);
+			else
+				batch_transpose<false>(Src, Dst, Count);
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(vec2 const* In, vec2* Out, std::size_t Count)
+		{
+			float const* const Src = reinterpret_cast<float const*>(In);
+			float* const Dst = reinterpret_cast<float*>(Out);
+			std::size_t const Done = batch_stream(Out, Count * sizeof(vec2))
+				? batch_normalize_vec2<true>(Src, Dst, Count)
+				: batch_normalize_vec2<false>(Src, Dst, Count);
+			compute_batch<false>::normalize(In + Done, Out + Done, Count - Done);
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(vec3 const* In, vec3* Out, std::size_t Count)
+		{
+			if(sizeof(vec3) != 3 * sizeof(float))
+				return compute_batch<false>::normalize(In, Out, Count);
+
+			float const* const Src = reinterpret_cast<float const*>(In);
+			float* const Dst = reinterpret_cast<float*>(Out);
+			std::size_t const Done = batch_stream(Out, Count * sizeof(vec3))
+				? batch_normalize_vec3<true>(Src, Dst, Count)
+				: batch_normalize_vec3<false>(Src, Dst, Count);
+			compute_batch<false>::normalize(In + Done, Out + Done, Count - Done);
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(vec4 const* In, vec4* Out, std::size_t Count)
+		{
+			// With aligned default types, glm::normalize(vec4) is the approximate
+			// reciprocal square root of glm_vec4_normalize, which the exact kernel
+			// below would not match: the per-element loop calls it instead
+			if(is_aligned<defaultp>::value)
+				return compute_batch<false>::normalize(In, Out, Count);
+
+			float const* const Src = reinterpret_cast<float const*>(In);
+			float* const Dst = reinterpret_cast<float*>(Out);
+			std::size_t const Done = batch_stream(Out, Count * sizeof(vec4))
+				? batch_normalize_vec4<true>(Src, Dst, Count)
+				: batch_normalize_vec4<false>(Src, Dst, Count);
+			compute_batch<false>::normalize(In + Done, Out + Done, Count - Done);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
@@ -44,6 +44,21 @@ namespace glm
 		vec<3, T, Q> const& scale, qua<T, Q> const& orientation, vec<3, T, Q> const& translation,
 		vec<3, T, Q> const& skew, vec<4, T, Q> const& perspective);
 
+	/// Builds translate(translation) * mat4_cast(orientation) * scale(scale) without the two matrix products.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> composeTRS(
+		vec<3, T, Q> const& translation, qua<T, Q> const& orientation, vec<3, T, Q> const& scale);
+
+	/// Decomposes a model matrix made of a translation, a rotation and a scale, without skew or perspective,
+	/// such as the result of composeTRS. Cheaper than decompose, which handles any matrix.
+	/// Returns false when an axis has a zero scale.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL bool decomposeTRS(
+		mat<4, 4, T, Q> const& modelMatrix,
+		vec<3, T, Q> & translation, qua<T, Q> & orientation, vec<3, T, Q> & scale);
+
 	/// @}
 }//namespace glm
 
@@ -23,7 +23,31 @@ namespace detail
 	{
 		return v * desiredLength / length(v);
 	}
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_compose_trs
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, T, Q> call(vec<3, T, Q> const& t, qua<T, Q> const& q, vec<3, T, Q> const& s)
+		{
+			mat<3, 3, T, Q> const Rotation(mat3_cast(q));
+
+			mat<4, 4, T, Q> Result;
+			Result[0] = vec<4, T, Q>(Rotation[0] * s[0], static_cast<T>(0));
+			Result[1] = vec<4, T, Q>(Rotation[1] * s[1], static_cast<T>(0));
+			Result[2] = vec<4, T, Q>(Rotation[2] * s[2], static_cast<T>(0));
+			Result[3] = vec<4, T, Q>(t, static_cast<T>(1));
+			return Result;
+		}
+	};
 }//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_decompose_simd.inl"
+#endif
+
+namespace glm
+{
 
 	// Matrix decompose
 	// http://www.opensource.apple.com/source/WebCore/WebCore-514/platform/graphics/transforms/TransformationMatrix.cpp
@@ -231,4 +255,32 @@ namespace detail
 
 		return m;
 	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> composeTRS(vec<3, T, Q> const& translation, qua<T, Q> const& orientation, vec<3, T, Q> const& scale)
+	{
+		return detail::compute_compose_trs<T, Q, detail::is_aligned<Q>::value>::call(translation, orientation, scale);
+	}
+
+	// The columns of the upper 3x3 block are the rotated axes scaled: their lengths
+	// give the scale, and a negative determinant a mirror, put on every axis as
+	// decompose does.
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool decomposeTRS(mat<4, 4, T, Q> const& ModelMatrix, vec<3, T, Q> & Translation, qua<T, Q> & Orientation, vec<3, T, Q> & Scale)
+	{
+		vec<3, T, Q> const Axis0(ModelMatrix[0]);
+		vec<3, T, Q> const Axis1(ModelMatrix[1]);
+		vec<3, T, Q> const Axis2(ModelMatrix[2]);
+
+		Scale = vec<3, T, Q>(length(Axis0), length(Axis1), length(Axis2));
+		if(Scale.x <= static_cast<T>(0) || Scale.y <= static_cast<T>(0) || Scale.z <= static_cast<T>(0))
+			return false;
+
+		if(dot(Axis0, cross(Axis1, Axis2)) < static_cast<T>(0))
+			Scale = -Scale;
+
+		Translation = vec<3, T, Q>(ModelMatrix[3]);
+		Orientation = quat_cast(mat<3, 3, T, Q>(Axis0 / Scale.x, Axis1 / Scale.y, Axis2 / Scale.z));
+		return true;
+	}
 }//namespace glm
@@ -0,0 +1,29 @@
+/// @ref gtx_matrix_decompose
+
+#include "../simd/quaternion.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_compose_trs<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(vec<3, float, Q> const& t, qua<float, Q> const& q, vec<3, float, Q> const& s)
+		{
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				glm_vec4 const q0 = _mm_shuffle_ps(q.data, q.data, _MM_SHUFFLE(0, 3, 2, 1));
+#			else
+				glm_vec4 const q0 = q.data;
+#			endif
+
+			mat<4, 4, float, Q> Result;
+			glm_mat4_compose_trs(q0, _mm_setr_ps(t.x, t.y, t.z, 0.0f), _mm_setr_ps(s.x, s.y, s.z, 0.0f), &Result[0].data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif
@@ -10,6 +10,7 @@
 /// Include <glm/gtx/matrix_transform_2d.hpp> to use the features of this extension.
 ///
 /// Defines functions that generate common 2d transformation matrices.
+/// Aligned float matrices are updated with SIMD instructions, with the same results as the packed ones.
 
 #pragma once
 
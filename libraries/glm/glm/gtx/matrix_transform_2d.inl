@@ -3,6 +3,44 @@
 
 #include "../trigonometric.hpp"
 
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_transform_2d
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, T, Q> translate(mat<3, 3, T, Q> const& m, vec<2, T, Q> const& v)
+		{
+			mat<3, 3, T, Q> Result(m);
+			Result[2] = m[0] * v[0] + m[1] * v[1] + m[2];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mat<3, 3, T, Q> rotate(mat<3, 3, T, Q> const& m, T c, T s)
+		{
+			mat<3, 3, T, Q> Result;
+			Result[0] = m[0] * c + m[1] * s;
+			Result[1] = m[0] * -s + m[1] * c;
+			Result[2] = m[2];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mat<3, 3, T, Q> scale(mat<3, 3, T, Q> const& m, vec<2, T, Q> const& v)
+		{
+			mat<3, 3, T, Q> Result;
+			Result[0] = m[0] * v[0];
+			Result[1] = m[1] * v[1];
+			Result[2] = m[2];
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_transform_2d_simd.inl"
+#endif
+
 namespace glm
 {
 
@@ -11,9 +49,7 @@ namespace glm
 		mat<3, 3, T, Q> const& m,
 		vec<2, T, Q> const& v)
 	{
-		mat<3, 3, T, Q> Result(m);
-		Result[2] = m[0] * v[0] + m[1] * v[1] + m[2];
-		return Result;
+		return detail::compute_transform_2d<T, Q, detail::is_aligned<Q>::value>::translate(m, v);
 	}
 
 
@@ -26,11 +62,7 @@ namespace glm
 		T const c = cos(a);
 		T const s = sin(a);
 
-		mat<3, 3, T, Q> Result;
-		Result[0] = m[0] * c + m[1] * s;
-		Result[1] = m[0] * -s + m[1] * c;
-		Result[2] = m[2];
-		return Result;
+		return detail::compute_transform_2d<T, Q, detail::is_aligned<Q>::value>::rotate(m, c, s);
 	}
 
 	template<typename T, qualifier Q>
@@ -38,11 +70,7 @@ namespace glm
 		mat<3, 3, T, Q> const& m,
 		vec<2, T, Q> const& v)
 	{
-		mat<3, 3, T, Q> Result;
-		Result[0] = m[0] * v[0];
-		Result[1] = m[1] * v[1];
-		Result[2] = m[2];
-		return Result;
+		return detail::compute_transform_2d<T, Q, detail::is_aligned<Q>::value>::scale(m, v);
 	}
 
 	template<typename T, qualifier Q>
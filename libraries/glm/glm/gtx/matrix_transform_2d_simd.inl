@@ -0,0 +1,55 @@
+/// @ref gtx_matrix_transform_2d
+
+#include "../simd/matrix.h"
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+namespace glm{
+namespace detail
+{
+	// Aligned vec3 are padded to 16 bytes, so each column is one register
+	template<qualifier Q>
+	struct compute_transform_2d<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> translate(mat<3, 3, float, Q> const& m, vec<2, float, Q> const& v)
+		{
+			glm_vec4 const m0 = glm_vec3_load(&m[0][0]);
+			glm_vec4 const m1 = glm_vec3_load(&m[1][0]);
+			glm_vec4 const m2 = glm_vec3_load(&m[2][0]);
+			glm_vec4 const Mul0 = _mm_mul_ps(m0, _mm_set1_ps(v[0]));
+			glm_vec4 const Mul1 = _mm_mul_ps(m1, _mm_set1_ps(v[1]));
+
+			mat<3, 3, float, Q> Result;
+			_mm_store_ps(&Result[0][0], m0);
+			_mm_store_ps(&Result[1][0], m1);
+			_mm_store_ps(&Result[2][0], _mm_add_ps(_mm_add_ps(Mul0, Mul1), m2));
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> rotate(mat<3, 3, float, Q> const& m, float c, float s)
+		{
+			glm_vec4 const m0 = glm_vec3_load(&m[0][0]);
+			glm_vec4 const m1 = glm_vec3_load(&m[1][0]);
+			glm_vec4 const Cos = _mm_set1_ps(c);
+			glm_vec4 const Sin = _mm_set1_ps(s);
+
+			mat<3, 3, float, Q> Result;
+			_mm_store_ps(&Result[0][0], _mm_add_ps(_mm_mul_ps(m0, Cos), _mm_mul_ps(m1, Sin)));
+			_mm_store_ps(&Result[1][0], _mm_add_ps(_mm_mul_ps(m0, _mm_xor_ps(Sin, _mm_set1_ps(-0.0f))), _mm_mul_ps(m1, Cos)));
+			_mm_store_ps(&Result[2][0], glm_vec3_load(&m[2][0]));
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> scale(mat<3, 3, float, Q> const& m, vec<2, float, Q> const& v)
+		{
+			mat<3, 3, float, Q> Result;
+			_mm_store_ps(&Result[0][0], _mm_mul_ps(glm_vec3_load(&m[0][0]), _mm_set1_ps(v[0])));
+			_mm_store_ps(&Result[1][0], _mm_mul_ps(glm_vec3_load(&m[1][0]), _mm_set1_ps(v[1])));
+			_mm_store_ps(&Result[2][0], glm_vec3_load(&m[2][0]));
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif
@@ -0,0 +1,196 @@
+/// @ref simd
+/// @file glm/simd/batch.h
+
+#pragma once
+
+#include "platform.h"
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Array kernels working on 8 elements at once. The shuffles stay within 128-bit
+// lanes, so the SoA registers hold the elements in a permuted but consistent
+// order: interleaving reverses the permutation.
+
+// Three contiguous registers of 8 packed vec3 to x, y and z
+GLM_FUNC_QUALIFIER void glm_vec3x8_load(float const* p, __m256* x, __m256* y, __m256* z)
+{
+	__m256 const ld0 = _mm256_loadu_ps(p + 0);
+	__m256 const ld1 = _mm256_loadu_ps(p + 8);
+	__m256 const ld2 = _mm256_loadu_ps(p + 16);
+
+	// Each lane now holds four vec3: x0 y0 z0 x1, y1 z1 x2 y2, z2 x3 y3 z3
+	__m256 const a = _mm256_permute2f128_ps(ld0, ld1, 0x30);
+	__m256 const b = _mm256_permute2f128_ps(ld0, ld2, 0x21);
+	__m256 const c = _mm256_permute2f128_ps(ld1, ld2, 0x30);
+
+	__m256 const t0 = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+	__m256 const t1 = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+	__m256 const t2 = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+	__m256 const t3 = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+	__m256 const t4 = _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));
+
+	*x = _mm256_shuffle_ps(a, t0, _MM_SHUFFLE(2, 0, 3, 0));
+	*y = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0));
+	*z = _mm256_shuffle_ps(t3, t4, _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+// x, y and z back to three contiguous registers of 8 packed vec3
+GLM_FUNC_QUALIFIER void glm_vec3x8_interleave(__m256 x, __m256 y, __m256 z, __m256 Out[3])
+{
+	__m256 const xy0 = _mm256_unpacklo_ps(x, y);
+	__m256 const xy1 = _mm256_unpackhi_ps(x, y);
+
+	__m256 const t0 = _mm256_shuffle_ps(z, xy0, _MM_SHUFFLE(2, 2, 0, 0));
+	__m256 const t1 = _mm256_shuffle_ps(xy0, z, _MM_SHUFFLE(1, 1, 3, 3));
+	__m256 const t2 = _mm256_shuffle_ps(z, xy1, _MM_SHUFFLE(2, 2, 2, 2));
+	__m256 const t3 = _mm256_shuffle_ps(xy1, z, _MM_SHUFFLE(3, 3, 3, 3));
+
+	__m256 const a = _mm256_shuffle_ps(xy0, t0, _MM_SHUFFLE(2, 0, 1, 0));
+	__m256 const b = _mm256_shuffle_ps(t1, xy1, _MM_SHUFFLE(1, 0, 2, 0));
+	__m256 const c = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(2, 0, 2, 0));
+
+	Out[0] = _mm256_permute2f128_ps(a, b, 0x20);
+	Out[1] = _mm256_permute2f128_ps(c, a, 0x30);
+	Out[2] = _mm256_permute2f128_ps(b, c, 0x31);
+}
+
+// Two contiguous registers of 8 packed vec2 to x and y
+GLM_FUNC_QUALIFIER void glm_vec2x8_load(float const* p, __m256* x, __m256* y)
+{
+	__m256 const ld0 = _mm256_loadu_ps(p + 0);
+	__m256 const ld1 = _mm256_loadu_ps(p + 8);
+
+	*x = _mm256_shuffle_ps(ld0, ld1, _MM_SHUFFLE(2, 0, 2, 0));
+	*y = _mm256_shuffle_ps(ld0, ld1, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+GLM_FUNC_QUALIFIER void glm_vec2x8_interleave(__m256 x, __m256 y, __m256 Out[2])
+{
+	Out[0] = _mm256_unpacklo_ps(x, y);
+	Out[1] = _mm256_unpackhi_ps(x, y);
+}
+
+// Two vec4, one per lane, by a mat4 whose columns are repeated in both lanes
+GLM_FUNC_QUALIFIER __m256 glm_mat4x2_mul_vec4(__m256 const m[4], __m256 v)
+{
+	__m256 const mul0 = _mm256_mul_ps(m[0], _mm256_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m256 const mul1 = _mm256_mul_ps(m[1], _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+	__m256 const mul2 = _mm256_mul_ps(m[2], _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)));
+	__m256 const mul3 = _mm256_mul_ps(m[3], _mm256_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)));
+	return _mm256_add_ps(_mm256_add_ps(mul0, mul1), _mm256_add_ps(mul2, mul3));
+}
+
+// Two columns of a mat4 product, one per lane; m columns are repeated in both lanes
+GLM_FUNC_QUALIFIER __m256 glm_mat4x2_mul_cols(__m256 const m[4], __m256 c)
+{
+	__m256 const mul0 = _mm256_mul_ps(m[0], _mm256_shuffle_ps(c, c, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m256 const mul1 = _mm256_mul_ps(m[1], _mm256_shuffle_ps(c, c, _MM_SHUFFLE(1, 1, 1, 1)));
+	__m256 const mul2 = _mm256_mul_ps(m[2], _mm256_shuffle_ps(c, c, _MM_SHUFFLE(2, 2, 2, 2)));
+	__m256 const mul3 = _mm256_mul_ps(m[3], _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3)));
+	return _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(mul0, mul1), mul2), mul3);
+}
+
+// Two vec4, one per lane, normalized
+GLM_FUNC_QUALIFIER __m256 glm_vec4x2_normalize(__m256 v)
+{
+	__m256 const mul0 = _mm256_mul_ps(v, v);
+	__m256 const add0 = _mm256_add_ps(mul0, _mm256_shuffle_ps(mul0, mul0, _MM_SHUFFLE(2, 3, 0, 1)));
+	__m256 const add1 = _mm256_add_ps(add0, _mm256_shuffle_ps(add0, add0, _MM_SHUFFLE(1, 0, 3, 2)));
+	return _mm256_mul_ps(v, _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(add1)));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+// The 512-bit kernels use two-source permutes, so unlike the AVX ones the SoA
+// registers hold the elements in order.
+
+// Mask of the first Count floats of a register
+GLM_FUNC_QUALIFIER __mmask16 glm_mask16(unsigned int Count)
+{
+	return static_cast<__mmask16>(Count >= 16 ? 0xFFFF : (1u << Count) - 1u);
+}
+
+// Three contiguous registers of 16 packed vec3 to x, y and z
+GLM_FUNC_QUALIFIER void glm_vec3x16_deinterleave(__m512 a, __m512 b, __m512 c, __m512* x, __m512* y, __m512* z)
+{
+	__m512 const x0 = _mm512_permutex2var_ps(a, _mm512_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0), b);
+	__m512 const y0 = _mm512_permutex2var_ps(a, _mm512_setr_epi32(1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0), b);
+	__m512 const z0 = _mm512_permutex2var_ps(a, _mm512_setr_epi32(2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0), b);
+
+	*x = _mm512_permutex2var_ps(x0, _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29), c);
+	*y = _mm512_permutex2var_ps(y0, _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30), c);
+	*z = _mm512_permutex2var_ps(z0, _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31), c);
+}
+
+// x, y and z back to three contiguous registers of 16 packed vec3
+GLM_FUNC_QUALIFIER void glm_vec3x16_interleave(__m512 x, __m512 y, __m512 z, __m512 Out[3])
+{
+	__m512 const a = _mm512_permutex2var_ps(x, _mm512_setr_epi32(0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5), y);
+	__m512 const b = _mm512_permutex2var_ps(x, _mm512_setr_epi32(21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26), y);
+	__m512 const c = _mm512_permutex2var_ps(x, _mm512_setr_epi32(0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0), y);
+
+	Out[0] = _mm512_permutex2var_ps(a, _mm512_setr_epi32(0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15), z);
+	Out[1] = _mm512_permutex2var_ps(b, _mm512_setr_epi32(0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15), z);
+	Out[2] = _mm512_permutex2var_ps(c, _mm512_setr_epi32(26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31), z);
+}
+
+// Two contiguous registers of 16 packed vec2 to x and y
+GLM_FUNC_QUALIFIER void glm_vec2x16_deinterleave(__m512 a, __m512 b, __m512* x, __m512* y)
+{
+	*x = _mm512_permutex2var_ps(a, _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30), b);
+	*y = _mm512_permutex2var_ps(a, _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31), b);
+}
+
+GLM_FUNC_QUALIFIER void glm_vec2x16_interleave(__m512 x, __m512 y, __m512 Out[2])
+{
+	Out[0] = _mm512_permutex2var_ps(x, _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23), y);
+	Out[1] = _mm512_permutex2var_ps(x, _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31), y);
+}
+
+// Four vec4, one per lane, by a mat4 whose columns are repeated in all lanes
+GLM_FUNC_QUALIFIER __m512 glm_mat4x4_mul_vec4(__m512 const m[4], __m512 v)
+{
+	__m512 const mul0 = _mm512_mul_ps(m[0], _mm512_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m512 const mul1 = _mm512_mul_ps(m[1], _mm512_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)));
+	__m512 const mul2 = _mm512_mul_ps(m[2], _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)));
+	__m512 const mul3 = _mm512_mul_ps(m[3], _mm512_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)));
+	return _mm512_add_ps(_mm512_add_ps(mul0, mul1), _mm512_add_ps(mul2, mul3));
+}
+
+// The four columns of a mat4 product, one per lane; m columns are repeated in all lanes
+GLM_FUNC_QUALIFIER __m512 glm_mat4x4_mul_cols(__m512 const m[4], __m512 c)
+{
+	__m512 const mul0 = _mm512_mul_ps(m[0], _mm512_permute_ps(c, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m512 const mul1 = _mm512_mul_ps(m[1], _mm512_permute_ps(c, _MM_SHUFFLE(1, 1, 1, 1)));
+	__m512 const mul2 = _mm512_mul_ps(m[2], _mm512_permute_ps(c, _MM_SHUFFLE(2, 2, 2, 2)));
+	__m512 const mul3 = _mm512_mul_ps(m[3], _mm512_permute_ps(c, _MM_SHUFFLE(3, 3, 3, 3)));
+	return _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(mul0, mul1), mul2), mul3);
+}
+
+// A whole mat4, one column per lane, to its four columns each repeated in all lanes
+GLM_FUNC_QUALIFIER void glm_mat4x4_broadcast_cols(__m512 m, __m512 Out[4])
+{
+	Out[0] = _mm512_shuffle_f32x4(m, m, _MM_SHUFFLE(0, 0, 0, 0));
+	Out[1] = _mm512_shuffle_f32x4(m, m, _MM_SHUFFLE(1, 1, 1, 1));
+	Out[2] = _mm512_shuffle_f32x4(m, m, _MM_SHUFFLE(2, 2, 2, 2));
+	Out[3] = _mm512_shuffle_f32x4(m, m, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+// A whole mat4 in one register, transposed with a single permute
+GLM_FUNC_QUALIFIER __m512 glm_mat4x4_transpose(__m512 m)
+{
+	return _mm512_permutexvar_ps(_mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15), m);
+}
+
+// Four vec4, one per lane, normalized
+GLM_FUNC_QUALIFIER __m512 glm_vec4x4_normalize(__m512 v)
+{
+	__m512 const mul0 = _mm512_mul_ps(v, v);
+	__m512 const add0 = _mm512_add_ps(mul0, _mm512_permute_ps(mul0, _MM_SHUFFLE(2, 3, 0, 1)));
+	__m512 const add1 = _mm512_add_ps(add0, _mm512_permute_ps(add0, _MM_SHUFFLE(1, 0, 3, 2)));
+	return _mm512_mul_ps(v, _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_sqrt_ps(add1)));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
@@ -1025,4 +1025,342 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+
+// 3x3 and 2D affine kernels. A column of three floats sits in the first lanes of
+// a register and the last lane is ignored; a 3x2 matrix keeps its first two
+// columns in one register. They add and multiply in the same order as the
+// scalar code.
+
+// Loads an aligned vec3 with its padding lane cleared: whatever the padding holds,
+// NaN or denormal, must not slow the arithmetic down
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec3_load(float const* p)
+{
+	return _mm_and_ps(_mm_load_ps(p), _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3_mul_vec3(glm_vec4 const m[3], glm_vec4 v)
+{
+	glm_vec4 const mul0 = _mm_mul_ps(m[0], _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+	glm_vec4 const mul1 = _mm_mul_ps(m[1], _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+	glm_vec4 const mul2 = _mm_mul_ps(m[2], _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)));
+	return _mm_add_ps(_mm_add_ps(mul0, mul1), mul2);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat3_mul(glm_vec4 const in1[3], glm_vec4 const in2[3], glm_vec4 out[3])
+{
+	out[0] = glm_mat3_mul_vec3(in1, in2[0]);
+	out[1] = glm_mat3_mul_vec3(in1, in2[1]);
+	out[2] = glm_mat3_mul_vec3(in1, in2[2]);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat3_transpose(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	glm_vec4 const lo = _mm_unpacklo_ps(in[0], in[1]);
+	glm_vec4 const hi = _mm_unpackhi_ps(in[0], in[1]);
+
+	out[0] = _mm_shuffle_ps(lo, in[2], _MM_SHUFFLE(0, 0, 1, 0));
+	out[1] = _mm_shuffle_ps(lo, in[2], _MM_SHUFFLE(1, 1, 3, 2));
+	out[2] = _mm_shuffle_ps(hi, in[2], _MM_SHUFFLE(2, 2, 1, 0));
+}
+
+// Cofactors of the first column, without their signs:
+// (m[1][1] * m[2][2] - m[2][1] * m[1][2], m[0][1] * m[2][2] - m[2][1] * m[0][2], m[0][1] * m[1][2] - m[1][1] * m[0][2])
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3_cofactor0(glm_vec4 const in[3])
+{
+	glm_vec4 const Swp1 = _mm_shuffle_ps(in[1], in[0], _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const Swp2 = _mm_shuffle_ps(in[1], in[0], _MM_SHUFFLE(2, 2, 2, 2));
+	glm_vec4 const P1 = _mm_shuffle_ps(Swp1, Swp1, _MM_SHUFFLE(2, 2, 2, 0));
+	glm_vec4 const P2 = _mm_shuffle_ps(Swp2, Swp2, _MM_SHUFFLE(2, 2, 2, 0));
+	glm_vec4 const Q1 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const Q2 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(2, 2, 2, 2));
+	return _mm_sub_ps(_mm_mul_ps(P1, Q2), _mm_mul_ps(Q1, P2));
+}
+
+// m[0][0] * Cof0[0] - m[1][0] * Cof0[1] + m[2][0] * Cof0[2] in the first lane
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3_determinant_from_cofactor0(glm_vec4 const in[3], glm_vec4 Cof0)
+{
+	glm_vec4 const Row0 = _mm_shuffle_ps(_mm_unpacklo_ps(in[0], in[1]), in[2], _MM_SHUFFLE(0, 0, 1, 0));
+	glm_vec4 const Dot = _mm_mul_ps(Row0, Cof0);
+	return _mm_add_ss(_mm_sub_ss(Dot, _mm_shuffle_ps(Dot, Dot, _MM_SHUFFLE(1, 1, 1, 1))), _mm_movehl_ps(Dot, Dot));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3_determinant(glm_vec4 const in[3])
+{
+	return glm_mat3_determinant_from_cofactor0(in, glm_mat3_cofactor0(in));
+}
+
+GLM_FUNC_QUALIFIER void glm_mat3_inverse(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	// P[i] = (m[1][i], m[0][i], m[0][i]) and Q[i] = (m[2][i], m[2][i], m[1][i]) give every cofactor as P * Q - Q * P
+	glm_vec4 const Swp0 = _mm_shuffle_ps(in[1], in[0], _MM_SHUFFLE(0, 0, 0, 0));
+	glm_vec4 const Swp1 = _mm_shuffle_ps(in[1], in[0], _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const Swp2 = _mm_shuffle_ps(in[1], in[0], _MM_SHUFFLE(2, 2, 2, 2));
+	glm_vec4 const P0 = _mm_shuffle_ps(Swp0, Swp0, _MM_SHUFFLE(2, 2, 2, 0));
+	glm_vec4 const P1 = _mm_shuffle_ps(Swp1, Swp1, _MM_SHUFFLE(2, 2, 2, 0));
+	glm_vec4 const P2 = _mm_shuffle_ps(Swp2, Swp2, _MM_SHUFFLE(2, 2, 2, 0));
+	glm_vec4 const Q0 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(0, 0, 0, 0));
+	glm_vec4 const Q1 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const Q2 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(2, 2, 2, 2));
+
+	glm_vec4 const Cof0 = _mm_sub_ps(_mm_mul_ps(P1, Q2), _mm_mul_ps(Q1, P2));
+	glm_vec4 const Cof1 = _mm_sub_ps(_mm_mul_ps(P0, Q2), _mm_mul_ps(Q0, P2));
+	glm_vec4 const Cof2 = _mm_sub_ps(_mm_mul_ps(P0, Q1), _mm_mul_ps(Q0, P1));
+
+	glm_vec4 const Det = glm_mat3_determinant_from_cofactor0(in, Cof0);
+	glm_vec4 const Rcp0 = _mm_div_ss(_mm_set_ss(1.0f), Det);
+	glm_vec4 const Rcp1 = _mm_shuffle_ps(Rcp0, Rcp0, _MM_SHUFFLE(0, 0, 0, 0));
+
+	// Negating before or after the product gives the same float
+	glm_vec4 const SignA = _mm_set_ps(0.0f, 0.0f, -0.0f, 0.0f);
+	glm_vec4 const SignB = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+	out[0] = _mm_xor_ps(_mm_mul_ps(Cof0, Rcp1), SignA);
+	out[1] = _mm_xor_ps(_mm_mul_ps(Cof1, Rcp1), SignB);
+	out[2] = _mm_xor_ps(_mm_mul_ps(Cof2, Rcp1), SignA);
+}
+
+// Inverse of a 2D affine transform, whose last row is (0, 0, 1): a 2x2 inverse and a translation
+GLM_FUNC_QUALIFIER void glm_mat3_affine_inverse(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	glm_vec4 const Lin = _mm_movelh_ps(in[0], in[1]);
+	glm_vec4 const Cross = _mm_mul_ps(Lin, _mm_shuffle_ps(Lin, Lin, _MM_SHUFFLE(0, 1, 2, 3)));
+	glm_vec4 const Det = _mm_sub_ss(Cross, _mm_movehl_ps(Cross, Cross));
+	glm_vec4 const Rcp0 = _mm_div_ss(_mm_set_ss(1.0f), Det);
+	glm_vec4 const Rcp1 = _mm_shuffle_ps(Rcp0, Rcp0, _MM_SHUFFLE(0, 0, 0, 0));
+
+	// (m[1][1], -m[0][1], -m[1][0], m[0][0]) / Det
+	glm_vec4 const Adj = _mm_xor_ps(_mm_shuffle_ps(Lin, Lin, _MM_SHUFFLE(0, 2, 1, 3)), _mm_set_ps(0.0f, -0.0f, -0.0f, 0.0f));
+	glm_vec4 const Inv = _mm_mul_ps(Adj, Rcp1);
+
+	// -Inv * m[2]
+	glm_vec4 const Neg = _mm_xor_ps(Inv, _mm_set1_ps(-0.0f));
+	glm_vec4 const Mul = _mm_mul_ps(Neg, _mm_unpacklo_ps(in[2], in[2]));
+	glm_vec4 const Tra = _mm_add_ps(Mul, _mm_movehl_ps(Mul, Mul));
+
+	glm_vec4 const Zero = _mm_setzero_ps();
+	out[0] = _mm_movelh_ps(Inv, Zero);
+	out[1] = _mm_movehl_ps(Zero, Inv);
+	out[2] = _mm_movelh_ps(Tra, _mm_set_ss(1.0f));
+}
+
+// mat3x2 * vec3 in the first two lanes; c01 holds the first two columns
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3x2_mul_vec3(glm_vec4 c01, glm_vec4 c2, glm_vec4 v)
+{
+	glm_vec4 const mul0 = _mm_mul_ps(c01, _mm_unpacklo_ps(v, v));
+	glm_vec4 const add0 = _mm_add_ps(mul0, _mm_movehl_ps(mul0, mul0));
+	return _mm_add_ps(add0, _mm_mul_ps(c2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+}
+
+// Two columns of mat3x2 * mat3, from two columns a and b of the mat3
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3x2_mul_cols(glm_vec4 c01, glm_vec4 c2, glm_vec4 a, glm_vec4 b)
+{
+	glm_vec4 const lo = _mm_unpacklo_ps(a, b);
+	glm_vec4 const hi = _mm_unpackhi_ps(a, b);
+
+	glm_vec4 const mul0 = _mm_mul_ps(_mm_movelh_ps(c01, c01), _mm_shuffle_ps(lo, lo, _MM_SHUFFLE(1, 1, 0, 0)));
+	glm_vec4 const mul1 = _mm_mul_ps(_mm_movehl_ps(c01, c01), _mm_shuffle_ps(lo, lo, _MM_SHUFFLE(3, 3, 2, 2)));
+	glm_vec4 const mul2 = _mm_mul_ps(_mm_movelh_ps(c2, c2), _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(1, 1, 0, 0)));
+	return _mm_add_ps(_mm_add_ps(mul0, mul1), mul2);
+}
+
+// mat2x3 * vec2
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat2x3_mul_vec2(glm_vec4 const m[2], glm_vec4 v)
+{
+	glm_vec4 const mul0 = _mm_mul_ps(m[0], _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+	glm_vec4 const mul1 = _mm_mul_ps(m[1], _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+	return _mm_add_ps(mul0, mul1);
+}
+
+// The two rows of a mat3x2 as the columns of a mat2x3
+GLM_FUNC_QUALIFIER void glm_mat3x2_transpose(glm_vec4 c01, glm_vec4 c2, glm_vec4 out[2])
+{
+	out[0] = _mm_shuffle_ps(c01, c2, _MM_SHUFFLE(0, 0, 2, 0));
+	out[1] = _mm_shuffle_ps(c01, c2, _MM_SHUFFLE(1, 1, 3, 1));
+}
+
+// The three rows of a mat2x3 as the columns of a mat3x2: the first two in one register, the last one alone
+GLM_FUNC_QUALIFIER void glm_mat2x3_transpose(glm_vec4 const in[2], glm_vec4* c01, glm_vec4* c2)
+{
+	*c01 = _mm_unpacklo_ps(in[0], in[1]);
+	*c2 = _mm_unpackhi_ps(in[0], in[1]);
+}
+
+// Inverse of a 3D affine transform, whose last row is (0, 0, 0, 1): a 3x3 inverse and a translation
+GLM_FUNC_QUALIFIER void glm_mat4_affine_inverse(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	glm_vec4 const Mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+	glm_vec4 Inv[3];
+	glm_mat3_inverse(in, Inv);
+	out[0] = _mm_and_ps(Inv[0], Mask);
+	out[1] = _mm_and_ps(Inv[1], Mask);
+	out[2] = _mm_and_ps(Inv[2], Mask);
+
+	// -Inv * m[3]
+	glm_vec4 const Sign = _mm_set1_ps(-0.0f);
+	glm_vec4 const Neg[3] = {_mm_xor_ps(out[0], Sign), _mm_xor_ps(out[1], Sign), _mm_xor_ps(out[2], Sign)};
+	glm_vec4 const Tra = glm_mat3_mul_vec3(Neg, in[3]);
+	out[3] = _mm_or_ps(_mm_and_ps(Tra, Mask), _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Double precision kernels. Each one adds and multiplies in the same order as
+// the scalar code, so without FMA contraction the results are the same.
+
+// (v.z, v.z, v.y, v.y)
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_swizzle_zzyy(glm_dvec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(v, _MM_SHUFFLE(1, 1, 2, 2));
+#	else
+		__m256d const Swap = _mm256_permute2f128_pd(v, v, 0x01);
+		return _mm256_permute_pd(Swap, 0xC);
+#	endif
+}
+
+// (v.w, v.w, v.w, v.z)
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_swizzle_wwwz(glm_dvec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(v, _MM_SHUFFLE(2, 3, 3, 3));
+#	else
+		__m256d const Swap = _mm256_permute2f128_pd(v, v, 0x01);
+		return _mm256_blend_pd(_mm256_permute_pd(Swap, 0x3), _mm256_permute_pd(v, 0x4), 0xC);
+#	endif
+}
+
+// (v.y, v.x, v.x, v.x)
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_swizzle_yxxx(glm_dvec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(v, _MM_SHUFFLE(0, 0, 0, 1));
+#	else
+		__m256d const Low = _mm256_permute2f128_pd(v, v, 0x00);
+		return _mm256_permute_pd(Low, 0x1);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_mul_dvec4(glm_dvec4 const m[4], glm_dvec4 v)
+{
+	__m256d const Low = _mm256_permute2f128_pd(v, v, 0x00);
+	__m256d const High = _mm256_permute2f128_pd(v, v, 0x11);
+
+	__m256d const Mul0 = _mm256_mul_pd(m[0], _mm256_permute_pd(Low, 0x0));
+	__m256d const Mul1 = _mm256_mul_pd(m[1], _mm256_permute_pd(Low, 0xF));
+	__m256d const Mul2 = _mm256_mul_pd(m[2], _mm256_permute_pd(High, 0x0));
+	__m256d const Mul3 = _mm256_mul_pd(m[3], _mm256_permute_pd(High, 0xF));
+
+	return _mm256_add_pd(_mm256_add_pd(Mul0, Mul1), _mm256_add_pd(Mul2, Mul3));
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_mul(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	for(int i = 0; i < 4; ++i)
+	{
+		double const* Src = reinterpret_cast<double const*>(&in2[i]);
+		__m256d const Mul0 = _mm256_mul_pd(in1[0], _mm256_broadcast_sd(Src + 0));
+		__m256d const Mul1 = _mm256_mul_pd(in1[1], _mm256_broadcast_sd(Src + 1));
+		__m256d const Mul2 = _mm256_mul_pd(in1[2], _mm256_broadcast_sd(Src + 2));
+		__m256d const Mul3 = _mm256_mul_pd(in1[3], _mm256_broadcast_sd(Src + 3));
+		out[i] = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(Mul0, Mul1), Mul2), Mul3);
+	}
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_transpose(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	__m256d const Tmp0 = _mm256_unpacklo_pd(in[0], in[1]);
+	__m256d const Tmp1 = _mm256_unpackhi_pd(in[0], in[1]);
+	__m256d const Tmp2 = _mm256_unpacklo_pd(in[2], in[3]);
+	__m256d const Tmp3 = _mm256_unpackhi_pd(in[2], in[3]);
+
+	out[0] = _mm256_permute2f128_pd(Tmp0, Tmp2, 0x20);
+	out[1] = _mm256_permute2f128_pd(Tmp1, Tmp3, 0x20);
+	out[2] = _mm256_permute2f128_pd(Tmp0, Tmp2, 0x31);
+	out[3] = _mm256_permute2f128_pd(Tmp1, Tmp3, 0x31);
+}
+
+// Returns the determinant in the first component
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_determinant(glm_dvec4 const in[4])
+{
+	// 2x2 sub-determinants of the last two columns, rows (a, b):
+	// SubA: (2, 3), (2, 3), (1, 3), (1, 2)
+	// SubB: (1, 3), (0, 3), (0, 3), (0, 2)
+	// SubC: (1, 2), (0, 2), (0, 1), (0, 1)
+	__m256d const ZZYY2 = glm_dvec4_swizzle_zzyy(in[2]);
+	__m256d const ZZYY3 = glm_dvec4_swizzle_zzyy(in[3]);
+	__m256d const WWWZ2 = glm_dvec4_swizzle_wwwz(in[2]);
+	__m256d const WWWZ3 = glm_dvec4_swizzle_wwwz(in[3]);
+	__m256d const YXXX2 = glm_dvec4_swizzle_yxxx(in[2]);
+	__m256d const YXXX3 = glm_dvec4_swizzle_yxxx(in[3]);
+
+	__m256d const SubA = _mm256_sub_pd(_mm256_mul_pd(ZZYY2, WWWZ3), _mm256_mul_pd(ZZYY3, WWWZ2));
+	__m256d const SubB = _mm256_sub_pd(_mm256_mul_pd(YXXX2, WWWZ3), _mm256_mul_pd(YXXX3, WWWZ2));
+	__m256d const SubC = _mm256_sub_pd(_mm256_mul_pd(YXXX2, ZZYY3), _mm256_mul_pd(YXXX3, ZZYY2));
+
+	__m256d const Cof0 = _mm256_mul_pd(glm_dvec4_swizzle_yxxx(in[1]), SubA);
+	__m256d const Cof1 = _mm256_mul_pd(glm_dvec4_swizzle_zzyy(in[1]), SubB);
+	__m256d const Cof2 = _mm256_mul_pd(glm_dvec4_swizzle_wwwz(in[1]), SubC);
+	__m256d const Cof3 = _mm256_add_pd(_mm256_sub_pd(Cof0, Cof1), Cof2);
+	__m256d const DetCof = _mm256_xor_pd(Cof3, _mm256_set_pd(-0.0, 0.0, -0.0, 0.0));
+
+	// Sum from the first to the last component
+	__m256d const Dot0 = _mm256_mul_pd(in[0], DetCof);
+	__m128d const Low = _mm256_castpd256_pd128(Dot0);
+	__m128d const High = _mm256_extractf128_pd(Dot0, 1);
+	__m128d const Sum0 = _mm_add_sd(Low, _mm_unpackhi_pd(Low, Low));
+	__m128d const Sum1 = _mm_add_sd(Sum0, High);
+	__m128d const Sum2 = _mm_add_sd(Sum1, _mm_unpackhi_pd(High, High));
+	return _mm256_castpd128_pd256(Sum2);
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_inverse(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	// Row[i] holds row i of the matrix: the sub-determinants then come from
+	// the same three swizzles of two rows.
+	__m256d Row[4];
+	glm_dmat4_transpose(in, Row);
+
+	__m256d ZZYY[4], WWWZ[4], YXXX[4];
+	for(int i = 0; i < 4; ++i)
+	{
+		ZZYY[i] = glm_dvec4_swizzle_zzyy(Row[i]);
+		WWWZ[i] = glm_dvec4_swizzle_wwwz(Row[i]);
+		YXXX[i] = glm_dvec4_swizzle_yxxx(Row[i]);
+	}
+
+	// Fac0 to Fac5 of the scalar code, for rows (2, 3), (1, 3), (1, 2), (0, 3), (0, 2) and (0, 1)
+	__m256d const Fac0 = _mm256_sub_pd(_mm256_mul_pd(ZZYY[2], WWWZ[3]), _mm256_mul_pd(WWWZ[2], ZZYY[3]));
+	__m256d const Fac1 = _mm256_sub_pd(_mm256_mul_pd(ZZYY[1], WWWZ[3]), _mm256_mul_pd(WWWZ[1], ZZYY[3]));
+	__m256d const Fac2 = _mm256_sub_pd(_mm256_mul_pd(ZZYY[1], WWWZ[2]), _mm256_mul_pd(WWWZ[1], ZZYY[2]));
+	__m256d const Fac3 = _mm256_sub_pd(_mm256_mul_pd(ZZYY[0], WWWZ[3]), _mm256_mul_pd(WWWZ[0], ZZYY[3]));
+	__m256d const Fac4 = _mm256_sub_pd(_mm256_mul_pd(ZZYY[0], WWWZ[2]), _mm256_mul_pd(WWWZ[0], ZZYY[2]));
+	__m256d const Fac5 = _mm256_sub_pd(_mm256_mul_pd(ZZYY[0], WWWZ[1]), _mm256_mul_pd(WWWZ[0], ZZYY[1]));
+
+	__m256d const Inv0 = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(YXXX[1], Fac0), _mm256_mul_pd(YXXX[2], Fac1)), _mm256_mul_pd(YXXX[3], Fac2));
+	__m256d const Inv1 = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(YXXX[0], Fac0), _mm256_mul_pd(YXXX[2], Fac3)), _mm256_mul_pd(YXXX[3], Fac4));
+	__m256d const Inv2 = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(YXXX[0], Fac1), _mm256_mul_pd(YXXX[1], Fac3)), _mm256_mul_pd(YXXX[3], Fac5));
+	__m256d const Inv3 = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(YXXX[0], Fac2), _mm256_mul_pd(YXXX[1], Fac4)), _mm256_mul_pd(YXXX[2], Fac5));
+
+	__m256d const SignA = _mm256_set_pd(-0.0, 0.0, -0.0, 0.0);
+	__m256d const SignB = _mm256_set_pd(0.0, -0.0, 0.0, -0.0);
+	__m256d const Cof0 = _mm256_xor_pd(Inv0, SignA);
+	__m256d const Cof1 = _mm256_xor_pd(Inv1, SignB);
+	__m256d const Cof2 = _mm256_xor_pd(Inv2, SignA);
+	__m256d const Cof3 = _mm256_xor_pd(Inv3, SignB);
+
+	// First component of each cofactor column, dotted with the first column: (x + y) + (z + w)
+	__m256d const Row0 = _mm256_permute2f128_pd(_mm256_unpacklo_pd(Cof0, Cof1), _mm256_unpacklo_pd(Cof2, Cof3), 0x20);
+	__m256d const Dot0 = _mm256_mul_pd(in[0], Row0);
+	__m256d const Dot1 = _mm256_hadd_pd(Dot0, Dot0);
+	__m128d const Det = _mm_add_sd(_mm256_castpd256_pd128(Dot1), _mm256_extractf128_pd(Dot1, 1));
+
+	__m256d const Rcp = _mm256_set1_pd(1.0 / _mm_cvtsd_f64(Det));
+	out[0] = _mm256_mul_pd(Cof0, Rcp);
+	out[1] = _mm256_mul_pd(Cof1, Rcp);
+	out[2] = _mm256_mul_pd(Cof2, Rcp);
+	out[3] = _mm256_mul_pd(Cof3, Rcp);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
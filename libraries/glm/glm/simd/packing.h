@@ -3,6 +3,147 @@
 
 #pragma once
 
+#include "platform.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// Rounds half away from zero like std::round, valid for |x| < 2^31
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_round_away(glm_vec4 x)
+{
+	glm_ivec4 const trc0 = _mm_cvttps_epi32(x);
+	glm_vec4 const frc0 = _mm_sub_ps(x, _mm_cvtepi32_ps(trc0));
+	// Comparison masks are -1 where true
+	glm_ivec4 const up0 = _mm_castps_si128(_mm_cmpge_ps(frc0, _mm_set1_ps(0.5f)));
+	glm_ivec4 const dn0 = _mm_castps_si128(_mm_cmple_ps(frc0, _mm_set1_ps(-0.5f)));
+	return _mm_add_epi32(_mm_sub_epi32(trc0, up0), dn0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_clamp_norm(glm_vec4 x, float minVal)
+{
+	return _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(minVal)), _mm_set1_ps(1.0f));
+}
+
+GLM_FUNC_QUALIFIER int glm_vec4_pack_unorm4x8(glm_vec4 v)
+{
+	glm_ivec4 const i0 = glm_vec4_round_away(_mm_mul_ps(glm_vec4_clamp_norm(v, 0.0f), _mm_set1_ps(255.0f)));
+	glm_ivec4 const i1 = _mm_packs_epi32(i0, i0);
+	return _mm_cvtsi128_si32(_mm_packus_epi16(i1, i1));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpack_unorm4x8(int p)
+{
+	glm_ivec4 const zero = _mm_setzero_si128();
+	glm_ivec4 const i0 = _mm_unpacklo_epi8(_mm_cvtsi32_si128(p), zero);
+	glm_ivec4 const i1 = _mm_unpacklo_epi16(i0, zero);
+	return _mm_mul_ps(_mm_cvtepi32_ps(i1), _mm_set1_ps(0.0039215686274509803921568627451f));
+}
+
+GLM_FUNC_QUALIFIER int glm_vec4_pack_snorm4x8(glm_vec4 v)
+{
+	glm_ivec4 const i0 = glm_vec4_round_away(_mm_mul_ps(glm_vec4_clamp_norm(v, -1.0f), _mm_set1_ps(127.0f)));
+	glm_ivec4 const i1 = _mm_packs_epi32(i0, i0);
+	return _mm_cvtsi128_si32(_mm_packs_epi16(i1, i1));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpack_snorm4x8(int p)
+{
+	// Each byte lands in the top of its 32-bit lane, then an arithmetic shift sign extends it
+	glm_ivec4 const i0 = _mm_cvtsi32_si128(p);
+	glm_ivec4 const i1 = _mm_unpacklo_epi8(i0, i0);
+	glm_ivec4 const i2 = _mm_srai_epi32(_mm_unpacklo_epi16(i1, i1), 24);
+	return glm_vec4_clamp_norm(_mm_mul_ps(_mm_cvtepi32_ps(i2), _mm_set1_ps(0.0078740157480315f)), -1.0f);
+}
+
+// The 4x16 kernels keep the packed value in the low 64 bits of the integer register
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_pack_unorm4x16(glm_vec4 v)
+{
+	// SSE2 has no unsigned saturating 32 to 16 bit pack: bias into the signed range and back
+	glm_ivec4 const bias = _mm_set1_epi32(0x8000);
+	glm_ivec4 const i0 = glm_vec4_round_away(_mm_mul_ps(glm_vec4_clamp_norm(v, 0.0f), _mm_set1_ps(65535.0f)));
+	glm_ivec4 const i1 = _mm_sub_epi32(i0, bias);
+	return _mm_xor_si128(_mm_packs_epi32(i1, i1), _mm_set1_epi16(static_cast<short>(0x8000)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpack_unorm4x16(glm_ivec4 p)
+{
+	glm_ivec4 const i0 = _mm_unpacklo_epi16(p, _mm_setzero_si128());
+	return _mm_mul_ps(_mm_cvtepi32_ps(i0), _mm_set1_ps(1.5259021896696421759365224689097e-5f));
+}
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_pack_snorm4x16(glm_vec4 v)
+{
+	glm_ivec4 const i0 = glm_vec4_round_away(_mm_mul_ps(glm_vec4_clamp_norm(v, -1.0f), _mm_set1_ps(32767.0f)));
+	return _mm_packs_epi32(i0, i0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpack_snorm4x16(glm_ivec4 p)
+{
+	glm_ivec4 const i0 = _mm_srai_epi32(_mm_unpacklo_epi16(p, p), 16);
+	return glm_vec4_clamp_norm(_mm_mul_ps(_mm_cvtepi32_ps(i0), _mm_set1_ps(3.0518509475997192297128208258309e-5f)), -1.0f);
+}
+
+// Same result as detail::toFloat16 for every input, including its rounding of ties away from zero.
+// F16C is not used here because _mm_cvtps_ph rounds ties to even.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_pack_half4x16(glm_vec4 v)
+{
+	glm_ivec4 const bits = _mm_castps_si128(v);
+	glm_ivec4 const sgn = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+	glm_ivec4 const exf = _mm_and_si128(_mm_srli_epi32(bits, 23), _mm_set1_epi32(0xff));
+	glm_ivec4 const man = _mm_and_si128(bits, _mm_set1_epi32(0x007fffff));
+	glm_ivec4 const exh = _mm_sub_epi32(exf, _mm_set1_epi32(127 - 15));
+
+	// Normals: round the mantissa, a carry bumps the exponent, overflow saturates to infinity
+	glm_ivec4 const rnd = _mm_add_epi32(man, _mm_slli_epi32(_mm_and_si128(man, _mm_set1_epi32(0x1000)), 1));
+	glm_ivec4 const nrm0 = _mm_add_epi32(_mm_slli_epi32(exh, 10), _mm_srli_epi32(rnd, 13));
+	glm_ivec4 const ovf = _mm_cmpgt_epi32(nrm0, _mm_set1_epi32(0x7bff));
+	glm_ivec4 const nrm = _mm_or_si128(_mm_and_si128(ovf, _mm_set1_epi32(0x7c00)), _mm_andnot_si128(ovf, nrm0));
+
+	// Subnormals and zeros: |v| * 2^24 is the half mantissa, exact in float, rounded half up
+	glm_vec4 const abs0 = _mm_castsi128_ps(_mm_and_si128(bits, _mm_set1_epi32(0x7fffffff)));
+	glm_vec4 const sub0 = _mm_mul_ps(abs0, _mm_set1_ps(16777216.0f));
+	glm_ivec4 const sub1 = _mm_cvttps_epi32(sub0);
+	glm_ivec4 const sub2 = _mm_castps_si128(_mm_cmpge_ps(_mm_sub_ps(sub0, _mm_cvtepi32_ps(sub1)), _mm_set1_ps(0.5f)));
+	glm_ivec4 const sub = _mm_sub_epi32(sub1, sub2);
+
+	// Infinities and NaNs: keep the top of the payload, and never turn a NaN into an infinity
+	glm_ivec4 const pay = _mm_srli_epi32(man, 13);
+	glm_ivec4 const lost = _mm_andnot_si128(_mm_cmpeq_epi32(man, _mm_setzero_si128()), _mm_cmpeq_epi32(pay, _mm_setzero_si128()));
+	glm_ivec4 const spc = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(0x7c00), pay), _mm_and_si128(lost, _mm_set1_epi32(1)));
+
+	glm_ivec4 const isSub = _mm_cmplt_epi32(exh, _mm_set1_epi32(1));
+	glm_ivec4 const isSpc = _mm_cmpeq_epi32(exf, _mm_set1_epi32(0xff));
+	glm_ivec4 const fin = _mm_or_si128(_mm_and_si128(isSub, sub), _mm_andnot_si128(isSub, nrm));
+	glm_ivec4 const res = _mm_or_si128(_mm_or_si128(_mm_and_si128(isSpc, spc), _mm_andnot_si128(isSpc, fin)), sgn);
+
+	// Sign extend so the saturating pack keeps the 16 bits as they are
+	glm_ivec4 const ext = _mm_srai_epi32(_mm_slli_epi32(res, 16), 16);
+	return _mm_packs_epi32(ext, ext);
+}
+
+// With F16C, signalling NaNs come back quiet; everything else matches detail::toFloat32.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpack_half4x16(glm_ivec4 p)
+{
+#	if defined(__F16C__) || (defined(_MSC_VER) && (GLM_ARCH & GLM_ARCH_AVX2_BIT))
+		return _mm_cvtph_ps(p);
+#	else
+		glm_ivec4 const h = _mm_unpacklo_epi16(p, _mm_setzero_si128());
+		glm_ivec4 const sgn = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+		glm_ivec4 const exp = _mm_and_si128(h, _mm_set1_epi32(0x7c00));
+		glm_ivec4 const man = _mm_and_si128(h, _mm_set1_epi32(0x03ff));
+
+		// Normals, infinities and NaNs: rebias the exponent, twice for the all ones exponent
+		glm_ivec4 const isSpc = _mm_cmpeq_epi32(exp, _mm_set1_epi32(0x7c00));
+		glm_ivec4 const bias = _mm_add_epi32(_mm_set1_epi32(112 << 23), _mm_and_si128(isSpc, _mm_set1_epi32(112 << 23)));
+		glm_ivec4 const nrm = _mm_add_epi32(_mm_slli_epi32(_mm_or_si128(exp, man), 13), bias);
+
+		// Subnormals and zeros: the mantissa times 2^-24 is exact
+		glm_ivec4 const sub = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(man), _mm_set1_ps(5.9604644775390625e-8f)));
+
+		glm_ivec4 const isSub = _mm_cmpeq_epi32(exp, _mm_setzero_si128());
+		glm_ivec4 const res = _mm_or_si128(_mm_and_si128(isSub, sub), _mm_andnot_si128(isSub, nrm));
+		return _mm_castsi128_ps(_mm_or_si128(res, sgn));
+#	endif
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,101 @@
+/// @ref simd
+/// @file glm/simd/quaternion.h
+
+#pragma once
+
+#include "geometric.h"
+#include "trigonometric.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// The single quaternion kernels take the x, y, z, w lane order and keep the
+// operation order of the scalar code, so their results are bit-identical.
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_mul(glm_vec4 p, glm_vec4 q)
+{
+	glm_vec4 const sgn0 = _mm_set_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+
+	glm_vec4 const mul0 = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3)), q);
+	glm_vec4 const mul1 = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 2, 1, 0)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 3, 3, 3)));
+	glm_vec4 const mul2 = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 0, 2, 1)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(1, 1, 0, 2)));
+	glm_vec4 const mul3 = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 1, 0, 2)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 0, 2, 1)));
+
+	// w subtracts every product but the first one, flipping a sign is exact
+	glm_vec4 const add0 = _mm_add_ps(mul0, _mm_xor_ps(mul1, sgn0));
+	glm_vec4 const add1 = _mm_add_ps(add0, _mm_xor_ps(mul2, sgn0));
+	return _mm_sub_ps(add1, mul3);
+}
+
+// Rotates the x, y and z lanes of v, the w lane of the result is undefined
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_rotate(glm_vec4 q, glm_vec4 v)
+{
+	glm_vec4 const uv = glm_vec4_cross(q, v);
+	glm_vec4 const uuv = glm_vec4_cross(q, uv);
+	glm_vec4 const add0 = _mm_add_ps(_mm_mul_ps(uv, _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 3))), uuv);
+	return _mm_add_ps(v, _mm_mul_ps(add0, _mm_set1_ps(2.0f)));
+}
+
+// Four slerps at once. x, y and Out hold one quaternion component per vector
+// in storage order, a holds the four interpolation factors. Within 1e-6 of
+// glm::slerp for unit quaternions and factors in [0, 1].
+GLM_FUNC_QUALIFIER void glm_quat4_slerp(glm_vec4 const x[4], glm_vec4 const y[4], glm_vec4 a, glm_vec4 Out[4])
+{
+	glm_vec4 const dot0 = _mm_add_ps(
+		_mm_add_ps(_mm_mul_ps(x[0], y[0]), _mm_mul_ps(x[1], y[1])),
+		_mm_add_ps(_mm_mul_ps(x[2], y[2]), _mm_mul_ps(x[3], y[3])));
+
+	// Take the short way around by negating y where the dot product is negative
+	glm_vec4 const sgn0 = _mm_and_ps(_mm_cmplt_ps(dot0, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+	glm_vec4 const cos0 = _mm_xor_ps(dot0, sgn0);
+
+	glm_vec4 const one0 = _mm_set1_ps(1.0f);
+	glm_vec4 const ang0 = glm_vec4_acos(_mm_min_ps(cos0, one0));
+	glm_vec4 const sin0 = glm_vec4_sin(_mm_mul_ps(_mm_sub_ps(one0, a), ang0));
+	glm_vec4 const sin1 = glm_vec4_sin(_mm_mul_ps(a, ang0));
+	glm_vec4 const sin2 = glm_vec4_sin(ang0);
+
+	// Linear interpolation where sin(angle) gets close to zero, like glm::slerp
+	glm_vec4 const lin0 = _mm_cmpgt_ps(cos0, _mm_set1_ps(1.0f - 1.19209290e-7f));
+	glm_vec4 const wgt0 = _mm_or_ps(_mm_and_ps(lin0, _mm_sub_ps(one0, a)), _mm_andnot_ps(lin0, _mm_div_ps(sin0, sin2)));
+	glm_vec4 const wgt1 = _mm_xor_ps(_mm_or_ps(_mm_and_ps(lin0, a), _mm_andnot_ps(lin0, _mm_div_ps(sin1, sin2))), sgn0);
+
+	for(int i = 0; i < 4; ++i)
+		Out[i] = _mm_add_ps(_mm_mul_ps(x[i], wgt0), _mm_mul_ps(y[i], wgt1));
+}
+
+// Translation * rotation * scale, in the columns of out. q takes the x, y, z, w
+// lane order, t and s only their x, y and z lanes. The rotation is computed as
+// mat3_cast does, so the result is bit-identical to the product of the three
+// matrices, whose extra terms only add zeros.
+GLM_FUNC_QUALIFIER void glm_mat4_compose_trs(glm_vec4 q, glm_vec4 t, glm_vec4 s, glm_vec4 out[4])
+{
+	glm_vec4 const Mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+	glm_vec4 const Two = _mm_set1_ps(2.0f);
+
+	// Column 0: (1 - 2 * (yy + zz), 2 * (xy + wz), 2 * (xz - wy))
+	glm_vec4 const A0 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 0, 1)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 2, 1, 1)));
+	glm_vec4 const B0 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 2)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 2, 2)));
+	glm_vec4 const C0 = _mm_mul_ps(Two, _mm_add_ps(A0, _mm_xor_ps(B0, _mm_set_ps(0.0f, -0.0f, 0.0f, 0.0f))));
+
+	// Column 1: (2 * (xy - wz), 1 - 2 * (xx + zz), 2 * (yz + wx))
+	glm_vec4 const A1 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 0)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 2, 0, 1)));
+	glm_vec4 const B1 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 2, 3)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 2)));
+	glm_vec4 const C1 = _mm_mul_ps(Two, _mm_add_ps(A1, _mm_xor_ps(B1, _mm_set_ps(0.0f, 0.0f, 0.0f, -0.0f))));
+
+	// Column 2: (2 * (xz + wy), 2 * (yz - wx), 1 - 2 * (xx + yy))
+	glm_vec4 const A2 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 1, 0)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 2)));
+	glm_vec4 const B2 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 3, 3)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 1)));
+	glm_vec4 const C2 = _mm_mul_ps(Two, _mm_add_ps(A2, _mm_xor_ps(B2, _mm_set_ps(0.0f, 0.0f, -0.0f, 0.0f))));
+
+	// 1 - x is 1 + (-x); adding zero leaves the other lanes unchanged
+	glm_vec4 const R0 = _mm_add_ps(_mm_xor_ps(C0, _mm_set_ps(0.0f, 0.0f, 0.0f, -0.0f)), _mm_set_ps(0.0f, 0.0f, 0.0f, 1.0f));
+	glm_vec4 const R1 = _mm_add_ps(_mm_xor_ps(C1, _mm_set_ps(0.0f, 0.0f, -0.0f, 0.0f)), _mm_set_ps(0.0f, 0.0f, 1.0f, 0.0f));
+	glm_vec4 const R2 = _mm_add_ps(_mm_xor_ps(C2, _mm_set_ps(0.0f, -0.0f, 0.0f, 0.0f)), _mm_set_ps(0.0f, 1.0f, 0.0f, 0.0f));
+
+	out[0] = _mm_and_ps(_mm_mul_ps(R0, _mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 0, 0, 0))), Mask);
+	out[1] = _mm_and_ps(_mm_mul_ps(R1, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))), Mask);
+	out[2] = _mm_and_ps(_mm_mul_ps(R2, _mm_shuffle_ps(s, s, _MM_SHUFFLE(2, 2, 2, 2))), Mask);
+	out[3] = _mm_or_ps(_mm_and_ps(t, Mask), _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -3,7 +3,129 @@
 
 #pragma once
 
+#include "common.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+// Cephes single precision polynomials. sin and cos reduce the argument to
+// [-pi/4, pi/4] with a three-part Cody-Waite pi/4. Over |x| <= pi, sin and cos
+// are within 2 ULPs of the correctly rounded result and tan within 4 ULPs; up
+// to |x| = 8192 the absolute error of sin and cos stays under 1e-7. atan is
+// within 2 ULPs over all floats and acos within 1 ULP over [-1, 1]. Arguments
+// past 8192, infinities and NaNs are left to libm by callers; see
+// glm_vec4_trig_in_range.
+
+GLM_FUNC_QUALIFIER bool glm_vec4_trig_in_range(glm_vec4 x)
+{
+	glm_vec4 const abs0 = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+	glm_vec4 const cmp0 = _mm_cmpnle_ps(abs0, _mm_set1_ps(8192.0f)); // true for NaN
+	return _mm_movemask_ps(cmp0) == 0;
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_vec4 x, glm_vec4* s, glm_vec4* c)
+{
+	glm_vec4 const sgn0 = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+	glm_vec4 const abs0 = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+
+	// Octant rounded up to even: |x| = j * pi/4 + r, |r| <= pi/4
+	glm_ivec4 const oct0 = _mm_cvttps_epi32(_mm_mul_ps(abs0, _mm_set1_ps(1.27323954473516f)));
+	glm_ivec4 const oct1 = _mm_and_si128(_mm_add_epi32(oct0, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	glm_vec4 const y = _mm_cvtepi32_ps(oct1);
+	glm_vec4 const red0 = _mm_sub_ps(abs0, _mm_mul_ps(y, _mm_set1_ps(0.78515625f)));
+	glm_vec4 const red1 = _mm_sub_ps(red0, _mm_mul_ps(y, _mm_set1_ps(2.4187564849853515625e-4f)));
+	glm_vec4 const r = _mm_sub_ps(red1, _mm_mul_ps(y, _mm_set1_ps(3.77489497744594108e-8f)));
+	glm_vec4 const z = _mm_mul_ps(r, r);
+
+	glm_vec4 const sp0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-1.9515295891e-4f), z), _mm_set1_ps(8.3321608736e-3f));
+	glm_vec4 const sp1 = _mm_add_ps(_mm_mul_ps(sp0, z), _mm_set1_ps(-1.6666654611e-1f));
+	glm_vec4 const sp2 = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sp1, z), r), r);
+
+	glm_vec4 const cp0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.443315711809948e-5f), z), _mm_set1_ps(-1.388731625493765e-3f));
+	glm_vec4 const cp1 = _mm_add_ps(_mm_mul_ps(cp0, z), _mm_set1_ps(4.166664568298827e-2f));
+	glm_vec4 const cp2 = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(cp1, z), z), _mm_mul_ps(_mm_set1_ps(0.5f), z));
+	glm_vec4 const cp3 = _mm_add_ps(cp2, _mm_set1_ps(1.0f));
+
+	// Quadrant q = j / 2: odd quadrants swap the polynomials, sin is negated in
+	// quadrants 2 and 3, cos in quadrants 1 and 2.
+	glm_vec4 const swp0 = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(oct1, _mm_set1_epi32(2)), _mm_set1_epi32(2)));
+	glm_vec4 const sin0 = _mm_or_ps(_mm_and_ps(swp0, cp3), _mm_andnot_ps(swp0, sp2));
+	glm_vec4 const cos0 = _mm_or_ps(_mm_and_ps(swp0, sp2), _mm_andnot_ps(swp0, cp3));
+	glm_vec4 const sns0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(oct1, _mm_set1_epi32(4)), 29));
+	glm_vec4 const cns0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(oct1, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+
+	*s = _mm_xor_ps(sin0, _mm_xor_ps(sns0, sgn0));
+	*c = _mm_xor_ps(cos0, cns0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return c;
+}
 
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_tan(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return _mm_div_ps(s, c);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan(glm_vec4 x)
+{
+	glm_vec4 const sgn0 = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+	glm_vec4 const abs0 = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+
+	// atan(x) = pi/2 + atan(-1/x) over tan(3pi/8), pi/4 + atan((x-1)/(x+1)) over tan(pi/8)
+	glm_vec4 const big0 = _mm_cmpgt_ps(abs0, _mm_set1_ps(2.414213562373095f));
+	glm_vec4 const mid0 = _mm_andnot_ps(big0, _mm_cmpgt_ps(abs0, _mm_set1_ps(0.4142135623730950f)));
+	glm_vec4 const one0 = _mm_set1_ps(1.0f);
+	glm_vec4 const xbig = _mm_div_ps(_mm_set1_ps(-1.0f), abs0);
+	glm_vec4 const xmid = _mm_div_ps(_mm_sub_ps(abs0, one0), _mm_add_ps(abs0, one0));
+	glm_vec4 const xr = _mm_or_ps(_mm_and_ps(big0, xbig), _mm_or_ps(_mm_and_ps(mid0, xmid), _mm_andnot_ps(_mm_or_ps(big0, mid0), abs0)));
+	glm_vec4 const y0 = _mm_or_ps(_mm_and_ps(big0, _mm_set1_ps(1.57079632679489661923f)), _mm_and_ps(mid0, _mm_set1_ps(0.78539816339744830962f)));
+
+	glm_vec4 const z = _mm_mul_ps(xr, xr);
+	glm_vec4 const p0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(8.05374449538e-2f), z), _mm_set1_ps(-1.38776856032e-1f));
+	glm_vec4 const p1 = _mm_add_ps(_mm_mul_ps(p0, z), _mm_set1_ps(1.99777106478e-1f));
+	glm_vec4 const p2 = _mm_add_ps(_mm_mul_ps(p1, z), _mm_set1_ps(-3.33329491539e-1f));
+	glm_vec4 const p3 = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p2, z), xr), xr);
+
+	return _mm_xor_ps(_mm_add_ps(y0, p3), sgn0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_acos(glm_vec4 x)
+{
+	glm_vec4 const sgn0 = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+	glm_vec4 const abs0 = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+
+	// asin polynomial on [0, 0.5]: acos(x) = 2 * asin(sqrt((1 - x) / 2)) above 0.5, pi/2 - asin(x) below
+	glm_vec4 const big0 = _mm_cmpgt_ps(abs0, _mm_set1_ps(0.5f));
+	glm_vec4 const zbig = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), abs0), _mm_set1_ps(0.5f));
+	glm_vec4 const z = _mm_or_ps(_mm_and_ps(big0, zbig), _mm_andnot_ps(big0, _mm_mul_ps(abs0, abs0)));
+	glm_vec4 const xr = _mm_or_ps(_mm_and_ps(big0, _mm_sqrt_ps(zbig)), _mm_andnot_ps(big0, abs0));
+
+	glm_vec4 const p0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(4.2163199048e-2f), z), _mm_set1_ps(2.4181311049e-2f));
+	glm_vec4 const p1 = _mm_add_ps(_mm_mul_ps(p0, z), _mm_set1_ps(4.5470025998e-2f));
+	glm_vec4 const p2 = _mm_add_ps(_mm_mul_ps(p1, z), _mm_set1_ps(7.4953002686e-2f));
+	glm_vec4 const p3 = _mm_add_ps(_mm_mul_ps(p2, z), _mm_set1_ps(1.6666752422e-1f));
+	glm_vec4 const p4 = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p3, z), xr), xr);
+
+	glm_vec4 const rbig = _mm_add_ps(p4, p4);
+	glm_vec4 const rsml = _mm_sub_ps(_mm_set1_ps(1.57079632679489661923f), p4);
+	glm_vec4 const res0 = _mm_or_ps(_mm_and_ps(big0, rbig), _mm_andnot_ps(big0, rsml));
+
+	// acos(-x) = pi - acos(x)
+	glm_vec4 const neg0 = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(sgn0), 31));
+	glm_vec4 const res1 = _mm_sub_ps(_mm_set1_ps(3.14159265358979323846f), res0);
+	return _mm_or_ps(_mm_and_ps(neg0, res1), _mm_andnot_ps(neg0, res0));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,73 @@
+#ifndef GLM_FORCE_INTRINSICS
+#	define GLM_FORCE_INTRINSICS
+#endif
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtx/matrix_decompose.hpp>
+#include "../sample.hpp"
+
+// The aligned types go through SIMD, the packed ones through the scalar code.
+// Same operation order as the scalar code: results must be identical.
+
+typedef glm::mat<4, 4, float, glm::aligned_highp> aligned_mat4;
+typedef glm::vec<3, float, glm::aligned_highp> aligned_vec3;
+typedef glm::qua<float, glm::aligned_highp> aligned_quat;
+
+static int test_compose_trs()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 100; ++i)
+	{
+		float const t = static_cast<float>(i);
+		glm::vec3 const T(t - 50.0f, 2.0f, t * 0.25f);
+		glm::quat const R = make_orientation(i) * (1.0f + t * 0.01f);
+		glm::vec3 const S(1.0f + t * 0.1f, 0.5f, -2.0f);
+
+		glm::mat4 const Result(glm::composeTRS(aligned_vec3(T), aligned_quat(R), aligned_vec3(S)));
+		Error += Result == glm::composeTRS(T, R, S) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_affine_inverse()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 100; ++i)
+	{
+		float const t = static_cast<float>(i);
+		glm::mat4 m = glm::composeTRS(glm::vec3(t - 50.0f, 2.0f, t * 0.25f), make_orientation(i), glm::vec3(1.0f + t * 0.1f, 0.5f, -2.0f));
+		m[0][1] += 0.25f;
+		m[2][0] -= t * 0.01f;
+
+		glm::mat4 const Result(glm::affineInverse(aligned_mat4(m)));
+		Error += Result == glm::affineInverse(m) ? 0 : 1;
+		Error += Result[0][3] == 0.0f && Result[1][3] == 0.0f && Result[2][3] == 0.0f && Result[3][3] == 1.0f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_compose_trs();
+	Error += test_affine_inverse();
+
+	return exit_status(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
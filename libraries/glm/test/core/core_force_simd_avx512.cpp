@@ -0,0 +1,17 @@
+// Only core_force_simd_avx512_kernels.cpp is built with AVX-512 code
+// generation, so this file runs on any CPU and skips the test on those
+// without AVX-512 F and VL.
+#include <glm/glm.hpp>
+#include "../sample.hpp"
+
+int test_avx512();
+
+int main()
+{
+#	if GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG)
+		if(!__builtin_cpu_supports("avx512f") || !__builtin_cpu_supports("avx512vl"))
+			return 0;
+#	endif
+
+	return exit_status(test_avx512());
+}
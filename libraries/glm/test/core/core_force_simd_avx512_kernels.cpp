@@ -0,0 +1,182 @@
+// The AVX-512 half of test-core_force_simd_avx512: the build adds AVX-512 F
+// and VL code generation to this file only, where the compiler supports it,
+// and core_force_simd_avx512.cpp checks the CPU before calling in. Builds
+// already defining GLM_FORCE_INTRINSICS detect the same architecture.
+#if defined(__AVX512F__) && defined(__AVX512VL__) && !defined(GLM_FORCE_INTRINSICS)
+#	define GLM_FORCE_AVX512
+#endif
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+#include <glm/gtx/batch.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <vector>
+#include "../sample.hpp"
+
+typedef glm::mat<4, 4, float, glm::aligned_highp> aligned_mat4;
+typedef glm::vec<4, float, glm::aligned_highp> aligned_vec4;
+
+static int test_arch()
+{
+	int Error = 0;
+
+	// AVX-512 builds keep every narrower kernel
+	Error += (GLM_ARCH & GLM_ARCH_AVX2_BIT) ? 0 : 1;
+	Error += (GLM_ARCH & GLM_ARCH_AVX_BIT) ? 0 : 1;
+	Error += (GLM_ARCH & GLM_ARCH_SSE2_BIT) ? 0 : 1;
+	Error += GLM_CONFIG_SIMD == GLM_ENABLE ? 0 : 1;
+
+	glm::mat4 const m = make_matrix(3);
+	glm::vec4 const v = make_vec(5);
+	Error += glm::mat4(aligned_mat4(m) * aligned_mat4(m)) == m * m ? 0 : 1;
+	Error += glm::vec4(aligned_mat4(m) * aligned_vec4(v)) == m * v ? 0 : 1;
+
+	return Error;
+}
+
+static int test_shuffle()
+{
+	int Error = 0;
+
+	float In[48];
+	for(int i = 0; i < 48; ++i)
+		In[i] = static_cast<float>(i);
+
+	__m512 x, y, z;
+	glm_vec3x16_deinterleave(_mm512_loadu_ps(In + 0), _mm512_loadu_ps(In + 16), _mm512_loadu_ps(In + 32), &x, &y, &z);
+
+	float Soa[48];
+	_mm512_storeu_ps(Soa + 0, x);
+	_mm512_storeu_ps(Soa + 16, y);
+	_mm512_storeu_ps(Soa + 32, z);
+	for(int k = 0; k < 16; ++k)
+	for(int c = 0; c < 3; ++c)
+		Error += Soa[c * 16 + k] == In[k * 3 + c] ? 0 : 1;
+
+	__m512 Aos[3];
+	glm_vec3x16_interleave(x, y, z, Aos);
+	float Out[48];
+	for(int r = 0; r < 3; ++r)
+		_mm512_storeu_ps(Out + r * 16, Aos[r]);
+	for(int i = 0; i < 48; ++i)
+		Error += Out[i] == In[i] ? 0 : 1;
+
+	glm_vec2x16_deinterleave(_mm512_loadu_ps(In + 0), _mm512_loadu_ps(In + 16), &x, &y);
+	_mm512_storeu_ps(Soa + 0, x);
+	_mm512_storeu_ps(Soa + 16, y);
+	for(int k = 0; k < 16; ++k)
+	for(int c = 0; c < 2; ++c)
+		Error += Soa[c * 16 + k] == In[k * 2 + c] ? 0 : 1;
+
+	glm_vec2x16_interleave(x, y, Aos);
+	_mm512_storeu_ps(Out + 0, Aos[0]);
+	_mm512_storeu_ps(Out + 16, Aos[1]);
+	for(int i = 0; i < 32; ++i)
+		Error += Out[i] == In[i] ? 0 : 1;
+
+	return Error;
+}
+
+static int test_matrix()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 16; ++i)
+	{
+		glm::mat4 const m = make_matrix(i);
+		glm::mat4 const n = make_matrix(i * 5 + 2);
+
+		glm::mat4 Result;
+		_mm512_storeu_ps(&Result[0][0], glm_mat4x4_transpose(_mm512_loadu_ps(&m[0][0])));
+		Error += Result == glm::transpose(m) ? 0 : 1;
+
+		__m512 Col[4];
+		glm_mat4x4_broadcast_cols(_mm512_loadu_ps(&m[0][0]), Col);
+		_mm512_storeu_ps(&Result[0][0], glm_mat4x4_mul_cols(Col, _mm512_loadu_ps(&n[0][0])));
+		Error += Result == m * n ? 0 : 1;
+
+		// The columns of n as four vectors
+		glm::vec4 v[4];
+		_mm512_storeu_ps(&v[0][0], glm_mat4x4_mul_vec4(Col, _mm512_loadu_ps(&n[0][0])));
+		for(glm::length_t j = 0; j < 4; ++j)
+			Error += v[j] == m * n[j] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Counts around the 4 and 16 element groups exercise the masked tails, which must not write past Count
+static int test_tails()
+{
+	int Error = 0;
+
+	glm::mat4 const m = make_matrix(7);
+	glm::vec4 const Guard(-7.0f);
+
+	for(std::size_t Count = 0; Count <= 40; ++Count)
+	{
+		std::vector<glm::vec4> In4(Count + 4), Out4(Count + 4, Guard);
+		std::vector<glm::vec3> In3(Count + 4), Out3(Count + 4, glm::vec3(Guard)), Norm3(Count + 4, glm::vec3(Guard));
+		std::vector<glm::vec2> In2(Count + 4), Out2(Count + 4, glm::vec2(Guard)), Norm2(Count + 4, glm::vec2(Guard));
+		std::vector<glm::mat4> InM(Count + 1), OutM(Count + 1, glm::mat4(Guard, Guard, Guard, Guard));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			In4[i] = make_vec(i);
+			In3[i] = glm::vec3(In4[i]);
+			In2[i] = glm::vec2(In4[i]);
+			InM[i] = make_matrix(static_cast<int>(i));
+		}
+
+		glm::batch::transform(m, &In4[0], &Out4[0], Count);
+		glm::batch::transform(m, &In3[0], &Out3[0], Count);
+		glm::batch::transform(m, &In2[0], &Out2[0], Count);
+		glm::batch::normalize(&In3[0], &Norm3[0], Count);
+		glm::batch::normalize(&In2[0], &Norm2[0], Count);
+		glm::batch::transpose(&InM[0], &OutM[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Out4[i] == m * In4[i] ? 0 : 1;
+			Error += Out3[i] == glm::vec3(m * glm::vec4(In3[i], 1.0f)) ? 0 : 1;
+			Error += Out2[i] == glm::vec2(m * glm::vec4(In2[i], 0.0f, 1.0f)) ? 0 : 1;
+			Error += Norm3[i] == glm::normalize(In3[i]) ? 0 : 1;
+			Error += Norm2[i] == glm::normalize(In2[i]) ? 0 : 1;
+			Error += OutM[i] == glm::transpose(InM[i]) ? 0 : 1;
+		}
+		for(std::size_t i = Count; i < Count + 4; ++i)
+		{
+			Error += Out4[i] == Guard ? 0 : 1;
+			Error += Out3[i] == glm::vec3(Guard) ? 0 : 1;
+			Error += Out2[i] == glm::vec2(Guard) ? 0 : 1;
+			Error += Norm3[i] == glm::vec3(Guard) ? 0 : 1;
+			Error += Norm2[i] == glm::vec2(Guard) ? 0 : 1;
+		}
+		Error += OutM[Count] == glm::mat4(Guard, Guard, Guard, Guard) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_avx512();
+int test_avx512()
+{
+	int Error = 0;
+
+	Error += test_arch();
+	Error += test_shuffle();
+	Error += test_matrix();
+	Error += test_tails();
+
+	return Error;
+}
+
+#else
+
+int test_avx512();
+int test_avx512()
+{
+	return 0;
+}
+
+#endif
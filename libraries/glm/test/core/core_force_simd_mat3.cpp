@@ -0,0 +1,138 @@
+#ifndef GLM_FORCE_INTRINSICS
+#	define GLM_FORCE_INTRINSICS
+#endif
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtx/matrix_transform_2d.hpp>
+#include "../sample.hpp"
+
+// The aligned matrices go through SIMD, the packed ones through the scalar code.
+// Same operation order as the scalar code: results must be identical.
+
+typedef glm::mat<3, 3, float, glm::aligned_highp> aligned_mat3;
+typedef glm::mat<3, 2, float, glm::aligned_highp> aligned_mat3x2;
+typedef glm::mat<2, 3, float, glm::aligned_highp> aligned_mat2x3;
+typedef glm::vec<3, float, glm::aligned_highp> aligned_vec3;
+typedef glm::vec<2, float, glm::aligned_highp> aligned_vec2;
+
+// A 2D affine transform: rotation, non uniform scale and translation
+static glm::mat3 make_affine(int i)
+{
+	float const t = static_cast<float>(i);
+	glm::mat3 m = glm::translate(glm::mat3(1.0f), glm::vec2(t * 0.5f - 3.0f, 2.0f + t));
+	m = glm::rotate(m, t * 0.37f);
+	return glm::scale(m, glm::vec2(1.5f + t * 0.01f, 0.75f));
+}
+
+static glm::mat3 make_mat3(int i)
+{
+	float const t = static_cast<float>(i);
+	glm::mat3 m = make_affine(i);
+	m[0][2] = glm::sin(t * 0.3f);
+	m[1][2] = 0.25f - t * 0.01f;
+	m[2][2] = 1.0f + glm::cos(t * 0.7f);
+	return m;
+}
+
+static int test_mul()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 100; ++i)
+	{
+		glm::mat3 const a = make_mat3(i);
+		glm::mat3 const b = make_mat3(i * 3 + 1);
+		glm::vec3 const v(static_cast<float>(i) - 50.0f, 2.0f, -0.25f * static_cast<float>(i));
+
+		Error += glm::mat3(aligned_mat3(a) * aligned_mat3(b)) == a * b ? 0 : 1;
+		Error += glm::vec3(aligned_mat3(a) * aligned_vec3(v)) == a * v ? 0 : 1;
+
+		glm::mat3x2 const c(a);
+		glm::mat2x3 const d(b);
+		Error += glm::vec2(aligned_mat3x2(c) * aligned_vec3(v)) == c * v ? 0 : 1;
+		Error += glm::mat3x2(aligned_mat3x2(c) * aligned_mat3(b)) == c * b ? 0 : 1;
+		Error += glm::vec3(aligned_mat2x3(d) * aligned_vec2(v)) == d * glm::vec2(v) ? 0 : 1;
+		Error += glm::mat3(aligned_mat2x3(d) * aligned_mat3x2(c)) == d * c ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_transpose()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 100; ++i)
+	{
+		glm::mat3 const m = make_mat3(i);
+		glm::mat3x2 const c(m);
+		glm::mat2x3 const d(m);
+
+		Error += glm::mat3(glm::transpose(aligned_mat3(m))) == glm::transpose(m) ? 0 : 1;
+		Error += glm::mat2x3(glm::transpose(aligned_mat3x2(c))) == glm::transpose(c) ? 0 : 1;
+		Error += glm::mat3x2(glm::transpose(aligned_mat2x3(d))) == glm::transpose(d) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_inverse()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 100; ++i)
+	{
+		glm::mat3 const m = make_mat3(i);
+		glm::mat3 const a = make_affine(i);
+
+		Error += glm::determinant(aligned_mat3(m)) == glm::determinant(m) ? 0 : 1;
+		Error += glm::mat3(glm::inverse(aligned_mat3(m))) == glm::inverse(m) ? 0 : 1;
+		Error += glm::mat3(glm::affineInverse(aligned_mat3(a))) == glm::affineInverse(a) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_transform_2d()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 100; ++i)
+	{
+		float const t = static_cast<float>(i);
+		glm::mat3 const m = make_mat3(i);
+		glm::vec2 const v(t * 0.1f - 4.0f, 3.0f - t);
+
+		Error += glm::mat3(glm::translate(aligned_mat3(m), aligned_vec2(v))) == glm::translate(m, v) ? 0 : 1;
+		Error += glm::mat3(glm::rotate(aligned_mat3(m), t * 0.2f)) == glm::rotate(m, t * 0.2f) ? 0 : 1;
+		Error += glm::mat3(glm::scale(aligned_mat3(m), aligned_vec2(v))) == glm::scale(m, v) ? 0 : 1;
+		Error += glm::mat3(glm::shearX(aligned_mat3(m), t * 0.1f)) == glm::shearX(m, t * 0.1f) ? 0 : 1;
+		Error += glm::mat3(glm::shearY(aligned_mat3(m), t * 0.1f)) == glm::shearY(m, t * 0.1f) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_mul();
+	Error += test_transpose();
+	Error += test_inverse();
+	Error += test_transform_2d();
+
+	return exit_status(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,216 @@
+#ifndef GLM_FORCE_INTRINSICS
+#	define GLM_FORCE_INTRINSICS
+#endif
+#include <glm/glm.hpp>
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/packing.hpp>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "../sample.hpp"
+
+// The scalar kernels are the reference: the SIMD ones must match them bit for bit.
+
+static bool same_bits(glm::vec4 const& a, glm::vec4 const& b)
+{
+	return std::memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+static float from_bits(glm::uint32 Bits)
+{
+	float Result;
+	std::memcpy(&Result, &Bits, sizeof(Result));
+	return Result;
+}
+
+static glm::uint32 to_bits(float Value)
+{
+	glm::uint32 Result;
+	std::memcpy(&Result, &Value, sizeof(Result));
+	return Result;
+}
+
+// Every half value must survive an unpack and pack round trip.
+static int test_half_round_trip()
+{
+	int Error = 0;
+
+	for(glm::uint64 h = 0; h < 0x10000; h += 4)
+	{
+		glm::uint64 const Packed = h | ((h + 1) << 16) | ((h + 2) << 32) | ((h + 3) << 48);
+		glm::vec4 const Ref = glm::detail::compute_unpackHalf4x16<false>::call(Packed);
+		glm::vec4 const Unpacked = glm::unpackHalf4x16(Packed);
+
+		for(glm::length_t i = 0; i < 4; ++i)
+		{
+			if(std::isnan(Ref[i]))
+				Error += std::isnan(Unpacked[i]) ? 0 : 1;
+			else
+				Error += to_bits(Ref[i]) == to_bits(Unpacked[i]) ? 0 : 1;
+		}
+
+		Error += glm::packHalf4x16(Ref) == Packed ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_half_pack()
+{
+	int Error = 0;
+
+	// Strided sweep of all float bit patterns: normals, subnormals, overflow, infinities and NaNs
+	for(glm::uint64 i = 0; i < 0x100000000ull; i += 4 * 4099)
+	{
+		glm::vec4 const v(
+			from_bits(static_cast<glm::uint32>(i)),
+			from_bits(static_cast<glm::uint32>(i + 4099)),
+			from_bits(static_cast<glm::uint32>(i + 2 * 4099)),
+			from_bits(static_cast<glm::uint32>(i + 3 * 4099)));
+		Error += glm::packHalf4x16(v) == glm::detail::compute_packHalf4x16<false>::call(v) ? 0 : 1;
+	}
+
+	// Ties between two halves, in the normal and subnormal ranges, and at the overflow threshold
+	glm::vec4 const Ties(
+		from_bits(0x3f801000),
+		from_bits(0x38001000),
+		from_bits(0x33000000),
+		from_bits(0x477ff000));
+	Error += glm::packHalf4x16(Ties) == glm::detail::compute_packHalf4x16<false>::call(Ties) ? 0 : 1;
+	Error += glm::packHalf4x16(-Ties) == glm::detail::compute_packHalf4x16<false>::call(-Ties) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_norm_pack()
+{
+	int Error = 0;
+
+	// Steps of 1/2040 hit every 8 bit tie exactly and go past the clamping range
+	for(int i = -3060; i <= 3060; i += 4)
+	{
+		glm::vec4 const v(
+			static_cast<float>(i) / 2040.0f,
+			static_cast<float>(i + 1) / 2040.0f,
+			static_cast<float>(i + 2) / 2040.0f,
+			static_cast<float>(i + 3) / 2040.0f);
+
+		Error += glm::packUnorm4x8(v) == glm::detail::compute_packUnorm4x8<false>::call(v) ? 0 : 1;
+		Error += glm::packSnorm4x8(v) == glm::detail::compute_packSnorm4x8<false>::call(v) ? 0 : 1;
+		Error += glm::packUnorm4x16(v) == glm::detail::compute_packUnorm4x16<false>::call(v) ? 0 : 1;
+		Error += glm::packSnorm4x16(v) == glm::detail::compute_packSnorm4x16<false>::call(v) ? 0 : 1;
+	}
+
+	glm::vec4 const Ties(0.5f / 65535.0f, 32767.5f / 65535.0f, 0.5f / 32767.0f, -16383.5f / 32767.0f);
+	Error += glm::packUnorm4x16(Ties) == glm::detail::compute_packUnorm4x16<false>::call(Ties) ? 0 : 1;
+	Error += glm::packSnorm4x16(Ties) == glm::detail::compute_packSnorm4x16<false>::call(Ties) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_norm_unpack()
+{
+	int Error = 0;
+
+	for(glm::uint32 b = 0; b < 0x100; ++b)
+	{
+		glm::uint const p = b | ((b ^ 0x80) << 8) | ((b ^ 0xff) << 16) | ((b ^ 0x7f) << 24);
+		Error += same_bits(glm::unpackUnorm4x8(p), glm::detail::compute_unpackUnorm4x8<false>::call(p)) ? 0 : 1;
+		Error += same_bits(glm::unpackSnorm4x8(p), glm::detail::compute_unpackSnorm4x8<false>::call(p)) ? 0 : 1;
+
+		// Every 8 bit value goes back to itself, except -128 which unpacks to -1 like -127
+		Error += glm::packUnorm4x8(glm::unpackUnorm4x8(p)) == p ? 0 : 1;
+		if(b != 0x00 && b != 0x7f && b != 0x80 && b != 0xff)
+			Error += glm::packSnorm4x8(glm::unpackSnorm4x8(p)) == p ? 0 : 1;
+	}
+
+	for(glm::uint64 s = 0; s < 0x10000; ++s)
+	{
+		glm::uint64 const p = s | ((s ^ 0x8000) << 16) | ((s ^ 0xffff) << 32) | ((s ^ 0x7fff) << 48);
+		Error += same_bits(glm::unpackUnorm4x16(p), glm::detail::compute_unpackUnorm4x16<false>::call(p)) ? 0 : 1;
+		Error += same_bits(glm::unpackSnorm4x16(p), glm::detail::compute_unpackSnorm4x16<false>::call(p)) ? 0 : 1;
+
+		Error += glm::packUnorm4x16(glm::unpackUnorm4x16(p)) == p ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_span()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1001;
+	std::vector<glm::vec4> In(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = glm::sin(glm::vec4(0.1f, 0.2f, 0.3f, 0.4f) * static_cast<float>(i)) * 1.25f;
+
+	std::vector<glm::uint32> Packed32(Count);
+	std::vector<glm::uint64> Packed64(Count);
+	std::vector<glm::vec4> Out(Count);
+
+	glm::packUnorm4x8(&In[0], &Packed32[0], Count);
+	glm::unpackUnorm4x8(&Packed32[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Packed32[i] == glm::packUnorm4x8(In[i]) ? 0 : 1;
+		Error += same_bits(Out[i], glm::unpackUnorm4x8(Packed32[i])) ? 0 : 1;
+	}
+
+	glm::packSnorm4x8(&In[0], &Packed32[0], Count);
+	glm::unpackSnorm4x8(&Packed32[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Packed32[i] == glm::packSnorm4x8(In[i]) ? 0 : 1;
+		Error += same_bits(Out[i], glm::unpackSnorm4x8(Packed32[i])) ? 0 : 1;
+	}
+
+	glm::packUnorm4x16(&In[0], &Packed64[0], Count);
+	glm::unpackUnorm4x16(&Packed64[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Packed64[i] == glm::packUnorm4x16(In[i]) ? 0 : 1;
+		Error += same_bits(Out[i], glm::unpackUnorm4x16(Packed64[i])) ? 0 : 1;
+	}
+
+	glm::packSnorm4x16(&In[0], &Packed64[0], Count);
+	glm::unpackSnorm4x16(&Packed64[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Packed64[i] == glm::packSnorm4x16(In[i]) ? 0 : 1;
+		Error += same_bits(Out[i], glm::unpackSnorm4x16(Packed64[i])) ? 0 : 1;
+	}
+
+	glm::packHalf4x16(&In[0], &Packed64[0], Count);
+	glm::unpackHalf4x16(&Packed64[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Packed64[i] == glm::packHalf4x16(In[i]) ? 0 : 1;
+		Error += same_bits(Out[i], glm::unpackHalf4x16(Packed64[i])) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_half_round_trip();
+	Error += test_half_pack();
+	Error += test_norm_pack();
+	Error += test_norm_unpack();
+	Error += test_span();
+
+	return exit_status(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef GLM_FORCE_INTRINSICS
+#	define GLM_FORCE_INTRINSICS
+#endif
+#include <glm/glm.hpp>
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/quaternion.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+#include "../sample.hpp"
+
+// The aligned quaternions go through SIMD, the packed ones through the scalar code.
+
+typedef glm::qua<float, glm::aligned_highp> aligned_quat;
+typedef glm::qua<double, glm::aligned_highp> aligned_dquat;
+typedef glm::vec<3, float, glm::aligned_highp> aligned_vec3;
+typedef glm::vec<4, float, glm::aligned_highp> aligned_vec4;
+
+static glm::quat make_quat(int i)
+{
+	float const t = static_cast<float>(i);
+	return glm::angleAxis(t * 0.37f - 3.0f, glm::normalize(glm::vec3(glm::sin(t * 0.11f), glm::cos(t * 0.23f), 0.5f)));
+}
+
+// Same operation order as the scalar code: results must be identical.
+static int test_mul()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 100; ++i)
+	{
+		glm::quat const p = make_quat(i) * 1.5f;
+		glm::quat const q = make_quat(i + 7);
+		glm::quat const Ref = p * q;
+
+		aligned_quat Result = aligned_quat(p) * aligned_quat(q);
+		Error += glm::quat(Result) == Ref ? 0 : 1;
+
+		Result = aligned_quat(p);
+		Result *= aligned_quat(q);
+		Error += glm::quat(Result) == Ref ? 0 : 1;
+
+		glm::dquat const dp(p);
+		glm::dquat const dq(q);
+		Error += glm::dquat(aligned_dquat(dp) * aligned_dquat(dq)) == dp * dq ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_rotate()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 100; ++i)
+	{
+		glm::quat const q = make_quat(i);
+		glm::vec3 const v(static_cast<float>(i) - 50.0f, 2.0f, -0.25f * static_cast<float>(i));
+
+		Error += glm::vec3(aligned_quat(q) * aligned_vec3(v)) == q * v ? 0 : 1;
+		Error += glm::vec4(aligned_quat(q) * aligned_vec4(v, 1.0f)) == q * glm::vec4(v, 1.0f) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_slerp()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 100; ++i)
+	{
+		glm::quat const x = make_quat(i);
+		glm::quat const y = make_quat(i * 3 + 1);
+		float const a = static_cast<float>(i % 11) / 10.0f;
+
+		Error += glm::all(glm::equal(glm::quat(glm::slerp(aligned_quat(x), aligned_quat(y), a)), glm::slerp(x, y, a), 1e-6f)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::quat(glm::slerp(aligned_quat(x), aligned_quat(-y), a)), glm::slerp(x, -y, a), 1e-6f)) ? 0 : 1;
+
+		// mix takes the long way for a negative dot product, where sin(angle) gets small and amplifies rounding
+		glm::quat const z = glm::dot(x, y) < 0.0f ? -y : y;
+		Error += glm::all(glm::equal(glm::quat(glm::mix(aligned_quat(x), aligned_quat(z), a)), glm::mix(x, z, a), 1e-6f)) ? 0 : 1;
+
+		// Nearly identical quaternions take the linear path
+		Error += glm::all(glm::equal(glm::quat(glm::slerp(aligned_quat(x), aligned_quat(x), a)), glm::slerp(x, x, a), 1e-6f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_slerp_span()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1003;
+	std::vector<glm::quat> x(Count), y(Count), Out(Count);
+	std::vector<float> a(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		int const j = static_cast<int>(i);
+		x[i] = make_quat(j);
+		// Some pairs are equal, some are on opposite sides of the sphere
+		y[i] = j % 5 == 0 ? x[i] : make_quat(j * 7 + 3);
+		a[i] = static_cast<float>(j % 17) / 16.0f;
+	}
+
+	glm::slerp(&x[0], &y[0], &a[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], glm::slerp(x[i], y[i], a[i]), 1e-6f)) ? 0 : 1;
+
+	glm::slerp(&x[0], &y[0], 0.25f, &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], glm::slerp(x[i], y[i], 0.25f), 1e-6f)) ? 0 : 1;
+
+	// Out may alias an input
+	std::vector<glm::quat> InPlace(x);
+	glm::slerp(&InPlace[0], &y[0], &a[0], &InPlace[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(InPlace[i], glm::slerp(x[i], y[i], a[i]), 1e-6f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_mul();
+	Error += test_rotate();
+	Error += test_slerp();
+	Error += test_slerp_span();
+
+	return exit_status(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
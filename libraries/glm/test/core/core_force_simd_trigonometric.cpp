@@ -0,0 +1,121 @@
+#ifndef GLM_FORCE_INTRINSICS
+#	define GLM_FORCE_INTRINSICS
+#endif
+#define GLM_FORCE_SIMD_TRIGONOMETRIC
+#include <glm/glm.hpp>
+
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/ext/scalar_ulp.hpp>
+#include <glm/ext/scalar_constants.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+static std::size_t const Samples = 100000;
+
+// Largest distance in ULPs to the double precision result rounded to float.
+template<typename funcType, typename refType>
+static int max_ulps(funcType Func, refType Ref, float Min, float Max)
+{
+	int Result = 0;
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const x = Min + (Max - Min) * static_cast<float>(i) / static_cast<float>(Samples);
+		glm::aligned_vec4 const v(x, -x, x * 0.5f, x * 0.75f);
+		glm::aligned_vec4 const r = Func(v);
+		for(glm::length_t j = 0; j < 4; ++j)
+			Result = std::max(Result, std::abs(glm::floatDistance(r[j], static_cast<float>(Ref(static_cast<double>(v[j]))))));
+	}
+	return Result;
+}
+
+template<typename funcType, typename refType>
+static double max_abs(funcType Func, refType Ref, float Min, float Max)
+{
+	double Result = 0;
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const x = Min + (Max - Min) * static_cast<float>(i) / static_cast<float>(Samples);
+		glm::aligned_vec4 const v(x, -x, x * 0.5f, x * 0.75f);
+		glm::aligned_vec4 const r = Func(v);
+		for(glm::length_t j = 0; j < 4; ++j)
+			Result = std::max(Result, std::abs(static_cast<double>(r[j]) - Ref(static_cast<double>(v[j]))));
+	}
+	return Result;
+}
+
+static glm::aligned_vec4 sin_vec4(glm::aligned_vec4 const& v) { return glm::sin(v); }
+static glm::aligned_vec4 cos_vec4(glm::aligned_vec4 const& v) { return glm::cos(v); }
+static glm::aligned_vec4 tan_vec4(glm::aligned_vec4 const& v) { return glm::tan(v); }
+static glm::aligned_vec4 atan_vec4(glm::aligned_vec4 const& v) { return glm::atan(v); }
+
+static double sin_ref(double x) { return std::sin(x); }
+static double cos_ref(double x) { return std::cos(x); }
+static double tan_ref(double x) { return std::tan(x); }
+static double atan_ref(double x) { return std::atan(x); }
+
+static int test_ulps()
+{
+	int Error = 0;
+
+	float const Pi = glm::pi<float>();
+
+	Error += max_ulps(sin_vec4, sin_ref, -Pi, Pi) <= 2 ? 0 : 1;
+	Error += max_ulps(cos_vec4, cos_ref, -Pi, Pi) <= 2 ? 0 : 1;
+	Error += max_ulps(tan_vec4, tan_ref, -Pi, Pi) <= 4 ? 0 : 1;
+	Error += max_ulps(atan_vec4, atan_ref, -100.0f, 100.0f) <= 2 ? 0 : 1;
+	Error += max_ulps(atan_vec4, atan_ref, -1e30f, 1e30f) <= 2 ? 0 : 1;
+
+	Error += max_abs(sin_vec4, sin_ref, -8192.0f, 8192.0f) < 1e-7 ? 0 : 1;
+	Error += max_abs(cos_vec4, cos_ref, -8192.0f, 8192.0f) < 1e-7 ? 0 : 1;
+
+	return Error;
+}
+
+static int test_special()
+{
+	int Error = 0;
+
+	glm::aligned_vec4 const Large(1e9f, -3e5f, 8193.0f, 0.0f);
+	glm::aligned_vec4 const SinLarge = glm::sin(Large);
+	glm::aligned_vec4 const CosLarge = glm::cos(Large);
+	for(glm::length_t i = 0; i < 4; ++i)
+	{
+		Error += SinLarge[i] == std::sin(Large[i]) ? 0 : 1;
+		Error += CosLarge[i] == std::cos(Large[i]) ? 0 : 1;
+	}
+
+	glm::aligned_vec4 const Special(std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(), -0.0f);
+	glm::aligned_vec4 const SinSpecial = glm::sin(Special);
+	Error += std::isnan(SinSpecial.x) && std::isnan(SinSpecial.y) && std::isnan(SinSpecial.z) ? 0 : 1;
+	Error += SinSpecial.w == 0.0f && std::signbit(SinSpecial.w) ? 0 : 1;
+
+	glm::aligned_vec4 const AtanSpecial = glm::atan(Special);
+	Error += AtanSpecial.x == std::atan(Special.x) ? 0 : 1;
+	Error += AtanSpecial.y == std::atan(Special.y) ? 0 : 1;
+	Error += std::isnan(AtanSpecial.z) ? 0 : 1;
+	Error += AtanSpecial.w == 0.0f && std::signbit(AtanSpecial.w) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_ulps();
+	Error += test_special();
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -10,7 +10,11 @@
 #include <glm/mat4x2.hpp>
 #include <glm/mat4x3.hpp>
 #include <glm/mat4x4.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 #include <vector>
+#include <cmath>
 #include <ctime>
 #include <cstdio>
 
@@ -265,6 +269,39 @@ static int test_inverse_simd()
 	return Error;
 }
 
+// Aligned dmat4 goes through AVX when available and must match the scalar code exactly.
+static int test_dmat4_simd()
+{
+	int Error = 0;
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		for(int i = 0; i < 100; ++i)
+		{
+			glm::dmat4 M(1);
+			glm::dmat4 N(1);
+			for(glm::length_t c = 0; c < 4; ++c)
+			for(glm::length_t r = 0; r < 4; ++r)
+			{
+				M[c][r] += std::sin(static_cast<double>(i * 16 + c * 4 + r)) * 2.0;
+				N[c][r] -= std::cos(static_cast<double>(i * 16 + r * 4 + c));
+			}
+			glm::dvec4 const V(1.5, -2.25, i * 0.125, 4.0);
+
+			glm::aligned_dmat4 const A(M);
+			glm::aligned_dmat4 const B(N);
+			glm::aligned_dvec4 const W(V);
+
+			Error += glm::all(glm::equal(glm::dmat4(A * B), M * N, 0.0)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::dvec4(A * W), M * V, 0.0)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::dmat4(glm::transpose(A)), glm::transpose(M), 0.0)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::dmat4(glm::inverse(A)), glm::inverse(M), 0.0)) ? 0 : 1;
+			Error += glm::determinant(A) == glm::determinant(M) ? 0 : 1;
+		}
+#	endif
+
+	return Error;
+}
+
 static int test_shearing()
 {
     int Error = 0;
@@ -407,6 +444,7 @@ int main()
 	Error += test_determinant();
 	Error += test_inverse();
 	Error += test_inverse_simd();
+	Error += test_dmat4_simd();
 	Error += test_shearing();
 
 #ifdef NDEBUG
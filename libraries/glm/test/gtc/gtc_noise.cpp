@@ -1,7 +1,12 @@
+#ifndef GLM_FORCE_INTRINSICS
+#	define GLM_FORCE_INTRINSICS
+#endif
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtc/noise.hpp>
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtx/raw_data.hpp>
+#include <vector>
+#include "../sample.hpp"
 
 static int test_simplex_float()
 {
@@ -69,6 +74,73 @@ static int test_perlin_pedioric_double()
 	return Error;
 }
 
+// Positions around the origin and far from it, on both sides of cell borders
+template<glm::length_t L, typename T, glm::qualifier Q>
+static glm::vec<L, T, Q> make_position(std::size_t i)
+{
+	float const t = static_cast<float>(i);
+	return glm::vec<L, T, Q>(glm::vec4(glm::sin(t * 0.37f) * 9.5f - 3.0f, t * 0.29f - 40.0f, glm::cos(t * 0.11f) * 300.0f, 0.0f));
+}
+
+// Arrays must match the single position functions exactly, whatever the count and qualifier.
+// The reference is the packed position: aligned ones may take other SIMD paths.
+template<glm::length_t L, typename T, glm::qualifier Q>
+static int test_array(std::size_t Count)
+{
+	typedef glm::vec<L, T, glm::defaultp> packedType;
+
+	int Error = 0;
+
+	std::vector<glm::vec<L, T, Q> > In(Count + 1, glm::vec<L, T, Q>(0));
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = make_position<L, T, Q>(i);
+
+	std::vector<T> Perlin(Count + 1, -7), Simplex(Count + 1, -7);
+	glm::perlin(&In[0], &Perlin[0], Count);
+	glm::simplex(&In[0], &Simplex[0], Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Perlin[i] == glm::perlin(packedType(In[i])) ? 0 : 1;
+		Error += Simplex[i] == glm::simplex(packedType(In[i])) ? 0 : 1;
+	}
+
+	// Nothing is written past Count
+	Error += Perlin[Count] == -7 ? 0 : 1;
+	Error += Simplex[Count] == -7 ? 0 : 1;
+
+	return Error;
+}
+
+// The grid filled in Bands row ranges, last band first, as separate workers would
+template<typename T>
+static int test_grid(std::size_t Width, std::size_t Height, std::size_t Bands)
+{
+	int Error = 0;
+
+	glm::vec<2, T, glm::defaultp> const Origin(static_cast<T>(-13.7), static_cast<T>(2.25));
+	glm::vec<2, T, glm::defaultp> const Step(static_cast<T>(0.0625), static_cast<T>(0.171));
+
+	std::vector<T> Perlin(Width * Height + 1, -7), Simplex(Width * Height + 1, -7);
+	for(std::size_t b = Bands; b > 0; --b)
+	{
+		glm::perlinGrid(Origin, Step, Width, Height * (b - 1) / Bands, Height * b / Bands, &Perlin[0]);
+		glm::simplexGrid(Origin, Step, Width, Height * (b - 1) / Bands, Height * b / Bands, &Simplex[0]);
+	}
+
+	for(std::size_t y = 0; y < Height; ++y)
+	for(std::size_t x = 0; x < Width; ++x)
+	{
+		glm::vec<2, T, glm::defaultp> const Position(Origin + Step * glm::vec<2, T, glm::defaultp>(static_cast<T>(x), static_cast<T>(y)));
+		Error += Perlin[y * Width + x] == glm::perlin(Position) ? 0 : 1;
+		Error += Simplex[y * Width + x] == glm::simplex(Position) ? 0 : 1;
+	}
+	Error += Perlin[Width * Height] == -7 ? 0 : 1;
+	Error += Simplex[Width * Height] == -7 ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -82,5 +154,27 @@ int main()
 	Error += test_perlin_pedioric_float();
 	Error += test_perlin_pedioric_double();
 
-	return Error;
+	std::size_t const Counts[] = {0, 1, 3, 4, 5, 8, 15, 16, 17, 33, 1000};
+	for(std::size_t i = 0; i < sizeof(Counts) / sizeof(Counts[0]); ++i)
+	{
+		Error += test_array<2, float, glm::defaultp>(Counts[i]);
+		Error += test_array<3, float, glm::defaultp>(Counts[i]);
+		Error += test_array<2, double, glm::defaultp>(Counts[i]);
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			Error += test_array<3, float, glm::aligned_highp>(Counts[i]);
+#		endif
+	}
+
+	std::size_t const Widths[] = {1, 5, 16, 17, 61};
+	for(std::size_t i = 0; i < sizeof(Widths) / sizeof(Widths[0]); ++i)
+	{
+		Error += test_grid<float>(Widths[i], 9, 1);
+		Error += test_grid<float>(Widths[i], 9, 4);
+	}
+	Error += test_grid<double>(7, 5, 1);
+
+	Error += test_grid<float>(509, 130, 3);
+	Error += test_grid<float>(3, 2, 5); // empty bands
+
+	return exit_status(Error);
 }
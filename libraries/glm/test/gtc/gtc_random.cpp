@@ -2,6 +2,8 @@
 #include <glm/gtc/random.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtc/type_precision.hpp>
+#include <vector>
+#include <cmath>
 #if GLM_LANG & GLM_LANG_CXX0X_FLAG
 #	include <array>
 #endif
@@ -322,6 +324,282 @@ static int test_ballRand()
 
 	return Error;
 }
+
+// The reference xoshiro128** step, one stream
+static glm::uint32 xoshiro128_reference(glm::uint32 s[4])
+{
+	glm::uint32 const x = s[1] * 5u;
+	glm::uint32 const r = (x << 7) | (x >> 25);
+	glm::uint32 const Result = r * 9u;
+	glm::uint32 const t = s[1] << 9;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = (s[3] << 11) | (s[3] >> 21);
+
+	return Result;
+}
+
+static int test_xoshiro128()
+{
+	int Error = 0;
+
+	{
+		glm::xoshiro128 Generator(0);
+		Generator.State[0][0] = 1;
+		Generator.State[1][0] = 2;
+		Generator.State[2][0] = 3;
+		Generator.State[3][0] = 4;
+		Error += Generator() == 11520u ? 0 : 1;
+	}
+
+	// Output i comes from lane i % 8, each lane being a plain xoshiro128** stream
+	{
+		glm::xoshiro128 Generator(42, 7);
+		glm::uint32 Lanes[8][4];
+		for(int k = 0; k < 8; ++k)
+		for(int i = 0; i < 4; ++i)
+			Lanes[k][i] = Generator.State[i][k];
+
+		for(std::size_t i = 0; i < 1000; ++i)
+			Error += Generator() == xoshiro128_reference(Lanes[i % 8]) ? 0 : 1;
+	}
+
+	Error += (glm::xoshiro128::min)() == 0u ? 0 : 1;
+	Error += (glm::xoshiro128::max)() == 0xFFFFFFFFu ? 0 : 1;
+
+	return Error;
+}
+
+static int test_xoshiro128_streams()
+{
+	int Error = 0;
+
+	std::size_t const Samples = 100000;
+
+	glm::xoshiro128 A(1234, 0), B(1234, 0), C(1234, 1), D(1235, 0);
+	std::size_t Same = 0;
+	std::size_t Bits[32] = {0};
+	double SumA = 0.0, SumC = 0.0, SumAA = 0.0, SumCC = 0.0, SumAC = 0.0;
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::uint32 const a = A();
+		glm::uint32 const c = C();
+		Error += a == B() ? 0 : 1;
+		Same += a == c || a == D() ? 1 : 0;
+
+		for(int b = 0; b < 32; ++b)
+			Bits[b] += (a >> b) & 1u;
+
+		double const x = static_cast<double>(a), y = static_cast<double>(c);
+		SumA += x;
+		SumC += y;
+		SumAA += x * x;
+		SumCC += y * y;
+		SumAC += x * y;
+	}
+	Error += Same < 4 ? 0 : 1;
+
+	// Every bit is set half of the time, the standard error being 0.0016
+	for(int b = 0; b < 32; ++b)
+	{
+		double const Frequency = static_cast<double>(Bits[b]) / static_cast<double>(Samples);
+		Error += std::abs(Frequency - 0.5) < 0.01 ? 0 : 1;
+	}
+
+	// Streams are uncorrelated, the standard error being 0.003
+	double const n = static_cast<double>(Samples);
+	double const Covariance = SumAC / n - (SumA / n) * (SumC / n);
+	double const Correlation = Covariance / std::sqrt((SumAA / n - (SumA / n) * (SumA / n)) * (SumCC / n - (SumC / n) * (SumC / n)));
+	Error += std::abs(Correlation) < 0.02 ? 0 : 1;
+
+	return Error;
+}
+
+// Array functions against single calls, for starting lanes and counts around the eight lane steps
+static int test_xoshiro128_arrays()
+{
+	int Error = 0;
+
+	for(std::size_t Offset = 0; Offset < 8; ++Offset)
+	for(std::size_t Count = 0; Count <= 40; Count += Count < 20 ? 1 : 7)
+	{
+		glm::xoshiro128 A(99, Offset), B(99, Offset);
+		for(std::size_t i = 0; i < Offset; ++i)
+			Error += A() == B() ? 0 : 1;
+
+		std::vector<glm::uint32> Bits(Count + 1, 0xDEADBEEFu);
+		std::vector<float> Floats(Count + 1, -7.0f);
+		glm::generate(A, &Bits[0], Count);
+		glm::linearRand(A, -3.0f, 5.0f, &Floats[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Bits[i] == B() ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Floats[i] == glm::linearRand(B, -3.0f, 5.0f) ? 0 : 1;
+		Error += Bits[Count] == 0xDEADBEEFu ? 0 : 1;
+		Error += Floats[Count] == -7.0f ? 0 : 1;
+		Error += A() == B() ? 0 : 1;
+	}
+
+	// The SIMD rejection kernel against the scalar one
+	for(glm::length_t Dims = 2; Dims <= 3; ++Dims)
+	{
+		glm::xoshiro128 A(5, Dims), B(5, Dims);
+		for(int i = 0; i < 100; ++i)
+		{
+			bool const Surface = (i & 1) != 0;
+			float OutA[3][8], OutB[3][8], WA[8], WB[8];
+			unsigned int const MaskA = glm::detail::compute_random_block<GLM_CONFIG_SIMD == GLM_ENABLE>::ball(A.State, Dims, 1.5f, Surface, OutA, WA);
+			unsigned int const MaskB = glm::detail::compute_random_block<false>::ball(B.State, Dims, 1.5f, Surface, OutB, WB);
+			Error += MaskA == MaskB ? 0 : 1;
+			for(int k = 0; k < 8; ++k)
+			{
+				Error += WA[k] == WB[k] ? 0 : 1;
+				if(!(MaskA & (1u << k)))
+					continue;
+				for(glm::length_t d = 0; d < Dims; ++d)
+					Error += OutA[d][k] == OutB[d][k] ? 0 : 1;
+			}
+		}
+	}
+
+	return Error;
+}
+
+static int test_xoshiro128_distributions()
+{
+	int Error = 0;
+
+	std::size_t const Samples = 100000;
+	glm::xoshiro128 Generator(2024);
+
+	// Uniform: 64 bins and a chi-square under the 0.001 critical value of 63 degrees of freedom
+	{
+		std::vector<float> Values(Samples);
+		glm::linearRand(Generator, 2.0f, 5.0f, &Values[0], Samples);
+
+		std::size_t Bins[64] = {0};
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			Error += Values[i] >= 2.0f && Values[i] <= 5.0f ? 0 : 1;
+			++Bins[glm::min(static_cast<int>((Values[i] - 2.0f) / 3.0f * 64.0f), 63)];
+		}
+
+		double ChiSquare = 0.0;
+		double const Expected = static_cast<double>(Samples) / 64.0;
+		for(int b = 0; b < 64; ++b)
+			ChiSquare += (static_cast<double>(Bins[b]) - Expected) * (static_cast<double>(Bins[b]) - Expected) / Expected;
+		Error += ChiSquare < 103.4 ? 0 : 1;
+
+		for(std::size_t i = 0; i < 1000; ++i)
+		{
+			double const d = glm::linearRand(Generator, -1.0, 1.0);
+			Error += d >= -1.0 && d <= 1.0 ? 0 : 1;
+			glm::vec3 const v = glm::linearRand(Generator, glm::vec3(0, 1, 2), glm::vec3(1, 2, 3));
+			Error += glm::all(glm::greaterThanEqual(v, glm::vec3(0, 1, 2))) && glm::all(glm::lessThanEqual(v, glm::vec3(1, 2, 3))) ? 0 : 1;
+		}
+	}
+
+	// Gaussian: mean and spread, which is Deviation squared as with std::rand; the
+	// standard errors are 0.013 and 0.009 for a spread of 4
+	{
+		std::vector<float> Values(Samples + 1);
+		glm::gaussRand(Generator, 3.0f, 2.0f, &Values[0], Samples);
+
+		double Sum = 0.0, SumSquares = 0.0;
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			Sum += Values[i];
+			SumSquares += static_cast<double>(Values[i]) * Values[i];
+		}
+		double const Mean = Sum / static_cast<double>(Samples);
+		double const Deviation = std::sqrt(SumSquares / static_cast<double>(Samples) - Mean * Mean);
+		Error += std::abs(Mean - 3.0) < 0.06 ? 0 : 1;
+		Error += std::abs(Deviation - 4.0) < 0.045 ? 0 : 1;
+
+		Sum = 0.0;
+		SumSquares = 0.0;
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			double const x = glm::gaussRand(3.0, 2.0);
+			Sum += x;
+			SumSquares += x * x;
+		}
+		double const MeanRand = Sum / static_cast<double>(Samples);
+		Error += std::abs(MeanRand - 3.0) < 0.06 ? 0 : 1;
+		Error += std::abs(std::sqrt(SumSquares / static_cast<double>(Samples) - MeanRand * MeanRand) - 4.0) < 0.045 ? 0 : 1;
+
+		Sum = 0.0;
+		SumSquares = 0.0;
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			double const x = glm::gaussRand(Generator, -1.0, 0.5);
+			Sum += x;
+			SumSquares += x * x;
+		}
+		double const MeanScalar = Sum / static_cast<double>(Samples);
+		Error += std::abs(MeanScalar + 1.0) < 0.01 ? 0 : 1;
+		Error += std::abs(std::sqrt(SumSquares / static_cast<double>(Samples) - MeanScalar * MeanScalar) - 0.25) < 0.01 ? 0 : 1;
+	}
+
+	// Disk and ball: inside the radius, with a quarter and an eighth of the points within half of it
+	{
+		float const Radius = 3.0f;
+		std::vector<glm::vec2> Disk(Samples, glm::vec2(0));
+		std::vector<glm::vec3> Ball(Samples, glm::vec3(0));
+		glm::diskRand(Generator, Radius, &Disk[0], Samples);
+		glm::ballRand(Generator, Radius, &Ball[0], Samples);
+
+		std::size_t InnerDisk = 0, InnerBall = 0;
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			Error += glm::length(Disk[i]) <= Radius ? 0 : 1;
+			Error += glm::length(Ball[i]) <= Radius ? 0 : 1;
+			InnerDisk += glm::length(Disk[i]) < Radius * 0.5f ? 1 : 0;
+			InnerBall += glm::length(Ball[i]) < Radius * 0.5f ? 1 : 0;
+		}
+		Error += std::abs(static_cast<double>(InnerDisk) / static_cast<double>(Samples) - 0.25) < 0.01 ? 0 : 1;
+		Error += std::abs(static_cast<double>(InnerBall) / static_cast<double>(Samples) - 0.125) < 0.01 ? 0 : 1;
+
+		for(std::size_t i = 0; i < 1000; ++i)
+		{
+			Error += glm::length(glm::diskRand(Generator, Radius)) <= Radius ? 0 : 1;
+			Error += glm::length(glm::ballRand(Generator, 2.0)) <= 2.0 ? 0 : 1;
+		}
+	}
+
+	// Circle and sphere: on the radius and centred on the origin
+	{
+		float const Radius = 2.0f;
+		std::vector<glm::vec2> Circle(Samples, glm::vec2(0));
+		std::vector<glm::vec3> Sphere(Samples, glm::vec3(0));
+		glm::circularRand(Generator, Radius, &Circle[0], Samples);
+		glm::sphericalRand(Generator, Radius, &Sphere[0], Samples);
+
+		glm::dvec2 SumCircle(0);
+		glm::dvec3 SumSphere(0);
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			Error += glm::epsilonEqual(glm::length(Circle[i]), Radius, 0.0001f) ? 0 : 1;
+			Error += glm::epsilonEqual(glm::length(Sphere[i]), Radius, 0.0001f) ? 0 : 1;
+			SumCircle += glm::dvec2(Circle[i]);
+			SumSphere += glm::dvec3(Sphere[i]);
+		}
+		Error += glm::length(SumCircle) / static_cast<double>(Samples) < 0.02 ? 0 : 1;
+		Error += glm::length(SumSphere) / static_cast<double>(Samples) < 0.02 ? 0 : 1;
+
+		for(std::size_t i = 0; i < 1000; ++i)
+		{
+			Error += glm::epsilonEqual(glm::length(glm::circularRand(Generator, Radius)), Radius, 0.0001f) ? 0 : 1;
+			Error += glm::epsilonEqual(glm::length(glm::sphericalRand(Generator, 2.0)), 2.0, 0.000001) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 int test_grid()
@@ -372,6 +650,10 @@ int main()
 	Error += test_sphericalRand();
 	Error += test_diskRand();
 	Error += test_ballRand();
+	Error += test_xoshiro128();
+	Error += test_xoshiro128_streams();
+	Error += test_xoshiro128_arrays();
+	Error += test_xoshiro128_distributions();
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 	Error += test_grid();
@@ -0,0 +1,155 @@
+#ifndef GLM_FORCE_INTRINSICS
+#	define GLM_FORCE_INTRINSICS
+#endif
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/batch.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <vector>
+#include "../sample.hpp"
+
+// Every element must match the single value expression exactly.
+
+static int test_transform(std::size_t Count)
+{
+	int Error = 0;
+
+	glm::mat4 const m = make_matrix(static_cast<int>(Count));
+	glm::mat3x2 const a(m[0][0], m[0][1], m[1][0], m[1][1], m[3][0], m[3][1]);
+
+	std::vector<glm::vec4> In4(Count + 1), Out4(Count + 1);
+	std::vector<glm::vec3> In3(Count + 1), Out3(Count + 1);
+	std::vector<glm::vec2> In2(Count + 1), Out2(Count + 1), OutA(Count + 1);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		In4[i] = make_vec(i);
+		In3[i] = glm::vec3(In4[i]);
+		In2[i] = glm::vec2(In4[i]);
+	}
+
+	glm::batch::transform(m, &In4[0], &Out4[0], Count);
+	glm::batch::transform(m, &In3[0], &Out3[0], Count);
+	glm::batch::transform(m, &In2[0], &Out2[0], Count);
+	glm::batch::transform(a, &In2[0], &OutA[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Out4[i] == m * In4[i] ? 0 : 1;
+		Error += Out3[i] == glm::vec3(m * glm::vec4(In3[i], 1.0f)) ? 0 : 1;
+		Error += Out2[i] == glm::vec2(m * glm::vec4(In2[i], 0.0f, 1.0f)) ? 0 : 1;
+		Error += OutA[i] == a * glm::vec3(In2[i], 1.0f) ? 0 : 1;
+	}
+
+	// Nothing is written past Count
+	Error += Out4[Count] == glm::vec4(0.0f) ? 0 : 1;
+	Error += Out3[Count] == glm::vec3(0.0f) ? 0 : 1;
+	Error += Out2[Count] == glm::vec2(0.0f) ? 0 : 1;
+	Error += OutA[Count] == glm::vec2(0.0f) ? 0 : 1;
+
+	// In place
+	glm::batch::transform(m, &In3[0], &In3[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += In3[i] == Out3[i] ? 0 : 1;
+
+	return Error;
+}
+
+static int test_multiply(std::size_t Count)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> A(Count + 1), B(Count + 1), Out(Count + 1, glm::mat4(0.0f));
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		A[i] = make_matrix(static_cast<int>(i));
+		B[i] = make_matrix(static_cast<int>(i * 3 + 1));
+	}
+
+	glm::batch::multiply(&A[0], &B[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Out[i] == A[i] * B[i] ? 0 : 1;
+	Error += Out[Count] == glm::mat4(0.0f) ? 0 : 1;
+
+	glm::mat4 const Parent = make_matrix(-5);
+	glm::batch::multiply(Parent, &B[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Out[i] == Parent * B[i] ? 0 : 1;
+
+	// In place, on either side
+	std::vector<glm::mat4> C(A);
+	glm::batch::multiply(&C[0], &B[0], &C[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += C[i] == A[i] * B[i] ? 0 : 1;
+
+	C = B;
+	glm::batch::multiply(&A[0], &C[0], &C[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += C[i] == A[i] * B[i] ? 0 : 1;
+
+	return Error;
+}
+
+static int test_normalize(std::size_t Count)
+{
+	int Error = 0;
+
+	std::vector<glm::vec4> In4(Count + 1), Out4(Count + 1);
+	std::vector<glm::vec3> In3(Count + 1), Out3(Count + 1);
+	std::vector<glm::vec2> In2(Count + 1), Out2(Count + 1);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		In4[i] = make_vec(i);
+		In3[i] = glm::vec3(In4[i]);
+		In2[i] = glm::vec2(In4[i]);
+	}
+
+	glm::batch::normalize(&In4[0], &Out4[0], Count);
+	glm::batch::normalize(&In3[0], &Out3[0], Count);
+	glm::batch::normalize(&In2[0], &Out2[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Out4[i] == glm::normalize(In4[i]) ? 0 : 1;
+		Error += Out3[i] == glm::normalize(In3[i]) ? 0 : 1;
+		Error += Out2[i] == glm::normalize(In2[i]) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Large enough for non-temporal stores when the output is 32-byte aligned
+static int test_stream()
+{
+	int Error = 0;
+
+	std::size_t const Count = 500000;
+	std::vector<glm::vec3> In(Count);
+	std::vector<glm::vec3> Buffer(Count + 8);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = glm::vec3(make_vec(i));
+
+	// vec3 are 4-byte aligned: some offset among the first 8 elements is 32-byte aligned
+	std::size_t Offset = 0;
+	while(reinterpret_cast<std::size_t>(&Buffer[Offset]) % 32 != 0)
+		++Offset;
+
+	glm::mat4 const m = make_matrix(3);
+	glm::batch::transform(m, &In[0], &Buffer[Offset], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Buffer[Offset + i] == glm::vec3(m * glm::vec4(In[i], 1.0f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	std::size_t const Counts[] = {0, 1, 2, 7, 8, 9, 17, 1001};
+	for(std::size_t i = 0; i < sizeof(Counts) / sizeof(Counts[0]); ++i)
+	{
+		Error += test_transform(Counts[i]);
+		Error += test_multiply(Counts[i]);
+		Error += test_normalize(Counts[i]);
+	}
+	Error += test_stream();
+
+	return exit_status(Error);
+}
@@ -4,6 +4,7 @@
 #include <glm/ext/matrix_relational.hpp>
 #include <glm/ext/matrix_transform.hpp>
 #include <glm/ext/scalar_constants.hpp>
+#include "../sample.hpp"
 
 static int test_identity() {
 	int Error = 0;
@@ -48,12 +49,71 @@ static int test_scale_translate() {
 	return Error;
 }
 
+static int test_compose_trs()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 100; ++i)
+	{
+		float const t = static_cast<float>(i);
+		glm::vec3 const T(t - 50.0f, 2.0f, t * 0.25f);
+		glm::quat const R = make_orientation(i);
+		glm::vec3 const S(1.0f + t * 0.1f, 0.5f, -2.0f);
+
+		// The products only add zeros to the direct terms
+		glm::mat4 const Product = glm::translate(glm::mat4(1.0f), T) * glm::mat4_cast(R) * glm::scale(glm::mat4(1.0f), S);
+		Error += glm::composeTRS(T, R, S) == Product ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_decompose_trs()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 100; ++i)
+	{
+		float const t = static_cast<float>(i);
+		glm::vec3 const T(t - 50.0f, 2.0f, t * 0.25f);
+		glm::quat const R = make_orientation(i);
+		glm::vec3 const S(1.0f + t * 0.1f, 0.5f, i % 2 ? -2.0f : 2.0f);
+		glm::mat4 const Matrix = glm::composeTRS(T, R, S);
+
+		glm::vec3 Translation;
+		glm::quat Orientation;
+		glm::vec3 Scale;
+		Error += glm::decomposeTRS(Matrix, Translation, Orientation, Scale) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::composeTRS(Translation, Orientation, Scale), Matrix, 1e-4f)) ? 0 : 1;
+
+		// Same components as the general decomposition
+		glm::vec3 RefScale;
+		glm::quat RefOrientation;
+		glm::vec3 RefTranslation;
+		glm::vec3 Skew;
+		glm::vec4 Perspective;
+		Error += glm::decompose(Matrix, RefScale, RefOrientation, RefTranslation, Skew, Perspective) ? 0 : 1;
+		Error += Translation == RefTranslation ? 0 : 1;
+		Error += glm::all(glm::equal(Scale, RefScale, 1e-4f)) ? 0 : 1;
+		Error += glm::abs(glm::dot(Orientation, RefOrientation)) > 0.9999f ? 0 : 1;
+	}
+
+	glm::vec3 Translation;
+	glm::quat Orientation;
+	glm::vec3 Scale;
+	Error += glm::decomposeTRS(glm::scale(glm::mat4(1.0f), glm::vec3(1.0f, 0.0f, 1.0f)), Translation, Orientation, Scale) ? 1 : 0;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_identity();
 	Error += test_scale_translate();
+	Error += test_compose_trs();
+	Error += test_decompose_trs();
 
 	return Error;
 }
@@ -0,0 +1,205 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/batch.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include "../sample.hpp"
+
+// What a caller would write without the batch API
+static glm::vec4 transform(glm::mat4 const& m, glm::vec4 const& v)
+{
+	return m * v;
+}
+
+static glm::vec3 transform(glm::mat4 const& m, glm::vec3 const& v)
+{
+	return glm::vec3(m * glm::vec4(v, 1.0f));
+}
+
+static glm::vec2 transform(glm::mat4 const& m, glm::vec2 const& v)
+{
+	return glm::vec2(m * glm::vec4(v, 0.0f, 1.0f));
+}
+
+template <typename vecType>
+static int launch_transform(std::vector<vecType>& O, std::size_t Samples, bool Batch)
+{
+	std::vector<vecType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = vecType(make_vec(i));
+
+	glm::mat4 const m = make_matrix(3);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	if(Batch)
+		glm::batch::transform(m, &I[0], &O[0], Samples);
+	else for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = transform(m, I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int launch_multiply(std::vector<glm::mat4>& O, std::size_t Samples, bool Batch)
+{
+	std::vector<glm::mat4> A(Samples);
+	std::vector<glm::mat4> B(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		A[i] = make_matrix(static_cast<int>(i));
+		B[i] = make_matrix(static_cast<int>(i * 3 + 1));
+	}
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	if(Batch)
+		glm::batch::multiply(&A[0], &B[0], &O[0], Samples);
+	else for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = A[i] * B[i];
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int launch_transpose(std::vector<glm::mat4>& O, std::size_t Samples, bool Batch)
+{
+	std::vector<glm::mat4> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = make_matrix(static_cast<int>(i));
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	if(Batch)
+		glm::batch::transpose(&I[0], &O[0], Samples);
+	else for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = glm::transpose(I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int launch_normalize(std::vector<glm::vec3>& O, std::size_t Samples, bool Batch)
+{
+	std::vector<glm::vec3> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = glm::vec3(make_vec(i));
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	if(Batch)
+		glm::batch::normalize(&I[0], &O[0], Samples);
+	else for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = glm::normalize(I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename vecType>
+static int comp_transform(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<vecType> SISD;
+	std::printf("- SISD: %d us\n", launch_transform(SISD, Samples, false));
+
+	std::vector<vecType> Batch;
+	std::printf("- Batch: %d us\n", launch_transform(Batch, Samples, true));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += Batch[i] == SISD[i] ? 0 : 1;
+
+	return Error > 0 ? 1 : 0;
+}
+
+static int comp_multiply(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> SISD;
+	std::printf("- SISD: %d us\n", launch_multiply(SISD, Samples, false));
+
+	std::vector<glm::mat4> Batch;
+	std::printf("- Batch: %d us\n", launch_multiply(Batch, Samples, true));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += Batch[i] == SISD[i] ? 0 : 1;
+
+	return Error > 0 ? 1 : 0;
+}
+
+static int comp_transpose(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> SISD;
+	std::printf("- SISD: %d us\n", launch_transpose(SISD, Samples, false));
+
+	std::vector<glm::mat4> Batch;
+	std::printf("- Batch: %d us\n", launch_transpose(Batch, Samples, true));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += Batch[i] == SISD[i] ? 0 : 1;
+
+	return Error > 0 ? 1 : 0;
+}
+
+static int comp_normalize(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> SISD;
+	std::printf("- SISD: %d us\n", launch_normalize(SISD, Samples, false));
+
+	std::vector<glm::vec3> Batch;
+	std::printf("- Batch: %d us\n", launch_normalize(Batch, Samples, true));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += Batch[i] == SISD[i] ? 0 : 1;
+
+	return Error > 0 ? 1 : 0;
+}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	int Error = 0;
+
+	std::printf("mat4 * vec4[]:\n");
+	Error += comp_transform<glm::vec4>(Samples);
+
+	std::printf("mat4 * vec3[] points:\n");
+	Error += comp_transform<glm::vec3>(Samples);
+
+	std::printf("mat4 * vec2[] points:\n");
+	Error += comp_transform<glm::vec2>(Samples);
+
+	std::printf("mat4[] * mat4[]:\n");
+	Error += comp_multiply(Samples);
+
+	std::printf("transpose(mat4[]):\n");
+	Error += comp_transpose(Samples);
+
+	std::printf("normalize(vec3[]):\n");
+	Error += comp_normalize(Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,117 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_transform_2d.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef glm::mat<3, 3, float, glm::aligned_highp> aligned_mat3;
+typedef glm::vec<3, float, glm::aligned_highp> aligned_vec3;
+typedef glm::vec<2, float, glm::aligned_highp> aligned_vec2;
+typedef glm::mat<4, 4, float, glm::aligned_highp> aligned_mat4;
+typedef glm::vec<4, float, glm::aligned_highp> aligned_vec4;
+
+// Moves stored 2D shapes: each local transform is updated and applied under a
+// parent, then points are moved to world space and back through the affine inverse.
+// Rotations are set up front, sin and cos would take most of the time.
+
+template <typename matType, typename vecType, typename offsetType>
+static int launch_mat3_2d(std::vector<glm::vec2>& O, std::size_t Samples)
+{
+	std::vector<matType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = glm::rotate(glm::translate(matType(1.0f), offsetType(static_cast<float>(i % 7), static_cast<float>(i % 5))), static_cast<float>(i % 11));
+	matType const Parent = glm::rotate(glm::translate(matType(1.0f), offsetType(10.0f, -4.0f)), 0.3f);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const t = static_cast<float>(i) * 0.001f;
+		matType Local = glm::translate(I[i], offsetType(t, 1.0f - t));
+		Local = glm::scale(Local, offsetType(2.0f, 0.5f + t));
+
+		matType const World = Parent * Local;
+		vecType const p = World * vecType(1.0f, 2.0f, 1.0f);
+		vecType const q = glm::affineInverse(World) * vecType(-3.0f, 0.5f, 1.0f);
+		O[i] = glm::vec2(p.x + q.x, p.y + q.y);
+	}
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+// The same work with 4x4 matrices, the usual way to get SIMD for 2D transforms
+static int launch_mat4_2d(std::vector<glm::vec2>& O, std::size_t Samples)
+{
+	std::vector<aligned_mat4> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = glm::rotate(glm::translate(aligned_mat4(1.0f), aligned_vec3(static_cast<float>(i % 7), static_cast<float>(i % 5), 0.0f)), static_cast<float>(i % 11), aligned_vec3(0.0f, 0.0f, 1.0f));
+	aligned_mat4 const Parent = glm::rotate(glm::translate(aligned_mat4(1.0f), aligned_vec3(10.0f, -4.0f, 0.0f)), 0.3f, aligned_vec3(0.0f, 0.0f, 1.0f));
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const t = static_cast<float>(i) * 0.001f;
+		aligned_mat4 Local = glm::translate(I[i], aligned_vec3(t, 1.0f - t, 0.0f));
+		Local = glm::scale(Local, aligned_vec3(2.0f, 0.5f + t, 1.0f));
+
+		aligned_mat4 const World = Parent * Local;
+		aligned_vec4 const p = World * aligned_vec4(1.0f, 2.0f, 0.0f, 1.0f);
+		aligned_vec4 const q = glm::affineInverse(World) * aligned_vec4(-3.0f, 0.5f, 0.0f, 1.0f);
+		O[i] = glm::vec2(p.x + q.x, p.y + q.y);
+	}
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int comp_2d(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::vec2> SISD;
+	std::printf("- SISD mat3: %d us\n", launch_mat3_2d<glm::mat3, glm::vec3, glm::vec2>(SISD, Samples));
+
+	std::vector<glm::vec2> SIMD;
+	std::printf("- SIMD mat3: %d us\n", launch_mat3_2d<aligned_mat3, aligned_vec3, aligned_vec2>(SIMD, Samples));
+
+	std::vector<glm::vec2> SIMD4;
+	std::printf("- SIMD mat4: %d us\n", launch_mat4_2d(SIMD4, Samples));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += SIMD[i] == SISD[i] ? 0 : 1;
+		Error += glm::all(glm::equal(SIMD4[i], SISD[i], 1e-3f)) ? 0 : 1;
+	}
+
+	return Error > 0 ? 1 : 0;
+}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	int Error = 0;
+
+	std::printf("2D transform, inverse and points:\n");
+	Error += comp_2d(Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
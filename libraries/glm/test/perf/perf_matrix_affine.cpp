@@ -0,0 +1,220 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_decompose.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef glm::mat<4, 4, float, glm::aligned_highp> aligned_mat4;
+typedef glm::vec<3, float, glm::aligned_highp> aligned_vec3;
+typedef glm::qua<float, glm::aligned_highp> aligned_quat;
+
+// Placements of scene nodes: translation, rotation and non uniform scale
+template <typename vecType, typename quatType>
+static void make_placements(std::vector<vecType>& T, std::vector<quatType>& R, std::vector<vecType>& S, std::size_t Samples)
+{
+	T.resize(Samples);
+	R.resize(Samples);
+	S.resize(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const t = static_cast<float>(i % 1000);
+		T[i] = vecType(t - 500.0f, 2.0f, t * 0.25f);
+		R[i] = quatType(glm::angleAxis(t * 0.37f, glm::normalize(glm::vec3(glm::sin(t * 0.11f), glm::cos(t * 0.23f), 0.5f))));
+		S[i] = vecType(1.0f + t * 0.001f, 0.5f, 2.0f);
+	}
+}
+
+template <typename matType, typename vecType, typename quatType>
+static int launch_product(std::vector<matType>& O, std::size_t Samples)
+{
+	std::vector<vecType> T, S;
+	std::vector<quatType> R;
+	make_placements(T, R, S, Samples);
+	O.resize(Samples);
+
+	matType const I(1.0f);
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = glm::translate(I, T[i]) * glm::mat4_cast(R[i]) * glm::scale(I, S[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename matType, typename vecType, typename quatType>
+static int launch_compose(std::vector<matType>& O, std::size_t Samples)
+{
+	std::vector<vecType> T, S;
+	std::vector<quatType> R;
+	make_placements(T, R, S, Samples);
+	O.resize(Samples);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = glm::composeTRS(T[i], R[i], S[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename matType, bool Affine>
+static int launch_inverse(std::vector<matType> const& I, std::vector<matType>& O)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0, n = I.size(); i < n; ++i)
+		O[i] = Affine ? glm::affineInverse(I[i]) : glm::inverse(I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int launch_decompose(std::vector<glm::mat4> const& I, std::vector<glm::vec3>& S, std::vector<glm::quat>& R)
+{
+	S.resize(I.size(), glm::vec3(0.0f));
+	R.resize(I.size(), glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0, n = I.size(); i < n; ++i)
+	{
+		glm::vec3 Scale, Translation, Skew;
+		glm::quat Orientation;
+		glm::vec4 Perspective;
+		if(!glm::decompose(I[i], Scale, Orientation, Translation, Skew, Perspective))
+			continue;
+		S[i] = Scale;
+		R[i] = Orientation;
+	}
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int launch_decompose_trs(std::vector<glm::mat4> const& I, std::vector<glm::vec3>& S, std::vector<glm::quat>& R)
+{
+	S.resize(I.size(), glm::vec3(0.0f));
+	R.resize(I.size(), glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0, n = I.size(); i < n; ++i)
+	{
+		glm::vec3 Scale, Translation;
+		glm::quat Orientation;
+		if(!glm::decomposeTRS(I[i], Translation, Orientation, Scale))
+			continue;
+		S[i] = Scale;
+		R[i] = Orientation;
+	}
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int comp_compose(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> Product;
+	std::printf("- SISD T * R * S: %d us\n", launch_product<glm::mat4, glm::vec3, glm::quat>(Product, Samples));
+
+	std::vector<glm::mat4> SISD;
+	std::printf("- SISD composeTRS: %d us\n", launch_compose<glm::mat4, glm::vec3, glm::quat>(SISD, Samples));
+
+	std::vector<aligned_mat4> SIMD;
+	std::printf("- SIMD composeTRS: %d us\n", launch_compose<aligned_mat4, aligned_vec3, aligned_quat>(SIMD, Samples));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += SISD[i] == Product[i] ? 0 : 1;
+		Error += glm::mat4(SIMD[i]) == Product[i] ? 0 : 1;
+	}
+
+	return Error > 0 ? 1 : 0;
+}
+
+static int comp_inverse(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> I;
+	launch_compose<glm::mat4, glm::vec3, glm::quat>(I, Samples);
+	std::vector<aligned_mat4> const AlignedI(I.begin(), I.end());
+
+	std::vector<glm::mat4> SISD;
+	std::printf("- SISD inverse: %d us\n", launch_inverse<glm::mat4, false>(I, SISD));
+
+	std::vector<aligned_mat4> SIMD;
+	std::printf("- SIMD inverse: %d us\n", launch_inverse<aligned_mat4, false>(AlignedI, SIMD));
+
+	std::vector<glm::mat4> SISDAffine;
+	std::printf("- SISD affineInverse: %d us\n", launch_inverse<glm::mat4, true>(I, SISDAffine));
+
+	std::vector<aligned_mat4> SIMDAffine;
+	std::printf("- SIMD affineInverse: %d us\n", launch_inverse<aligned_mat4, true>(AlignedI, SIMDAffine));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::mat4(SIMDAffine[i]) == SISDAffine[i] ? 0 : 1;
+		Error += glm::all(glm::equal(SISDAffine[i], SISD[i], 1e-2f)) ? 0 : 1;
+	}
+
+	return Error > 0 ? 1 : 0;
+}
+
+static int comp_decompose(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> I;
+	launch_compose<glm::mat4, glm::vec3, glm::quat>(I, Samples);
+
+	std::vector<glm::vec3> GeneralScale;
+	std::vector<glm::quat> GeneralOrientation;
+	std::printf("- decompose: %d us\n", launch_decompose(I, GeneralScale, GeneralOrientation));
+
+	std::vector<glm::vec3> Scale;
+	std::vector<glm::quat> Orientation;
+	std::printf("- decomposeTRS: %d us\n", launch_decompose_trs(I, Scale, Orientation));
+
+	// q and -q are the same rotation
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::equal(Scale[i], GeneralScale[i], 1e-4f)) ? 0 : 1;
+		Error += glm::abs(glm::dot(Orientation[i], GeneralOrientation[i])) > 0.9999f ? 0 : 1;
+	}
+
+	return Error > 0 ? 1 : 0;
+}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	int Error = 0;
+
+	std::printf("translate * rotate * scale:\n");
+	Error += comp_compose(Samples);
+
+	std::printf("inverse(mat4) of placements:\n");
+	Error += comp_inverse(Samples);
+
+	std::printf("decompose(mat4) of placements:\n");
+	Error += comp_decompose(Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
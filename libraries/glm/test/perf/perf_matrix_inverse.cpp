@@ -1,5 +1,6 @@
 #define GLM_FORCE_INLINE
 #include <glm/matrix.hpp>
+#include <glm/common.hpp>
 #include <glm/ext/matrix_float4x4.hpp>
 #include <glm/ext/matrix_double4x4.hpp>
 #include <glm/ext/matrix_relational.hpp>
@@ -36,6 +37,25 @@ static int launch_mat_inverse(std::vector<matType>& O, matType const& Scale, std
 	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
 }
 
+template <typename matType>
+static int launch_mat_determinant(std::vector<typename matType::value_type>& O, matType const& Scale, std::size_t Samples)
+{
+	typedef typename matType::value_type T;
+
+	std::vector<matType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = Scale * static_cast<T>(i) + Scale;
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = glm::determinant(I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
 template <typename packedMatType, typename alignedMatType>
 static int comp_mat2_inverse(std::size_t Samples)
 {
@@ -89,10 +109,8 @@ static int comp_mat3_inverse(std::size_t Samples)
 }
 
 template <typename packedMatType, typename alignedMatType>
-static int comp_mat4_inverse(std::size_t Samples)
+static int comp_mat4_inverse(std::size_t Samples, typename packedMatType::value_type Epsilon)
 {
-	typedef typename packedMatType::value_type T;
-	
 	int Error = 0;
 
 	packedMatType const Scale(0.01, 0.02, 0.05, 0.04, 0.02, 0.08, 0.05, 0.01, 0.08, 0.03, 0.05, 0.06, 0.02, 0.03, 0.07, 0.05);
@@ -107,16 +125,37 @@ static int comp_mat4_inverse(std::size_t Samples)
 	{
 		packedMatType const A = SISD[i];
 		packedMatType const B = SIMD[i];
-		Error += glm::all(glm::equal(A, B, static_cast<T>(0.001))) ? 0 : 1;
+		Error += glm::all(glm::equal(A, B, Epsilon)) ? 0 : 1;
 		assert(!Error);
 	}
 	
 	return Error;
 }
 
+template <typename packedMatType, typename alignedMatType>
+static int comp_mat4_determinant(std::size_t Samples, typename packedMatType::value_type Epsilon)
+{
+	typedef typename packedMatType::value_type T;
+
+	int Error = 0;
+
+	packedMatType const Scale(0.01, 0.02, 0.05, 0.04, 0.02, 0.08, 0.05, 0.01, 0.08, 0.03, 0.05, 0.06, 0.02, 0.03, 0.07, 0.05);
+
+	std::vector<T> SISD;
+	std::printf("- SISD: %d us\n", launch_mat_determinant<packedMatType>(SISD, Scale, Samples));
+
+	std::vector<T> SIMD;
+	std::printf("- SIMD: %d us\n", launch_mat_determinant<alignedMatType>(SIMD, alignedMatType(Scale), Samples));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::abs(SISD[i] - SIMD[i]) <= Epsilon * glm::abs(SISD[i]) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
-	std::size_t const Samples = 10;
+	std::size_t const Samples = 10000;
 
 	int Error = 0;
 
@@ -133,12 +172,19 @@ int main()
 	Error += comp_mat3_inverse<glm::dmat3, glm::aligned_dmat3>(Samples);
 
 	std::printf("glm::inverse(mat4):\n");
-	Error += comp_mat4_inverse<glm::mat4, glm::aligned_mat4>(Samples);
-	
+	Error += comp_mat4_inverse<glm::mat4, glm::aligned_mat4>(Samples, 0.001f);
+
+	// The AVX kernels keep the scalar operation order, so double results are exact
 	std::printf("glm::inverse(dmat4):\n");
-	Error += comp_mat4_inverse<glm::dmat4, glm::aligned_dmat4>(Samples);
+	Error += comp_mat4_inverse<glm::dmat4, glm::aligned_dmat4>(Samples, 0.0);
 
-	return Error;
+	std::printf("glm::determinant(mat4):\n");
+	Error += comp_mat4_determinant<glm::mat4, glm::aligned_mat4>(Samples, 0.001f);
+
+	std::printf("glm::determinant(dmat4):\n");
+	Error += comp_mat4_determinant<glm::dmat4, glm::aligned_dmat4>(Samples, 0.0);
+
+	return Error > 0 ? 1 : 0;
 }
 
 #else
@@ -92,10 +92,8 @@ static int comp_mat3_mul_mat3(std::size_t Samples)
 }
 
 template <typename packedMatType, typename alignedMatType>
-static int comp_mat4_mul_mat4(std::size_t Samples)
+static int comp_mat4_mul_mat4(std::size_t Samples, typename packedMatType::value_type Epsilon)
 {
-	typedef typename packedMatType::value_type T;
-	
 	int Error = 0;
 
 	packedMatType const Transform(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
@@ -111,7 +109,7 @@ static int comp_mat4_mul_mat4(std::size_t Samples)
 	{
 		packedMatType const A = SISD[i];
 		packedMatType const B = SIMD[i];
-		Error += glm::all(glm::equal(A, B, static_cast<T>(0.001))) ? 0 : 1;
+		Error += glm::all(glm::equal(A, B, Epsilon)) ? 0 : 1;
 	}
 	
 	return Error;
@@ -136,10 +134,11 @@ int main()
 	Error += comp_mat3_mul_mat3<glm::dmat3, glm::aligned_dmat3>(Samples);
 
 	std::printf("mat4 * mat4:\n");
-	Error += comp_mat4_mul_mat4<glm::mat4, glm::aligned_mat4>(Samples);
-	
+	Error += comp_mat4_mul_mat4<glm::mat4, glm::aligned_mat4>(Samples, 0.001f);
+
+	// The AVX kernel adds in the same order as the scalar code
 	std::printf("dmat4 * dmat4:\n");
-	Error += comp_mat4_mul_mat4<glm::dmat4, glm::aligned_dmat4>(Samples);
+	Error += comp_mat4_mul_mat4<glm::dmat4, glm::aligned_dmat4>(Samples, 0.0);
 
 	return Error;
 }
@@ -0,0 +1,96 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/noise.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+// A 4096 x 4096 field, the size of a large generated texture
+static std::size_t const Size = 4096;
+static glm::vec2 const Origin(-3.5f, 11.25f);
+static glm::vec2 const Step(1.0f / 256.0f);
+
+// What a caller would write without the grid API
+static int launch_sisd(std::vector<float>& Field, bool Simplex)
+{
+	Field.resize(Size * Size);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t y = 0; y < Size; ++y)
+	for(std::size_t x = 0; x < Size; ++x)
+	{
+		glm::vec2 const Position(Origin + Step * glm::vec2(static_cast<float>(x), static_cast<float>(y)));
+		Field[y * Size + x] = Simplex ? glm::simplex(Position) : glm::perlin(Position);
+	}
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static void fill_rows(std::vector<float>* Field, bool Simplex, std::size_t RowBegin, std::size_t RowEnd)
+{
+	if(Simplex)
+		glm::simplexGrid(Origin, Step, Size, RowBegin, RowEnd, &(*Field)[0]);
+	else
+		glm::perlinGrid(Origin, Step, Size, RowBegin, RowEnd, &(*Field)[0]);
+}
+
+// One band of rows per thread, the calling thread filling the last one
+static int launch_grid(std::vector<float>& Field, bool Simplex, unsigned int ThreadCount)
+{
+	Field.resize(Size * Size);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	std::vector<std::thread> Threads;
+	for(std::size_t b = 0; b + 1 < ThreadCount; ++b)
+		Threads.push_back(std::thread(fill_rows, &Field, Simplex, Size * b / ThreadCount, Size * (b + 1) / ThreadCount));
+	fill_rows(&Field, Simplex, Size * (ThreadCount - 1) / ThreadCount, Size);
+	for(std::size_t b = 0; b < Threads.size(); ++b)
+		Threads[b].join();
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int comp_grid(bool Simplex)
+{
+	int Error = 0;
+
+	std::vector<float> SISD;
+	std::printf("- SISD: %d us\n", launch_sisd(SISD, Simplex));
+
+	std::vector<float> Grid;
+	std::printf("- SIMD, 1 thread: %d us\n", launch_grid(Grid, Simplex, 1));
+	for(std::size_t i = 0; i < Size * Size; ++i)
+		Error += Grid[i] == SISD[i] ? 0 : 1;
+
+	unsigned int const ThreadCount = glm::max(std::thread::hardware_concurrency(), 1u);
+	std::printf("- SIMD, %u hardware threads: %d us\n", ThreadCount, launch_grid(Grid, Simplex, ThreadCount));
+	for(std::size_t i = 0; i < Size * Size; ++i)
+		Error += Grid[i] == SISD[i] ? 0 : 1;
+
+	return Error > 0 ? 1 : 0;
+}
+
+int main()
+{
+	int Error = 0;
+
+	std::printf("perlin(vec2) 4096 x 4096:\n");
+	Error += comp_grid(false);
+
+	std::printf("simplex(vec2) 4096 x 4096:\n");
+	Error += comp_grid(true);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,104 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/vector_float4.hpp>
+#include <glm/gtc/packing.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template <typename inType, typename outType, typename funcType>
+static int launch_span_func(std::vector<inType> const& I, std::vector<outType>& O, funcType Func)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	Func(&I[0], &O[0], I.size());
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename inType, typename outType, typename sisdFuncType, typename simdFuncType>
+static int comp_span_func(std::vector<inType> const& I, sisdFuncType SISDFunc, simdFuncType SIMDFunc)
+{
+	int Error = 0;
+
+	std::vector<outType> SISD;
+	std::printf("- SISD: %d us\n", launch_span_func(I, SISD, SISDFunc));
+
+	std::vector<outType> SIMD;
+	std::printf("- SIMD: %d us\n", launch_span_func(I, SIMD, SIMDFunc));
+
+	for(std::size_t i = 0; i < I.size(); ++i)
+		Error += SISD[i] == SIMD[i] ? 0 : 1;
+
+	return Error > 0 ? 1 : 0;
+}
+
+// The scalar kernels, applied like the span functions apply the SIMD ones
+template <typename kernelType, typename inType, typename outType>
+static void span_sisd(inType const* In, outType* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = kernelType::call(In[i]);
+}
+
+static void packUnorm4x8_simd(glm::vec4 const* In, glm::uint32* Out, std::size_t Count) { glm::packUnorm4x8(In, Out, Count); }
+static void packSnorm4x16_simd(glm::vec4 const* In, glm::uint64* Out, std::size_t Count) { glm::packSnorm4x16(In, Out, Count); }
+static void packHalf4x16_simd(glm::vec4 const* In, glm::uint64* Out, std::size_t Count) { glm::packHalf4x16(In, Out, Count); }
+static void unpackUnorm4x8_simd(glm::uint32 const* In, glm::vec4* Out, std::size_t Count) { glm::unpackUnorm4x8(In, Out, Count); }
+static void unpackHalf4x16_simd(glm::uint64 const* In, glm::vec4* Out, std::size_t Count) { glm::unpackHalf4x16(In, Out, Count); }
+
+int main()
+{
+	std::size_t const Samples = 1000000;
+
+	std::vector<glm::vec4> Colors(Samples);
+	std::vector<glm::vec4> Normals(Samples);
+	std::vector<glm::vec4> Positions(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const t = static_cast<float>(i);
+		Colors[i] = glm::vec4(0.001f, 0.002f, 0.003f, 0.0005f) * t - glm::floor(glm::vec4(0.001f, 0.002f, 0.003f, 0.0005f) * t);
+		Normals[i] = Colors[i] * 2.0f - 1.0f;
+		Positions[i] = glm::vec4(0.01f, -0.02f, 0.03f, 1.0f) * t;
+	}
+
+	std::vector<glm::uint32> Packed32(Samples);
+	glm::packUnorm4x8(&Colors[0], &Packed32[0], Samples);
+	std::vector<glm::uint64> Packed64(Samples);
+	glm::packHalf4x16(&Positions[0], &Packed64[0], Samples);
+
+	int Error = 0;
+
+	std::printf("packUnorm4x8:\n");
+	Error += comp_span_func<glm::vec4, glm::uint32>(Colors,
+		span_sisd<glm::detail::compute_packUnorm4x8<false>, glm::vec4, glm::uint32>, packUnorm4x8_simd);
+
+	std::printf("packSnorm4x16:\n");
+	Error += comp_span_func<glm::vec4, glm::uint64>(Normals,
+		span_sisd<glm::detail::compute_packSnorm4x16<false>, glm::vec4, glm::uint64>, packSnorm4x16_simd);
+
+	std::printf("packHalf4x16:\n");
+	Error += comp_span_func<glm::vec4, glm::uint64>(Positions,
+		span_sisd<glm::detail::compute_packHalf4x16<false>, glm::vec4, glm::uint64>, packHalf4x16_simd);
+
+	std::printf("unpackUnorm4x8:\n");
+	Error += comp_span_func<glm::uint32, glm::vec4>(Packed32,
+		span_sisd<glm::detail::compute_unpackUnorm4x8<false>, glm::uint32, glm::vec4>, unpackUnorm4x8_simd);
+
+	std::printf("unpackHalf4x16:\n");
+	Error += comp_span_func<glm::uint64, glm::vec4>(Packed64,
+		span_sisd<glm::detail::compute_unpackHalf4x16<false>, glm::uint64, glm::vec4>, unpackHalf4x16_simd);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
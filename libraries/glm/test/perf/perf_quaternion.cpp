@@ -0,0 +1,175 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/quaternion.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef glm::qua<float, glm::aligned_highp> aligned_quat;
+typedef glm::vec<3, float, glm::aligned_highp> aligned_vec3;
+
+template <typename quatType>
+static quatType make_quat(std::size_t i)
+{
+	float const t = static_cast<float>(i);
+	return quatType(glm::angleAxis(t * 0.37f - 3.0f, glm::normalize(glm::vec3(glm::sin(t * 0.11f), glm::cos(t * 0.23f), 0.5f))));
+}
+
+template <typename quatType>
+static int launch_quat_mul(std::vector<quatType>& O, std::size_t Samples)
+{
+	std::vector<quatType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = make_quat<quatType>(i);
+
+	// A chain of local rotations, like the walk down a skeleton
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	O[0] = I[0];
+	for(std::size_t i = 1; i < Samples; ++i)
+		O[i] = I[i] * I[i - 1];
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename quatType, typename vecType>
+static int launch_quat_rotate(std::vector<vecType>& O, std::size_t Samples)
+{
+	std::vector<quatType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = make_quat<quatType>(i);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = I[i] * vecType(1.0f, 2.0f, 3.0f);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename quatType>
+static int launch_quat_slerp(std::vector<quatType>& O, std::size_t Samples)
+{
+	std::vector<quatType> X(Samples);
+	std::vector<quatType> Y(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		X[i] = make_quat<quatType>(i);
+		Y[i] = make_quat<quatType>(i * 7 + 3);
+	}
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = glm::slerp(X[i], Y[i], 0.25f);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int launch_quat_slerp_span(std::vector<glm::quat>& O, std::size_t Samples)
+{
+	std::vector<glm::quat> X(Samples);
+	std::vector<glm::quat> Y(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		X[i] = make_quat<glm::quat>(i);
+		Y[i] = make_quat<glm::quat>(i * 7 + 3);
+	}
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	glm::slerp(&X[0], &Y[0], 0.25f, &O[0], Samples);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int comp_quat_mul(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::quat> SISD;
+	std::printf("- SISD: %d us\n", launch_quat_mul<glm::quat>(SISD, Samples));
+
+	std::vector<aligned_quat> SIMD;
+	std::printf("- SIMD: %d us\n", launch_quat_mul<aligned_quat>(SIMD, Samples));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::quat(SIMD[i]) == SISD[i] ? 0 : 1;
+
+	return Error > 0 ? 1 : 0;
+}
+
+static int comp_quat_rotate(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> SISD;
+	std::printf("- SISD: %d us\n", launch_quat_rotate<glm::quat>(SISD, Samples));
+
+	std::vector<aligned_vec3> SIMD;
+	std::printf("- SIMD: %d us\n", launch_quat_rotate<aligned_quat>(SIMD, Samples));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::vec3(SIMD[i]) == SISD[i] ? 0 : 1;
+
+	return Error > 0 ? 1 : 0;
+}
+
+static int comp_quat_slerp(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::quat> SISD;
+	std::printf("- SISD: %d us\n", launch_quat_slerp<glm::quat>(SISD, Samples));
+
+	std::vector<aligned_quat> SIMD;
+	std::printf("- SIMD: %d us\n", launch_quat_slerp<aligned_quat>(SIMD, Samples));
+
+	std::vector<glm::quat> Span;
+	std::printf("- SIMD span: %d us\n", launch_quat_slerp_span(Span, Samples));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::equal(glm::quat(SIMD[i]), SISD[i], 1e-6f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Span[i], SISD[i], 1e-6f)) ? 0 : 1;
+	}
+
+	return Error > 0 ? 1 : 0;
+}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	int Error = 0;
+
+	std::printf("quat * quat:\n");
+	Error += comp_quat_mul(Samples);
+
+	std::printf("quat * vec3:\n");
+	Error += comp_quat_rotate(Samples);
+
+	std::printf("slerp(quat, quat, float):\n");
+	Error += comp_quat_slerp(Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
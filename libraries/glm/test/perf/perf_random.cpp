@@ -0,0 +1,157 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/random.hpp>
+#include <glm/glm.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+static std::size_t const Samples = 1 << 22;
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+static int elapsed(clock_type::time_point t1, clock_type::time_point t2)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+// Millions of samples per second on the calling thread
+static void report(char const* Name, int Time)
+{
+	std::printf("- %s: %d us, %.1f M samples/s\n", Name, Time, static_cast<double>(Samples) / static_cast<double>(Time > 0 ? Time : 1));
+}
+
+static int comp_linearRand()
+{
+	int Error = 0;
+
+	std::vector<float> Values(Samples);
+
+	clock_type::time_point t1 = clock_type::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Values[i] = glm::linearRand(-1.0f, 1.0f);
+	clock_type::time_point t2 = clock_type::now();
+	report("SISD, std::rand", elapsed(t1, t2));
+
+	glm::xoshiro128 Generator(1);
+	t1 = clock_type::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Values[i] = glm::linearRand(Generator, -1.0f, 1.0f);
+	t2 = clock_type::now();
+	report("SISD, xoshiro128", elapsed(t1, t2));
+
+	std::vector<float> Batch(Samples);
+	glm::xoshiro128 Same(1);
+	t1 = clock_type::now();
+	glm::linearRand(Same, -1.0f, 1.0f, &Batch[0], Samples);
+	t2 = clock_type::now();
+	report("SIMD, xoshiro128", elapsed(t1, t2));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += Batch[i] == Values[i] ? 0 : 1;
+
+	return Error > 0 ? 1 : 0;
+}
+
+static int comp_gaussRand()
+{
+	std::vector<float> Values(Samples);
+
+	clock_type::time_point t1 = clock_type::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Values[i] = glm::gaussRand(0.0f, 1.0f);
+	clock_type::time_point t2 = clock_type::now();
+	report("SISD, std::rand", elapsed(t1, t2));
+
+	glm::xoshiro128 Generator(2);
+	t1 = clock_type::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Values[i] = glm::gaussRand(Generator, 0.0f, 1.0f);
+	t2 = clock_type::now();
+	report("SISD, xoshiro128", elapsed(t1, t2));
+
+	t1 = clock_type::now();
+	glm::gaussRand(Generator, 0.0f, 1.0f, &Values[0], Samples);
+	t2 = clock_type::now();
+	report("SIMD, xoshiro128", elapsed(t1, t2));
+
+	return 0;
+}
+
+static int comp_ballRand()
+{
+	std::vector<glm::vec3> Values(Samples, glm::vec3(0));
+
+	clock_type::time_point t1 = clock_type::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Values[i] = glm::ballRand(1.0f);
+	clock_type::time_point t2 = clock_type::now();
+	report("SISD, std::rand", elapsed(t1, t2));
+
+	glm::xoshiro128 Generator(3);
+	t1 = clock_type::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Values[i] = glm::ballRand(Generator, 1.0f);
+	t2 = clock_type::now();
+	report("SISD, xoshiro128", elapsed(t1, t2));
+
+	t1 = clock_type::now();
+	glm::ballRand(Generator, 1.0f, &Values[0], Samples);
+	t2 = clock_type::now();
+	report("SIMD, xoshiro128", elapsed(t1, t2));
+
+	return 0;
+}
+
+static int comp_diskRand()
+{
+	std::vector<glm::vec2> Values(Samples, glm::vec2(0));
+
+	clock_type::time_point t1 = clock_type::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Values[i] = glm::diskRand(1.0f);
+	clock_type::time_point t2 = clock_type::now();
+	report("SISD, std::rand", elapsed(t1, t2));
+
+	glm::xoshiro128 Generator(4);
+	t1 = clock_type::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Values[i] = glm::diskRand(Generator, 1.0f);
+	t2 = clock_type::now();
+	report("SISD, xoshiro128", elapsed(t1, t2));
+
+	t1 = clock_type::now();
+	glm::diskRand(Generator, 1.0f, &Values[0], Samples);
+	t2 = clock_type::now();
+	report("SIMD, xoshiro128", elapsed(t1, t2));
+
+	return 0;
+}
+
+int main()
+{
+	int Error = 0;
+
+	std::printf("linearRand(float) x %d:\n", static_cast<int>(Samples));
+	Error += comp_linearRand();
+
+	std::printf("gaussRand(float) x %d:\n", static_cast<int>(Samples));
+	Error += comp_gaussRand();
+
+	std::printf("diskRand(float) x %d:\n", static_cast<int>(Samples));
+	Error += comp_diskRand();
+
+	std::printf("ballRand(float) x %d:\n", static_cast<int>(Samples));
+	Error += comp_ballRand();
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
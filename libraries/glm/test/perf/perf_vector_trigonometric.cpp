@@ -0,0 +1,82 @@
+#define GLM_FORCE_INLINE
+#define GLM_FORCE_SIMD_TRIGONOMETRIC
+#include <glm/trigonometric.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template <typename vecType, typename funcType>
+static int launch_vec_func(std::vector<vecType>& O, funcType Func, std::size_t Samples)
+{
+	std::vector<vecType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = vecType(0.001f, -0.002f, 0.003f, 0.0005f) * static_cast<float>(i);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = Func(I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename packedFuncType, typename alignedFuncType>
+static int comp_vec4_func(packedFuncType PackedFunc, alignedFuncType AlignedFunc, std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::vec4> SISD;
+	std::printf("- SISD: %d us\n", launch_vec_func<glm::vec4>(SISD, PackedFunc, Samples));
+
+	std::vector<glm::aligned_vec4> SIMD;
+	std::printf("- SIMD: %d us\n", launch_vec_func<glm::aligned_vec4>(SIMD, AlignedFunc, Samples));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::vec4 const A = SISD[i];
+		glm::vec4 const B = SIMD[i];
+		Error += glm::all(glm::equal(A, B, 0.0001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static glm::vec4 sin_packed(glm::vec4 const& v) { return glm::sin(v); }
+static glm::aligned_vec4 sin_aligned(glm::aligned_vec4 const& v) { return glm::sin(v); }
+static glm::vec4 cos_packed(glm::vec4 const& v) { return glm::cos(v); }
+static glm::aligned_vec4 cos_aligned(glm::aligned_vec4 const& v) { return glm::cos(v); }
+static glm::vec4 atan_packed(glm::vec4 const& v) { return glm::atan(v); }
+static glm::aligned_vec4 atan_aligned(glm::aligned_vec4 const& v) { return glm::atan(v); }
+
+int main()
+{
+	std::size_t const Samples = 1000000;
+
+	int Error = 0;
+
+	std::printf("sin(vec4):\n");
+	Error += comp_vec4_func(sin_packed, sin_aligned, Samples);
+
+	std::printf("cos(vec4):\n");
+	Error += comp_vec4_func(cos_packed, cos_aligned, Samples);
+
+	std::printf("atan(vec4):\n");
+	Error += comp_vec4_func(atan_packed, atan_aligned, Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
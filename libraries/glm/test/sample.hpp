@@ -0,0 +1,38 @@
+/// @file test/sample.hpp
+///
+/// Sample values shared by the tests and benchmarks that compare a SIMD or
+/// batch path against the scalar code on the same inputs, and the exit status
+/// of those that count their errors per sample.
+/// Include after the GLM_FORCE_* defines of the including test.
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// A translation, a rotation about a varying axis and a non uniform scale
+inline glm::mat4 make_matrix(int i)
+{
+	float const t = static_cast<float>(i);
+	glm::mat4 const m = glm::translate(glm::mat4(1.0f), glm::vec3(t * 0.5f, -2.0f, 3.0f + t));
+	return glm::scale(glm::rotate(m, t * 0.1f, glm::normalize(glm::vec3(1.0f, t, 2.0f))), glm::vec3(1.5f, 0.5f, 2.0f));
+}
+
+inline glm::vec4 make_vec(std::size_t i)
+{
+	float const t = static_cast<float>(i);
+	return glm::vec4(glm::sin(t * 0.3f) * 10.0f, t * 0.01f - 3.0f, glm::cos(t * 0.7f), 0.5f + t * 0.001f);
+}
+
+inline glm::quat make_orientation(int i)
+{
+	float const t = static_cast<float>(i);
+	return glm::angleAxis(t * 0.37f - 3.0f, glm::normalize(glm::vec3(glm::sin(t * 0.11f), glm::cos(t * 0.23f), 0.5f)));
+}
+
+// Errors counted per sample can exceed the 8 bits an exit code keeps
+inline int exit_status(int Error)
+{
+	return Error > 0 ? 1 : 0;
+}
@@ -12,9 +12,24 @@
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 
+#include "./mglAnimation.hpp"    // IWYU pragma: keep
+#include "./mglArena.hpp"        // IWYU pragma: keep
 #include "./mglApp.hpp"          // IWYU pragma: keep
+#include "./mglCamera.hpp"       // IWYU pragma: keep
+#include "./mglCommand.hpp"      // IWYU pragma: keep
 #include "./mglConventions.hpp"  // IWYU pragma: keep
+#include "./mglCulling.hpp"      // IWYU pragma: keep
 #include "./mglError.hpp"        // IWYU pragma: keep
+#include "./mglGpuCulling.hpp"   // IWYU pragma: keep
+#include "./mglInput.hpp"        // IWYU pragma: keep
+#include "./mglJob.hpp"          // IWYU pragma: keep
+#include "./mglLoader.hpp"       // IWYU pragma: keep
+#include "./mglMesh.hpp"         // IWYU pragma: keep
+#include "./mglPack.hpp"         // IWYU pragma: keep
+#include "./mglResource.hpp"     // IWYU pragma: keep
+#include "./mglRing.hpp"         // IWYU pragma: keep
 #include "./mglShader.hpp"       // IWYU pragma: keep
+#include "./mglTimer.hpp"        // IWYU pragma: keep
+#include "./mglVertex.hpp"       // IWYU pragma: keep
 
 #endif /* MGL_HPP */
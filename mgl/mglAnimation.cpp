@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Keyframe Animation
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#define GLM_ENABLE_EXPERIMENTAL
+#endif
+
+#include "./mglAnimation.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+#include <glm/gtx/easing.hpp>
+
+namespace mgl {
+
+///////////////////////////////////////////////////////////////////////// Easing
+
+float ease(Easing easing, float t) {
+  switch (easing) {
+  case Easing::Step:
+    return 0.0f;
+  case Easing::Linear:
+    return t;
+  case Easing::QuadraticIn:
+    return glm::quadraticEaseIn(t);
+  case Easing::QuadraticOut:
+    return glm::quadraticEaseOut(t);
+  case Easing::QuadraticInOut:
+    return glm::quadraticEaseInOut(t);
+  case Easing::CubicIn:
+    return glm::cubicEaseIn(t);
+  case Easing::CubicOut:
+    return glm::cubicEaseOut(t);
+  case Easing::CubicInOut:
+    return glm::cubicEaseInOut(t);
+  case Easing::SineIn:
+    return glm::sineEaseIn(t);
+  case Easing::SineOut:
+    return glm::sineEaseOut(t);
+  case Easing::SineInOut:
+    return glm::sineEaseInOut(t);
+  case Easing::BackIn:
+    return glm::backEaseIn(t);
+  case Easing::BackOut:
+    return glm::backEaseOut(t);
+  case Easing::BackInOut:
+    return glm::backEaseInOut(t);
+  case Easing::ElasticOut:
+    return glm::elasticEaseOut(t);
+  case Easing::BounceOut:
+    return glm::bounceEaseOut(t);
+  }
+  return t;
+}
+
+/////////////////////////////////////////////////////////////////////// Animator
+
+GLuint Animator::addTrack(const std::vector<Keyframe> &keys) {
+  if (keys.empty()) {
+    std::cerr << "[ERROR] Animation track has no keyframes" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  const GLuint track = static_cast<GLuint>(KeyBegin.size());
+  KeyBegin.push_back(static_cast<GLuint>(Times.size()));
+  KeyCount.push_back(static_cast<GLuint>(keys.size()));
+  Cursor.push_back(0);
+
+  float last_time = keys.front().Time;
+  for (const Keyframe &k : keys) {
+    if (k.Time < last_time) {
+      std::cerr << "[WARNING] Keyframes of track " << track
+                << " are not sorted by time" << std::endl;
+    }
+    last_time = k.Time;
+    Times.push_back(k.Time);
+    Positions.push_back(k.Position);
+    Rotations.push_back(glm::normalize(k.Rotation));
+    Scales.push_back(k.Scale);
+    Eases.push_back(k.Ease);
+  }
+  return track;
+}
+
+size_t Animator::size() const { return KeyBegin.size(); }
+
+void Animator::clear() {
+  KeyBegin.clear();
+  KeyCount.clear();
+  Cursor.clear();
+  Times.clear();
+  Positions.clear();
+  Rotations.clear();
+  Scales.clear();
+  Eases.clear();
+}
+
+void Animator::rewind() { std::fill(Cursor.begin(), Cursor.end(), 0); }
+
+float Animator::duration(GLuint track) const {
+  const GLuint begin = KeyBegin[track];
+  return Times[begin + KeyCount[track] - 1] - Times[begin];
+}
+
+GLuint Animator::seek(GLuint track, float time) {
+  const float *t = &Times[KeyBegin[track]];
+  const GLuint last = KeyCount[track] - 1;
+  GLuint k = Cursor[track];
+
+  // Coherent playback stays in the cached segment or moves to a neighbour.
+  if (time >= t[k] && (k == last || time < t[k + 1])) {
+    return k;
+  }
+  if (k < last && time >= t[k + 1] && (k + 1 == last || time < t[k + 2])) {
+    return Cursor[track] = k + 1;
+  }
+  if (k > 0 && time >= t[k - 1] && time < t[k]) {
+    return Cursor[track] = k - 1;
+  }
+  const GLuint n =
+      static_cast<GLuint>(std::upper_bound(t, t + last + 1, time) - t);
+  return Cursor[track] = (n == 0) ? 0 : n - 1;
+}
+
+void Animator::sample(float time, glm::mat4 *out) {
+  sample(time, 0, static_cast<GLuint>(size()), out, sizeof(glm::mat4));
+}
+
+void Animator::sample(float time, GLuint first, GLuint count, void *out,
+                      size_t stride) {
+  GLuint from[BATCH], to[BATCH];
+  float u[BATCH];
+  glm::vec3 position[BATCH], scale[BATCH];
+  glm::quat start[BATCH], stop[BATCH], rotation[BATCH];
+
+  char *base = static_cast<char *>(out);
+  const GLuint end = first + count;
+  for (GLuint batch = first; batch < end; batch += BATCH) {
+    const GLuint n = end - batch < BATCH ? end - batch : BATCH;
+
+    // Segment and eased blend factor of each track; a track before its first
+    // or after its last key blends a key with itself.
+    for (GLuint j = 0; j < n; ++j) {
+      const GLuint track = batch + j;
+      const GLuint k = seek(track, time);
+      const GLuint i = KeyBegin[track] + k;
+      from[j] = to[j] = i;
+      u[j] = 0.0f;
+      if (k + 1 < KeyCount[track] && time > Times[i]) {
+        const float span = Times[i + 1] - Times[i];
+        to[j] = i + 1;
+        u[j] = ease(Eases[i], span > 0.0f ? (time - Times[i]) / span : 1.0f);
+      }
+    }
+
+    for (GLuint j = 0; j < n; ++j) {
+      position[j] = glm::mix(Positions[from[j]], Positions[to[j]], u[j]);
+    }
+    for (GLuint j = 0; j < n; ++j) {
+      scale[j] = glm::mix(Scales[from[j]], Scales[to[j]], u[j]);
+    }
+    for (GLuint j = 0; j < n; ++j) {
+      start[j] = Rotations[from[j]];
+      stop[j] = Rotations[to[j]];
+    }
+    glm::slerp(start, stop, u, rotation, n);
+
+    // T * R * S composed directly, no full 4x4 products.
+    for (GLuint j = 0; j < n; ++j) {
+      const glm::mat3 r = glm::mat3_cast(rotation[j]);
+      glm::mat4 &m = *reinterpret_cast<glm::mat4 *>(base + (batch + j) * stride);
+      m[0] = glm::vec4(r[0] * scale[j].x, 0.0f);
+      m[1] = glm::vec4(r[1] * scale[j].y, 0.0f);
+      m[2] = glm::vec4(r[2] * scale[j].z, 0.0f);
+      m[3] = glm::vec4(position[j], 1.0f);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
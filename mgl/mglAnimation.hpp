@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Keyframe Animation
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_ANIMATION_HPP
+#define MGL_ANIMATION_HPP
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <vector>
+
+namespace mgl {
+
+///////////////////////////////////////////////////////////////////////// Easing
+
+enum class Easing : GLubyte {
+  Step,
+  Linear,
+  QuadraticIn,
+  QuadraticOut,
+  QuadraticInOut,
+  CubicIn,
+  CubicOut,
+  CubicInOut,
+  SineIn,
+  SineOut,
+  SineInOut,
+  BackIn,
+  BackOut,
+  BackInOut,
+  ElasticOut,
+  BounceOut
+};
+
+float ease(Easing easing, float t);
+
+/////////////////////////////////////////////////////////////////////// Keyframe
+
+// Easing applies to the segment that starts at this keyframe.
+struct Keyframe {
+  float Time;
+  glm::vec3 Position;
+  glm::quat Rotation;
+  glm::vec3 Scale;
+  Easing Ease;
+};
+
+/////////////////////////////////////////////////////////////////////// Animator
+
+// Keyframes of all tracks are stored in flat parallel arrays (SoA) and each
+// track caches the key segment used by the last sample, so playback that moves
+// to the same, the next or the previous segment finds it in O(1); larger jumps
+// fall back to a binary search.
+// Tracks are sampled in batches of BATCH: segments and eased factors are found
+// for the whole batch first, then positions, scales and rotations are blended
+// over it with straight loops and one span slerp.
+// Tracks are addressed by the index returned by addTrack(), which is also the
+// index of the matrix written by sample().
+
+class Animator {
+public:
+  static const GLuint BATCH = 64;
+
+  GLuint addTrack(const std::vector<Keyframe> &keys);
+  size_t size() const;
+  void clear();
+  void rewind();
+
+  float duration(GLuint track) const;
+
+  // Writes the model matrix of each track at out + track * stride (in bytes),
+  // so matrices can go straight into a mapped, interleaved instance buffer.
+  // The ranged form lets batches of tracks be sampled independently.
+  void sample(float time, glm::mat4 *out);
+  void sample(float time, GLuint first, GLuint count, void *out,
+              size_t stride = sizeof(glm::mat4));
+
+private:
+  std::vector<GLuint> KeyBegin, KeyCount, Cursor;
+
+  std::vector<float> Times;
+  std::vector<glm::vec3> Positions;
+  std::vector<glm::quat> Rotations;
+  std::vector<glm::vec3> Scales;
+  std::vector<Easing> Eases;
+
+  GLuint seek(GLuint track, float time);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_ANIMATION_HPP */
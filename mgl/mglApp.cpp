@@ -9,6 +9,7 @@
 #include "./mglApp.hpp"
 
 #include <iostream>
+#include <thread>
 
 #include "./mglError.hpp" // IWYU pragma: keep -- required in debug mode
 
@@ -17,11 +18,12 @@ namespace mgl {
 /////////////////////////////////////////////////////////////// STATIC CALLBACKS
 
 static void window_close_callback(GLFWwindow *window) {
-  Engine::getInstance().getApp()->windowCloseCallback(window);
+  Engine::getInstance().windowClose();
 }
 
 static void window_size_callback(GLFWwindow *window, int width, int height) {
-  Engine::getInstance().getApp()->windowSizeCallback(window, width, height);
+  Engine::getInstance().input(
+      {InputType::WindowSize, 0, 0.0f, width, height, 0, 0, 0.0, 0.0});
 }
 
 static void glfw_error_callback(int error, const char *description) {
@@ -29,28 +31,31 @@ static void glfw_error_callback(int error, const char *description) {
 }
 
 static void cursor_pos_callback(GLFWwindow *window, double xpos, double ypos) {
-  Engine::getInstance().getApp()->cursorCallback(window, xpos, ypos);
+  Engine::getInstance().input(
+      {InputType::Cursor, 0, 0.0f, 0, 0, 0, 0, xpos, ypos});
 }
 
 static void key_callback(GLFWwindow *window, int key, int scancode, int action,
                          int mods) {
-  Engine::getInstance().getApp()->keyCallback(window, key, scancode, action,
-                                              mods);
+  Engine::getInstance().input(
+      {InputType::Key, 0, 0.0f, key, scancode, action, mods, 0.0, 0.0});
 }
 
 static void mouse_button_callback(GLFWwindow *window, int button, int action,
                                   int mods) {
-  Engine::getInstance().getApp()->mouseButtonCallback(window, button, action,
-                                                      mods);
+  Engine::getInstance().input(
+      {InputType::MouseButton, 0, 0.0f, button, 0, action, mods, 0.0, 0.0});
 }
 
 static void scroll_callback(GLFWwindow *window, double xoffset,
                             double yoffset) {
-  Engine::getInstance().getApp()->scrollCallback(window, xoffset, yoffset);
+  Engine::getInstance().input(
+      {InputType::Scroll, 0, 0.0f, 0, 0, 0, 0, xoffset, yoffset});
 }
 
 static void joystick_callback(int jid, int event) {
-  Engine::getInstance().getApp()->joystickCallback(jid, event);
+  Engine::getInstance().input(
+      {InputType::Joystick, 0, 0.0f, jid, event, 0, 0, 0.0, 0.0});
 }
 
 ////////////////////////////////////////////////////////////////////////// SETUP
@@ -61,6 +66,11 @@ Engine::Engine(void) {
   WindowWidth = 640, WindowHeight = 480;
   GlMajor = 3, GlMinor = 3;
   Fullscreen = 0, Vsync = 0;
+  FixedTimestep = 0.0, StartTime = 0.0;
+  Frame = 0;
+  HasPendingCursor = false, InputDispatch = true;
+  RenderThread = false, CloseRequested = false;
+  Submitted = 0, Executed = 0, Quit = false;
   WindowTitle = "OpenGL App GLFW Window 2024(c) Carlos Martinho";
 }
 
@@ -89,17 +99,35 @@ void Engine::setWindow(int width, int height, const char *title, int fullscreen,
   Vsync = vsync;
 }
 
+void Engine::setFixedTimestep(double timestep) { FixedTimestep = timestep; }
+
+void Engine::setRecording(const std::string &filename) {
+  RecordFilename = filename;
+}
+
+void Engine::setReplay(const std::string &filename) {
+  Player = std::make_unique<InputPlayer>(filename);
+}
+
+void Engine::setFrameLog(const std::string &filename) {
+  FrameLogFilename = filename;
+}
+
+void Engine::setRenderThread(bool threaded) { RenderThread = threaded; }
+
 /////////////////////////////////////////////////////////////////////////// INIT
 
 void Engine::setupWindow() {
-  GLFWmonitor *monitor = Fullscreen ? glfwGetPrimaryMonitor() : 0;
+  // Replays run in a hidden window without vsync, as fast as possible.
+  GLFWmonitor *monitor = (Fullscreen && !Player) ? glfwGetPrimaryMonitor() : 0;
+  glfwWindowHint(GLFW_VISIBLE, Player ? GLFW_FALSE : GLFW_TRUE);
   Window = glfwCreateWindow(WindowWidth, WindowHeight, WindowTitle, monitor, 0);
   if (!Window) {
     glfwTerminate();
     exit(EXIT_FAILURE);
   }
   glfwMakeContextCurrent(Window);
-  glfwSwapInterval(Vsync);
+  glfwSwapInterval(Player ? 0 : Vsync);
 }
 
 void Engine::setupCallbacks() {
@@ -173,21 +201,227 @@ void Engine::init() {
   displayInfo();
   setupDebugOutput();
 #endif
+  if (!RecordFilename.empty()) {
+    Recorder = std::make_unique<InputRecorder>(RecordFilename, FixedTimestep);
+  }
+  if (!FrameLogFilename.empty()) {
+    Timer = std::make_unique<FrameTimer>(FrameLogFilename);
+  }
+  StartTime = glfwGetTime();
+}
+
+/////////////////////////////////////////////////////////////////////////// INPUT
+
+void App::inputCallback(GLFWwindow *window, const InputEvent *events,
+                        size_t count) {
+  for (const InputEvent *e = events; e != events + count; ++e) {
+    switch (e->Type) {
+    case InputType::Frame:
+      break;
+    case InputType::Key:
+      keyCallback(window, e->A, e->B, e->C, e->D);
+      break;
+    case InputType::Cursor:
+      cursorCallback(window, e->X, e->Y);
+      break;
+    case InputType::MouseButton:
+      mouseButtonCallback(window, e->A, e->C, e->D);
+      break;
+    case InputType::Scroll:
+      scrollCallback(window, e->X, e->Y);
+      break;
+    case InputType::Joystick:
+      joystickCallback(e->A, e->B);
+      break;
+    case InputType::WindowSize:
+      windowSizeCallback(window, e->A, e->B);
+      break;
+    }
+  }
+}
+
+void Engine::setInputDispatch(bool automatic) { InputDispatch = automatic; }
+
+InputQueue &Engine::getInput() { return Input; }
+
+// Called from the GLFW callbacks. Consecutive cursor moves within a poll are
+// coalesced into the last one before reaching the queue.
+void Engine::input(InputEvent event) {
+  if (Player)
+    return; // live input is ignored while replaying
+  event.Frame = Frame;
+  event.Time = static_cast<float>(glfwGetTime() - StartTime);
+  if (event.Type == InputType::Cursor) {
+    PendingCursor = event;
+    HasPendingCursor = true;
+    return;
+  }
+  flushInput();
+  publish(event);
+}
+
+void Engine::publish(const InputEvent &event) {
+  if (Recorder)
+    Recorder->write(event);
+  Input.push(event);
+}
+
+void Engine::flushInput() {
+  if (HasPendingCursor) {
+    HasPendingCursor = false;
+    publish(PendingCursor);
+  }
+}
+
+void Engine::drainInput() {
+  if (!InputDispatch)
+    return;
+  InputEvent batch[64];
+  size_t n;
+  while ((n = Input.pop(batch, 64)) > 0) {
+    GlApp->inputCallback(Window, batch, n);
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////// RUN
 
-void Engine::run() {
+double Engine::beginFrame(double elapsed) {
+  if (FixedTimestep > 0.0)
+    elapsed = FixedTimestep;
+  if (Player) {
+    if (Frame >= Player->frames()) {
+      windowClose();
+      glfwSetWindowShouldClose(Window, GLFW_TRUE);
+      return -1.0;
+    }
+    InputEvent e;
+    while (Player->next(Frame, e)) {
+      if (e.Type != InputType::Frame) {
+        Input.push(e); // recorded before the frame marker
+      } else {
+        // --timestep wins over the log's fixed step, which wins over the
+        // duration recorded in the frame marker.
+        if (FixedTimestep <= 0.0)
+          elapsed = Player->timestep() > 0.0 ? Player->timestep() : e.X;
+        break;
+      }
+    }
+    drainInput();
+  } else if (Recorder) {
+    Recorder->write(
+        {InputType::Frame, Frame, 0.0f, 0, 0, 0, 0, elapsed, 0.0});
+  }
+  return elapsed;
+}
+
+void Engine::endFrame() {
+  if (Player) {
+    InputEvent e;
+    while (Player->next(Frame, e))
+      Input.push(e);
+  }
+  flushInput();
+  drainInput();
+  ++Frame;
+}
+
+// The GL context is owned by the render thread while it runs, so closing the
+// window is deferred until the context is back on the main thread.
+void Engine::windowClose() {
+  if (RenderThread) {
+    CloseRequested = true;
+  } else {
+    GlApp->windowCloseCallback(Window);
+  }
+}
+
+void Engine::runSingle() {
   double last_time = glfwGetTime();
   while (!glfwWindowShouldClose(Window)) {
+    FrameArena::beginFrame();
     double time = glfwGetTime();
-    double elapsed_time = time - last_time;
+    double elapsed_time = beginFrame(time - last_time);
     last_time = time;
+    if (elapsed_time < 0.0)
+      break;
+    if (Timer)
+      Timer->begin();
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
     GlApp->displayCallback(Window, elapsed_time);
+    if (Timer)
+      Timer->end();
     glfwSwapBuffers(Window);
     glfwPollEvents();
+    endFrame();
+  }
+}
+
+// Render thread: executes frame N-1 while the main thread records frame N.
+// Command lists are double-buffered; Submitted and Executed count frames and
+// are the only synchronization between the two threads.
+void Engine::renderLoop() {
+  glfwMakeContextCurrent(Window);
+  GLuint frame = 0;
+  for (;;) {
+    while (Submitted.load(std::memory_order_acquire) <= frame) {
+      if (Quit.load(std::memory_order_acquire) &&
+          Submitted.load(std::memory_order_acquire) <= frame) {
+        glfwMakeContextCurrent(0);
+        return;
+      }
+      std::this_thread::yield();
+    }
+    if (Timer)
+      Timer->begin();
+    Commands[frame % 2].execute();
+    if (Timer)
+      Timer->end();
+    glfwSwapBuffers(Window);
+    Executed.store(++frame, std::memory_order_release);
+  }
+}
+
+void Engine::runThreaded() {
+  glfwMakeContextCurrent(0);
+  std::thread render(&Engine::renderLoop, this);
+
+  double last_time = glfwGetTime();
+  while (!glfwWindowShouldClose(Window)) {
+    FrameArena::beginFrame();
+    double time = glfwGetTime();
+    double elapsed_time = beginFrame(time - last_time);
+    last_time = time;
+    if (elapsed_time < 0.0)
+      break;
+    // The list of frame N was last executed as frame N-2.
+    while (Executed.load(std::memory_order_acquire) + 1 < Frame)
+      std::this_thread::yield();
+    CommandList &commands = Commands[Frame % 2];
+    commands.reset();
+    commands.clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT |
+                   GL_STENCIL_BUFFER_BIT);
+    GlApp->recordCallback(Window, commands, elapsed_time);
+    Submitted.store(Frame + 1, std::memory_order_release);
+    glfwPollEvents();
+    endFrame();
+  }
+
+  Quit.store(true, std::memory_order_release);
+  render.join();
+  glfwMakeContextCurrent(Window);
+  RenderThread = false;
+  if (CloseRequested)
+    GlApp->windowCloseCallback(Window);
+}
+
+void Engine::run() {
+  if (RenderThread) {
+    runThreaded();
+  } else {
+    runSingle();
   }
+  Timer.reset();
+  Recorder.reset();
   glfwDestroyWindow(Window);
   glfwTerminate();
 }
@@ -14,6 +14,15 @@
 
 #include <glm/glm.hpp>
 
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "./mglArena.hpp"
+#include "./mglCommand.hpp"
+#include "./mglInput.hpp"
+#include "./mglTimer.hpp"
+
 namespace mgl {
 
 class App;
@@ -25,6 +34,10 @@ class App {
 public:
   virtual void initCallback(GLFWwindow *window) {}
   virtual void displayCallback(GLFWwindow *window, double elapsed) {}
+  // Replaces displayCallback when the engine runs a render thread: updates the
+  // simulation and records the frame without touching the GL context.
+  virtual void recordCallback(GLFWwindow *window, CommandList &commands,
+                              double elapsed) {}
   virtual void windowCloseCallback(GLFWwindow *window) {}
   virtual void windowSizeCallback(GLFWwindow *window, int width, int height) {}
   virtual void cursorCallback(GLFWwindow *window, double xpos, double ypos) {}
@@ -35,6 +48,10 @@ public:
   virtual void scrollCallback(GLFWwindow *window, double xoffset,
                               double yoffset) {}
   virtual void joystickCallback(int jid, int event) {}
+  // Receives the queued input of a frame in one batch; by default forwards
+  // each event to the matching callback above.
+  virtual void inputCallback(GLFWwindow *window, const InputEvent *events,
+                             size_t count);
 };
 
 ///////////////////////////////////////////////////////////////////////// Engine
@@ -50,8 +67,21 @@ public:
   void setOpenGL(int major, int minor);
   void setWindow(int width, int height, const char *title, int fullscreen,
                  int vsync);
+  // A fixed timestep set here overrides the one of a replayed log, if any;
+  // logs recorded with a variable step replay each frame's duration.
+  void setFixedTimestep(double timestep);
+  void setRecording(const std::string &filename);
+  void setReplay(const std::string &filename);
+  void setFrameLog(const std::string &filename);
+  void setInputDispatch(bool automatic);
+  // With a render thread, GL calls are only valid in initCallback,
+  // windowCloseCallback and in the recorded command lists.
+  void setRenderThread(bool threaded);
+  InputQueue &getInput();
   void init();
   void run();
+  void input(InputEvent event);
+  void windowClose();
 
 protected:
   virtual ~Engine();
@@ -64,7 +94,31 @@ private:
   const char *WindowTitle;
   int Fullscreen;
   int Vsync;
-
+  double FixedTimestep;
+  double StartTime;
+  GLuint Frame;
+  std::string RecordFilename, FrameLogFilename;
+  std::unique_ptr<InputRecorder> Recorder;
+  std::unique_ptr<InputPlayer> Player;
+  std::unique_ptr<FrameTimer> Timer;
+  InputQueue Input;
+  InputEvent PendingCursor;
+  bool HasPendingCursor;
+  bool InputDispatch;
+  bool RenderThread;
+  bool CloseRequested;
+  CommandList Commands[2];
+  std::atomic<GLuint> Submitted, Executed;
+  std::atomic<bool> Quit;
+
+  void publish(const InputEvent &event);
+  void flushInput();
+  void drainInput();
+  void runSingle();
+  void runThreaded();
+  void renderLoop();
+  double beginFrame(double elapsed);
+  void endFrame();
   void setupWindow();
   void setupGLFW();
   void setupGLEW();
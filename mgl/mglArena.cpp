@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Frame Arena Allocator
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "./mglArena.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+namespace mgl {
+
+static std::atomic<unsigned> FrameIndex(0);
+
+///////////////////////////////////////////////////////////////////// FrameArena
+
+FrameArena::FrameArena(size_t capacity)
+    : Block(static_cast<char *>(::operator new(capacity))), Capacity(capacity),
+      Offset(0), OverflowOffset(0), OverflowCapacity(0), OverflowUsed(0) {}
+
+FrameArena::~FrameArena() {
+  for (char *block : Overflow)
+    ::operator delete(block);
+  ::operator delete(Block);
+}
+
+static char *align(char *p, size_t alignment) {
+  const uintptr_t a = reinterpret_cast<uintptr_t>(p);
+  return reinterpret_cast<char *>((a + alignment - 1) & ~(alignment - 1));
+}
+
+void *FrameArena::allocate(size_t size, size_t alignment) {
+  char *p = align(Block + Offset, alignment);
+  if (p + size <= Block + Capacity) {
+    Offset = (p + size) - Block;
+    return p;
+  }
+  if (!Overflow.empty()) {
+    char *block = Overflow.back();
+    p = align(block + OverflowOffset, alignment);
+    if (p + size <= block + OverflowCapacity) {
+      OverflowOffset = (p + size) - block;
+      OverflowUsed += size + alignment;
+      return p;
+    }
+  }
+  OverflowCapacity = (size + alignment > Capacity) ? size + alignment : Capacity;
+  char *block = static_cast<char *>(::operator new(OverflowCapacity));
+  Overflow.push_back(block);
+  p = align(block, alignment);
+  OverflowOffset = (p + size) - block;
+  OverflowUsed += size + alignment;
+  return p;
+}
+
+void FrameArena::reset() {
+  if (!Overflow.empty()) {
+    for (char *block : Overflow)
+      ::operator delete(block);
+    Overflow.clear();
+    // Grow to the peak of this frame so the next one fits in one block.
+    size_t capacity = Capacity;
+    while (capacity < Capacity + OverflowUsed)
+      capacity *= 2;
+    ::operator delete(Block);
+    Block = static_cast<char *>(::operator new(capacity));
+    Capacity = capacity;
+    OverflowOffset = OverflowCapacity = OverflowUsed = 0;
+  }
+  Offset = 0;
+}
+
+size_t FrameArena::used() const { return Offset + OverflowUsed; }
+
+size_t FrameArena::capacity() const { return Capacity; }
+
+struct ThreadArenas {
+  FrameArena Current;
+  FrameArena Buffered[2];
+  unsigned Frame = 0;
+};
+
+static ThreadArenas &threadArenas() {
+  static thread_local ThreadArenas arenas;
+  const unsigned frame = FrameIndex.load(std::memory_order_acquire);
+  if (arenas.Frame != frame) {
+    arenas.Current.reset();
+    if (frame - arenas.Frame >= 2) {
+      arenas.Buffered[0].reset();
+      arenas.Buffered[1].reset();
+    } else {
+      arenas.Buffered[frame % 2].reset();
+    }
+    arenas.Frame = frame;
+  }
+  return arenas;
+}
+
+void FrameArena::beginFrame() {
+  FrameIndex.fetch_add(1, std::memory_order_release);
+}
+
+FrameArena &FrameArena::frame() { return threadArenas().Current; }
+
+FrameArena &FrameArena::nextFrame() {
+  ThreadArenas &arenas = threadArenas();
+  return arenas.Buffered[arenas.Frame % 2];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Frame Arena Allocator
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_ARENA_HPP
+#define MGL_ARENA_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace mgl {
+
+class FrameArena;
+template <typename T, FrameArena &(*Arena)()> class ArenaAllocator;
+
+///////////////////////////////////////////////////////////////////// FrameArena
+
+// Bump allocator for transient data. Each thread has its own arenas, reset
+// lazily the first time the thread touches them after Engine::run() starts a
+// new frame, so no locking is needed.
+//   frame()      memory valid until the next frame starts.
+//   nextFrame()  memory valid until the end of the next frame (double
+//                buffered), e.g. data recorded for the render thread.
+// Requests that do not fit spill into overflow blocks; reset() then grows the
+// arena to the peak usage, so steady-state frames never reach malloc.
+
+class FrameArena {
+public:
+  static const size_t DEFAULT_CAPACITY = 256 * 1024;
+
+  explicit FrameArena(size_t capacity = DEFAULT_CAPACITY);
+  ~FrameArena();
+  FrameArena(const FrameArena &) = delete;
+  void operator=(const FrameArena &) = delete;
+
+  void *allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+  void reset();
+  size_t used() const;
+  size_t capacity() const;
+
+  static void beginFrame();
+  static FrameArena &frame();
+  static FrameArena &nextFrame();
+
+private:
+  char *Block;
+  size_t Capacity, Offset;
+  std::vector<char *> Overflow;
+  size_t OverflowOffset, OverflowCapacity, OverflowUsed;
+};
+
+///////////////////////////////////////////////////////////////// ArenaAllocator
+
+// STL allocator drawing from a frame arena; deallocation is a no-op.
+template <typename T, FrameArena &(*Arena)()> class ArenaAllocator {
+public:
+  typedef T value_type;
+  template <typename U> struct rebind {
+    typedef ArenaAllocator<U, Arena> other;
+  };
+
+  ArenaAllocator() noexcept {}
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U, Arena> &) noexcept {}
+
+  T *allocate(size_t n) {
+    return static_cast<T *>(Arena().allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *, size_t) noexcept {}
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U, Arena> &) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U, Arena> &) const noexcept {
+    return false;
+  }
+};
+
+template <typename T>
+using FrameAllocator = ArenaAllocator<T, &FrameArena::frame>;
+template <typename T>
+using NextFrameAllocator = ArenaAllocator<T, &FrameArena::nextFrame>;
+
+template <typename T> using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_ARENA_HPP */
@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Camera
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "./mglCamera.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace mgl {
+
+///////////////////////////////////////////////////////////////////////// Camera
+
+Camera::Camera(Resources &resources, GLuint bindingPoint)
+    : BindingPoint(bindingPoint), ViewMatrix(1.0f), ProjectionMatrix(1.0f),
+      Dirty(true) {
+  Ubo = resources.createBuffer(GL_UNIFORM_BUFFER, sizeof(glm::mat4) * 2, 0,
+                               GL_STREAM_DRAW);
+  glBindBufferBase(GL_UNIFORM_BUFFER, BindingPoint, resources.id(Ubo));
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void Camera::destroy(Resources &resources) {
+  resources.destroy(Ubo);
+  Ubo = BufferHandle();
+}
+
+glm::mat4 Camera::getViewMatrix() const { return ViewMatrix; }
+
+void Camera::setViewMatrix(const glm::mat4 &viewMatrix) {
+  ViewMatrix = viewMatrix;
+  Dirty = true;
+}
+
+glm::mat4 Camera::getProjectionMatrix() const { return ProjectionMatrix; }
+
+void Camera::setProjectionMatrix(const glm::mat4 &projectionMatrix) {
+  ProjectionMatrix = projectionMatrix;
+  Dirty = true;
+}
+
+glm::mat4 Camera::getViewProjection() const {
+  return ProjectionMatrix * ViewMatrix;
+}
+
+GLuint Camera::getBindingPoint() const { return BindingPoint; }
+
+void Camera::upload(const Resources &resources) {
+  const GLuint id = resources.id(Ubo);
+  glBindBufferBase(GL_UNIFORM_BUFFER, BindingPoint, id);
+  if (!Dirty)
+    return;
+  glBindBuffer(GL_UNIFORM_BUFFER, id);
+  glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(glm::mat4),
+                  glm::value_ptr(ViewMatrix));
+  glBufferSubData(GL_UNIFORM_BUFFER, sizeof(glm::mat4), sizeof(glm::mat4),
+                  glm::value_ptr(ProjectionMatrix));
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+  Dirty = false;
+}
+
+void Camera::record(const Resources &resources, CommandList &commands) {
+  const GLuint id = resources.id(Ubo);
+  commands.bindBufferRange(GL_UNIFORM_BUFFER, BindingPoint, id, 0,
+                           sizeof(glm::mat4) * 2);
+  if (!Dirty)
+    return;
+  const glm::mat4 matrices[2] = {ViewMatrix, ProjectionMatrix};
+  commands.bufferSubData(GL_UNIFORM_BUFFER, id, 0, matrices, sizeof(matrices));
+  Dirty = false;
+}
+
+//////////////////////////////////////////////////////////////////////// PanZoom
+
+glm::mat4 PanZoom::viewMatrix() const {
+  return glm::translate(glm::mat4(1.0f), glm::vec3(-Centre, 0.0f));
+}
+
+glm::mat4 PanZoom::projectionMatrix() const {
+  const float halfWidth = HalfHeight * Aspect;
+  return glm::ortho(-halfWidth, halfWidth, -HalfHeight, HalfHeight, -1.0f,
+                    1.0f);
+}
+
+void PanZoom::pan(const glm::vec2 &offset) {
+  Centre -= offset * glm::vec2(HalfHeight * Aspect, HalfHeight);
+}
+
+void PanZoom::zoom(float factor, const glm::vec2 &ndc) {
+  const glm::vec2 point =
+      Centre + ndc * glm::vec2(HalfHeight * Aspect, HalfHeight);
+  HalfHeight *= factor;
+  Centre = point - ndc * glm::vec2(HalfHeight * Aspect, HalfHeight);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
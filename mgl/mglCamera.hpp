@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Camera
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_CAMERA_HPP
+#define MGL_CAMERA_HPP
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include "./mglCommand.hpp"
+#include "./mglResource.hpp"
+
+namespace mgl {
+
+class Camera;
+struct PanZoom;
+
+///////////////////////////////////////////////////////////////////////// Camera
+
+// View and projection matrices shared by every program through a uniform
+// block (CAMERA_BLOCK, std140):
+//
+//   uniform Camera { mat4 ViewMatrix; mat4 ProjectionMatrix; };
+//
+// Setters only record the matrices; upload() sends them, once per frame.
+// The uniform buffer comes from a Resources pool, like any other buffer, and
+// goes back to it with destroy() or when the pool is cleared.
+
+class Camera {
+public:
+  Camera(Resources &resources, GLuint bindingPoint);
+  void destroy(Resources &resources);
+  Camera(const Camera &) = delete;
+  void operator=(const Camera &) = delete;
+
+  glm::mat4 getViewMatrix() const;
+  void setViewMatrix(const glm::mat4 &viewMatrix);
+  glm::mat4 getProjectionMatrix() const;
+  void setProjectionMatrix(const glm::mat4 &projectionMatrix);
+  glm::mat4 getViewProjection() const;
+  GLuint getBindingPoint() const;
+
+  // Binds the block and uploads the matrices if they changed.
+  void upload(const Resources &resources);
+  // Same as upload(), recorded for the render thread.
+  void record(const Resources &resources, CommandList &commands);
+
+private:
+  BufferHandle Ubo;
+  GLuint BindingPoint;
+  glm::mat4 ViewMatrix, ProjectionMatrix;
+  bool Dirty;
+};
+
+//////////////////////////////////////////////////////////////////////// PanZoom
+
+// 2D view of the xy plane. Centre is seen in the middle of the viewport, which
+// spans HalfHeight world units above and below it and as many as the aspect
+// ratio (width / height) allows to each side. Offsets and points are given in
+// normalized device coordinates, [-1, 1] across the viewport.
+
+struct PanZoom {
+  glm::vec2 Centre = glm::vec2(0.0f);
+  float HalfHeight = 1.0f;
+  float Aspect = 1.0f;
+
+  glm::mat4 viewMatrix() const;
+  glm::mat4 projectionMatrix() const;
+  // Drags the plane along with the pointer.
+  void pan(const glm::vec2 &offset);
+  // Shows factor times more of the plane, keeping the point under ndc fixed.
+  void zoom(float factor, const glm::vec2 &ndc);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_CAMERA_HPP */
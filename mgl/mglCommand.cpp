@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Render Command List
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "./mglCommand.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <cstring>
+
+namespace mgl {
+
+//////////////////////////////////////////////////////////////////// CommandList
+
+void CommandList::reset() {
+  Commands.clear();
+  Params.clear();
+}
+
+size_t CommandList::size() const { return Commands.size(); }
+
+void CommandList::push(CommandType type, GLenum e, GLuint id, GLint a0,
+                       GLint a1, GLint a2, GLint a3, size_t offset) {
+  Commands.push_back({type, e, id, {a0, a1, a2, a3}, offset});
+}
+
+size_t CommandList::params(const GLfloat *values, size_t count) {
+  const size_t offset = Params.size();
+  Params.insert(Params.end(), values, values + count);
+  return offset;
+}
+
+void CommandList::clear(GLbitfield mask) {
+  push(CommandType::Clear, mask, 0, 0, 0, 0, 0, 0);
+}
+
+void CommandList::clearColor(const glm::vec4 &color) {
+  push(CommandType::ClearColor, 0, 0, 0, 0, 0, 0,
+       params(glm::value_ptr(color), 4));
+}
+
+void CommandList::viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+  push(CommandType::Viewport, 0, 0, x, y, width, height, 0);
+}
+
+void CommandList::bindProgram(GLuint program) {
+  push(CommandType::BindProgram, 0, program, 0, 0, 0, 0, 0);
+}
+
+void CommandList::bindVertexArray(GLuint vao) {
+  push(CommandType::BindVertexArray, 0, vao, 0, 0, 0, 0, 0);
+}
+
+void CommandList::bindBufferRange(GLenum target, GLuint binding, GLuint buffer,
+                                  size_t offset, GLsizei size) {
+  push(CommandType::BindBufferRange, target, buffer,
+       static_cast<GLint>(binding), size, 0, 0, offset);
+}
+
+void CommandList::bufferSubData(GLenum target, GLuint buffer, size_t offset,
+                                const void *data, size_t size) {
+  const size_t at = Params.size();
+  Params.resize(at + (size + sizeof(GLfloat) - 1) / sizeof(GLfloat));
+  if (size > 0)
+    std::memcpy(&Params[at], data, size);
+  push(CommandType::BufferSubData, target, buffer,
+       static_cast<GLint>(offset), static_cast<GLint>(size), 0, 0, at);
+}
+
+void CommandList::uniform(GLint location, const glm::mat4 &value) {
+  push(CommandType::UniformMatrix4, 0, 0, location, 0, 0, 0,
+       params(glm::value_ptr(value), 16));
+}
+
+void CommandList::uniform(GLint location, const glm::vec4 &value) {
+  push(CommandType::Uniform4, 0, 0, location, 0, 0, 0,
+       params(glm::value_ptr(value), 4));
+}
+
+void CommandList::drawElements(GLenum mode, GLsizei count, GLenum type,
+                               size_t offset, GLsizei instances,
+                               GLint baseVertex, GLuint baseInstance) {
+  push(CommandType::DrawElements, mode, baseInstance, count,
+       static_cast<GLint>(type), instances, baseVertex, offset);
+}
+
+void CommandList::execute() const {
+  for (const Command &c : Commands) {
+    switch (c.Type) {
+    case CommandType::Clear:
+      glClear(c.Enum);
+      break;
+    case CommandType::ClearColor: {
+      const GLfloat *p = &Params[c.Offset];
+      glClearColor(p[0], p[1], p[2], p[3]);
+      break;
+    }
+    case CommandType::Viewport:
+      glViewport(c.Args[0], c.Args[1], c.Args[2], c.Args[3]);
+      break;
+    case CommandType::BindProgram:
+      glUseProgram(c.Id);
+      break;
+    case CommandType::BindVertexArray:
+      glBindVertexArray(c.Id);
+      break;
+    case CommandType::BindBufferRange:
+      glBindBufferRange(c.Enum, c.Args[0], c.Id, c.Offset, c.Args[1]);
+      break;
+    case CommandType::BufferSubData:
+      glBindBuffer(c.Enum, c.Id);
+      glBufferSubData(c.Enum, c.Args[0], c.Args[1], Params.data() + c.Offset);
+      glBindBuffer(c.Enum, 0);
+      break;
+    case CommandType::UniformMatrix4:
+      glUniformMatrix4fv(c.Args[0], 1, GL_FALSE, &Params[c.Offset]);
+      break;
+    case CommandType::Uniform4:
+      glUniform4fv(c.Args[0], 1, &Params[c.Offset]);
+      break;
+    case CommandType::DrawElements:
+      glDrawElementsInstancedBaseVertexBaseInstance(
+          c.Enum, c.Args[0], c.Args[1], reinterpret_cast<GLvoid *>(c.Offset),
+          c.Args[2], c.Args[3], c.Id);
+      break;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Render Command List
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_COMMAND_HPP
+#define MGL_COMMAND_HPP
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace mgl {
+
+struct Command;
+class CommandList;
+
+//////////////////////////////////////////////////////////////////////// Command
+
+enum class CommandType : GLubyte {
+  Clear,
+  ClearColor,
+  Viewport,
+  BindProgram,
+  BindVertexArray,
+  BindBufferRange,
+  BufferSubData,
+  UniformMatrix4,
+  Uniform4,
+  DrawElements
+};
+
+// Plain record of one render operation. Uniform values and buffer data live in
+// the list's parameter array at Offset; draws use Offset as the index buffer
+// offset and Id as the base instance.
+struct Command {
+  CommandType Type;
+  GLenum Enum;
+  GLuint Id;
+  GLint Args[4];
+  size_t Offset;
+};
+
+//////////////////////////////////////////////////////////////////// CommandList
+
+// Recorded on the simulation thread and executed later on the thread that
+// owns the GL context. reset() keeps the storage, so a list reused every frame
+// stops allocating once it has reached its working size.
+// Commands keep GL enums and object names as given: a list only moves GL
+// calls to another thread, it does not hide the API. Names must stay valid
+// until the list has been executed.
+
+class CommandList {
+public:
+  void reset();
+  size_t size() const;
+  void execute() const;
+
+  void clear(GLbitfield mask);
+  void clearColor(const glm::vec4 &color);
+  void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+  void bindProgram(GLuint program);
+  void bindVertexArray(GLuint vao);
+  void bindBufferRange(GLenum target, GLuint binding, GLuint buffer,
+                       size_t offset, GLsizei size);
+  // Copies size bytes of data into the list, uploaded when executed.
+  void bufferSubData(GLenum target, GLuint buffer, size_t offset,
+                     const void *data, size_t size);
+  void uniform(GLint location, const glm::mat4 &value);
+  void uniform(GLint location, const glm::vec4 &value);
+  void drawElements(GLenum mode, GLsizei count, GLenum type, size_t offset,
+                    GLsizei instances = 1, GLint baseVertex = 0,
+                    GLuint baseInstance = 0);
+
+private:
+  std::vector<Command> Commands;
+  std::vector<GLfloat> Params;
+
+  void push(CommandType type, GLenum e, GLuint id, GLint a0, GLint a1,
+            GLint a2, GLint a3, size_t offset);
+  size_t params(const GLfloat *values, size_t count);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_COMMAND_HPP */
@@ -19,6 +19,7 @@ const char VIEW_MATRIX[] = "ViewMatrix";
 const char PROJECTION_MATRIX[] = "ProjectionMatrix";
 const char TEXTURE_MATRIX[] = "TextureMatrix";
 const char CAMERA_BLOCK[] = "Camera";
+const char OBJECT_BLOCK[] = "Object";
 
 const char POSITION_ATTRIBUTE[] = "inPosition";
 const char NORMAL_ATTRIBUTE[] = "inNormal";
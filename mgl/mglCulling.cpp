@@ -0,0 +1,208 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Visibility Culling
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "./mglCulling.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "./mglArena.hpp"
+#include "./mglJob.hpp"
+
+namespace mgl {
+
+const GLuint ROWS_PER_JOB = 8;
+
+///////////////////////////////////////////////////////////////////////// Bounds
+
+bool overlaps(const Bounds &a, const Bounds &b) {
+  return a.Max.x >= b.Min.x && a.Min.x <= b.Max.x && a.Max.y >= b.Min.y &&
+         a.Min.y <= b.Max.y;
+}
+
+bool contains(const Bounds &outer, const Bounds &inner) {
+  return inner.Min.x >= outer.Min.x && inner.Max.x <= outer.Max.x &&
+         inner.Min.y >= outer.Min.y && inner.Max.y <= outer.Max.y;
+}
+
+Bounds transformBounds(const Bounds &bounds, const glm::mat4 &matrix) {
+  const glm::vec2 centre = (bounds.Min + bounds.Max) * 0.5f;
+  const glm::vec2 half = (bounds.Max - bounds.Min) * 0.5f;
+  const glm::vec2 c = glm::vec2(matrix * glm::vec4(centre, 0.0f, 1.0f));
+  const glm::vec2 h = glm::abs(glm::vec2(matrix[0])) * half.x +
+                      glm::abs(glm::vec2(matrix[1])) * half.y;
+  return {c - h, c + h};
+}
+
+Bounds viewBounds(const glm::mat4 &viewProjection) {
+  return transformBounds({glm::vec2(-1.0f), glm::vec2(1.0f)},
+                         glm::inverse(viewProjection));
+}
+
+/////////////////////////////////////////////////////////////////////// CullGrid
+
+void CullGrid::build(const std::vector<Bounds> &bounds,
+                     GLuint objectsPerCell) {
+  clear();
+  if (bounds.empty())
+    return;
+
+  Extent = bounds[0];
+  MaxSize = glm::vec2(0.0f);
+  for (const Bounds &b : bounds) {
+    Extent.Min = glm::min(Extent.Min, b.Min);
+    Extent.Max = glm::max(Extent.Max, b.Max);
+    MaxSize = glm::max(MaxSize, b.Max - b.Min);
+  }
+  const GLuint side = static_cast<GLuint>(std::ceil(std::sqrt(
+      double(bounds.size()) / double(std::max<GLuint>(objectsPerCell, 1)))));
+  Columns = Rows = std::max<GLuint>(side, 1);
+  CellSize = glm::max((Extent.Max - Extent.Min) / glm::vec2(Columns, Rows),
+                      glm::vec2(1e-6f));
+
+  // Counting sort of the objects by cell.
+  std::vector<GLuint> cell(bounds.size());
+  CellStart.assign(size_t(Columns) * Rows + 1, 0);
+  for (size_t i = 0; i < bounds.size(); ++i) {
+    const glm::vec2 centre = (bounds[i].Min + bounds[i].Max) * 0.5f;
+    const glm::uvec2 c =
+        glm::min(glm::uvec2((centre - Extent.Min) / CellSize),
+                 glm::uvec2(Columns - 1, Rows - 1));
+    cell[i] = c.y * Columns + c.x;
+    ++CellStart[cell[i] + 1];
+  }
+  for (size_t c = 1; c < CellStart.size(); ++c)
+    CellStart[c] += CellStart[c - 1];
+
+  std::vector<GLuint> fill(CellStart.begin(), CellStart.end() - 1);
+  Ids.resize(bounds.size());
+  MinX.resize(bounds.size());
+  MinY.resize(bounds.size());
+  MaxX.resize(bounds.size());
+  MaxY.resize(bounds.size());
+  CellBounds.assign(size_t(Columns) * Rows,
+                    {glm::vec2(INFINITY), glm::vec2(-INFINITY)});
+  for (size_t i = 0; i < bounds.size(); ++i) {
+    const GLuint slot = fill[cell[i]]++;
+    Ids[slot] = static_cast<GLuint>(i);
+    MinX[slot] = bounds[i].Min.x;
+    MinY[slot] = bounds[i].Min.y;
+    MaxX[slot] = bounds[i].Max.x;
+    MaxY[slot] = bounds[i].Max.y;
+    Bounds &b = CellBounds[cell[i]];
+    b.Min = glm::min(b.Min, bounds[i].Min);
+    b.Max = glm::max(b.Max, bounds[i].Max);
+  }
+}
+
+void CullGrid::clear() {
+  Columns = Rows = 0;
+  CellStart.clear();
+  CellBounds.clear();
+  MinX.clear();
+  MinY.clear();
+  MaxX.clear();
+  MaxY.clear();
+  Ids.clear();
+}
+
+size_t CullGrid::size() const { return Ids.size(); }
+
+size_t CullGrid::cull(const Bounds &view, GLuint *visible,
+                      JobSystem *jobs) const {
+  if (Ids.empty())
+    return 0;
+
+  // Objects are bucketed by centre, so they reach up to half their size
+  // outside their cell.
+  const glm::vec2 margin = MaxSize * 0.5f;
+  const glm::vec2 lo = (view.Min - margin - Extent.Min) / CellSize;
+  const glm::vec2 hi = (view.Max + margin - Extent.Min) / CellSize;
+  // Cell ranges are clamped as floats before conversion: a NaN, negative or
+  // huge float has no GLuint value. Written so that NaNs cull everything.
+  if (!(hi.x >= 0.0f && hi.y >= 0.0f && lo.x < float(Columns) &&
+        lo.y < float(Rows)))
+    return 0;
+  const GLuint x0 = static_cast<GLuint>(std::max(lo.x, 0.0f));
+  const GLuint y0 = static_cast<GLuint>(std::max(lo.y, 0.0f));
+  const GLuint x1 = static_cast<GLuint>(std::min(hi.x, float(Columns - 1)));
+  const GLuint y1 = static_cast<GLuint>(std::min(hi.y, float(Rows - 1)));
+
+  // Each row writes its results at the slot of its first candidate object,
+  // which no other row uses; rows are then packed together in order.
+  FrameVector<size_t> counts(y1 - y0 + 1);
+  if (jobs) {
+    jobs->parallelFor(y1 - y0 + 1, ROWS_PER_JOB,
+                      [&](GLuint begin, GLuint end) {
+                        for (GLuint r = begin; r < end; ++r)
+                          counts[r] = cullRow(view, y0 + r, x0, x1, visible);
+                      });
+  } else {
+    for (GLuint r = 0; r <= y1 - y0; ++r)
+      counts[r] = cullRow(view, y0 + r, x0, x1, visible);
+  }
+
+  size_t count = 0;
+  for (GLuint r = 0; r <= y1 - y0; ++r) {
+    const GLuint start = CellStart[(y0 + r) * Columns + x0];
+    if (count != start && counts[r])
+      std::memmove(visible + count, visible + start,
+                   counts[r] * sizeof(GLuint));
+    count += counts[r];
+  }
+  return count;
+}
+
+size_t CullGrid::cullRow(const Bounds &view, GLuint row, GLuint first,
+                         GLuint last, GLuint *visible) const {
+  GLuint *out = visible + CellStart[row * Columns + first];
+  size_t n = 0;
+  for (GLuint c = row * Columns + first; c <= row * Columns + last; ++c) {
+    GLuint i = CellStart[c];
+    const GLuint end = CellStart[c + 1];
+    if (i == end || !overlaps(CellBounds[c], view))
+      continue;
+    if (contains(view, CellBounds[c])) {
+      std::memcpy(out + n, &Ids[i], (end - i) * sizeof(GLuint));
+      n += end - i;
+      continue;
+    }
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+    const __m128 minX = _mm_set1_ps(view.Min.x);
+    const __m128 minY = _mm_set1_ps(view.Min.y);
+    const __m128 maxX = _mm_set1_ps(view.Max.x);
+    const __m128 maxY = _mm_set1_ps(view.Max.y);
+    for (; i + 4 <= end; i += 4) {
+      const __m128 x = _mm_and_ps(_mm_cmpge_ps(_mm_loadu_ps(&MaxX[i]), minX),
+                                  _mm_cmple_ps(_mm_loadu_ps(&MinX[i]), maxX));
+      const __m128 y = _mm_and_ps(_mm_cmpge_ps(_mm_loadu_ps(&MaxY[i]), minY),
+                                  _mm_cmple_ps(_mm_loadu_ps(&MinY[i]), maxY));
+      const int mask = _mm_movemask_ps(_mm_and_ps(x, y));
+      // Branchless compaction: always store, advance only on a hit.
+      out[n] = Ids[i];
+      n += mask & 1;
+      out[n] = Ids[i + 1];
+      n += (mask >> 1) & 1;
+      out[n] = Ids[i + 2];
+      n += (mask >> 2) & 1;
+      out[n] = Ids[i + 3];
+      n += (mask >> 3) & 1;
+    }
+#endif
+    for (; i < end; ++i) {
+      out[n] = Ids[i];
+      n += (MaxX[i] >= view.Min.x) & (MinX[i] <= view.Max.x) &
+           (MaxY[i] >= view.Min.y) & (MinY[i] <= view.Max.y);
+    }
+  }
+  return n;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
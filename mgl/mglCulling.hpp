@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Visibility Culling
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_CULLING_HPP
+#define MGL_CULLING_HPP
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace mgl {
+
+struct Bounds;
+class CullGrid;
+class JobSystem;
+
+///////////////////////////////////////////////////////////////////////// Bounds
+
+// Axis-aligned rectangle in world space.
+struct Bounds {
+  glm::vec2 Min, Max;
+};
+
+bool overlaps(const Bounds &a, const Bounds &b);
+bool contains(const Bounds &outer, const Bounds &inner);
+// Bounds of a rectangle after an affine 2D transform (z ignored).
+Bounds transformBounds(const Bounds &bounds, const glm::mat4 &matrix);
+// World-space rectangle seen through a view-projection matrix.
+Bounds viewBounds(const glm::mat4 &viewProjection);
+
+/////////////////////////////////////////////////////////////////////// CullGrid
+
+// Static objects are bucketed into a uniform grid by the centre of their
+// bounds; object bounds are stored per cell in SoA order and each cell keeps
+// the tight bounds of its objects. A query walks only the cells whose range,
+// widened by the largest object, meets the view; cells inside the view are
+// accepted whole, cells crossing its edge are tested 4 objects at a time.
+// With a job system, rows of cells are culled in parallel; results are
+// compacted in cell order, so the visible list is deterministic.
+
+class CullGrid {
+public:
+  static const GLuint OBJECTS_PER_CELL = 32;
+
+  void build(const std::vector<Bounds> &bounds,
+             GLuint objectsPerCell = OBJECTS_PER_CELL);
+  void clear();
+  size_t size() const;
+
+  // Writes the ids (indices into the bounds given to build()) of the objects
+  // overlapping view and returns their count. visible must have room for
+  // size() ids. Ids come out in cell order, not in id order. Scratch memory
+  // comes from the calling thread's frame arena.
+  size_t cull(const Bounds &view, GLuint *visible, JobSystem *jobs = 0) const;
+
+private:
+  Bounds Extent;
+  glm::vec2 CellSize, MaxSize;
+  GLuint Columns = 0, Rows = 0;
+  std::vector<GLuint> CellStart;
+  std::vector<Bounds> CellBounds;
+  std::vector<float> MinX, MinY, MaxX, MaxY;
+  std::vector<GLuint> Ids;
+
+  size_t cullRow(const Bounds &view, GLuint row, GLuint first, GLuint last,
+                 GLuint *visible) const;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_CULLING_HPP */
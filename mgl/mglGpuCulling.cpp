@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// GPU Visibility Culling
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "./mglGpuCulling.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+
+namespace mgl {
+
+static_assert(sizeof(GpuObject) == 112, "GpuObject std430 layout");
+static_assert(sizeof(DrawElementsCommand) == 20, "DrawElementsCommand layout");
+
+////////////////////////////////////////////////////////////////////// GpuCuller
+
+GpuCuller::GpuCuller()
+    : ViewId(-1), CountId(-1), CommandBaseId(-1), InstanceBaseId(-1),
+      ObjectCount(0), MeshCount(0), PageSize(0) {}
+
+void GpuCuller::create(const std::string &filename) {
+  Program = std::make_unique<ShaderProgram>();
+  Program->addShader(GL_COMPUTE_SHADER, filename);
+  Program->addUniform("View");
+  Program->addUniform("ObjectCount");
+  Program->addUniform("CommandBase");
+  Program->addUniform("InstanceBase");
+  Program->create();
+  ViewId = Program->Uniforms["View"].index;
+  CountId = Program->Uniforms["ObjectCount"].index;
+  CommandBaseId = Program->Uniforms["CommandBase"].index;
+  InstanceBaseId = Program->Uniforms["InstanceBase"].index;
+}
+
+void GpuCuller::build(Resources &resources,
+                      const std::vector<GpuObject> &objects,
+                      const std::vector<DrawElementsCommand> &commands) {
+  clear(resources);
+  if (objects.empty() || commands.empty())
+    return;
+
+  // Pages are as large as one binding and one dispatch allow, in multiples
+  // of the binding offset alignment so that a page's objects and instance
+  // ids can both be bound.
+  GLint64 maxBlock;
+  GLint alignment, maxGroups;
+  glGetInteger64v(GL_MAX_SHADER_STORAGE_BLOCK_SIZE, &maxBlock);
+  glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+  glGetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_COUNT, 0, &maxGroups);
+  uint64_t page = std::min<uint64_t>(uint64_t(maxBlock) / sizeof(GpuObject),
+                                     uint64_t(maxGroups) * WORKGROUP_SIZE);
+  page -= page % std::max<GLint>(alignment, 1);
+  ObjectCount = static_cast<GLuint>(objects.size());
+  MeshCount = static_cast<GLuint>(commands.size());
+  PageSize = static_cast<GLuint>(std::min<uint64_t>(page, ObjectCount));
+
+  // Each mesh of each page gets as many instance slots as there are objects
+  // of the page drawing it; pages' slots follow each other.
+  Reset.clear();
+  for (GLuint p = 0; p < pages(); ++p)
+    Reset.insert(Reset.end(), commands.begin(), commands.end());
+  for (DrawElementsCommand &command : Reset)
+    command.InstanceCount = command.BaseInstance = 0;
+  for (GLuint i = 0; i < ObjectCount; ++i) {
+    if (objects[i].Mesh >= MeshCount) {
+      std::cerr << "[ERROR] GPU culling object refers to missing mesh "
+                << objects[i].Mesh << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    ++Reset[i / PageSize * MeshCount + objects[i].Mesh].BaseInstance;
+  }
+  GLuint first = 0;
+  for (DrawElementsCommand &command : Reset) {
+    const GLuint count = command.BaseInstance;
+    command.BaseInstance = first;
+    first += count;
+  }
+
+  Objects = resources.createBufferStorage(
+      GL_SHADER_STORAGE_BUFFER,
+      static_cast<GLsizeiptr>(objects.size() * sizeof(GpuObject)),
+      objects.data(), 0);
+  Commands = resources.createBufferStorage(
+      GL_DRAW_INDIRECT_BUFFER,
+      static_cast<GLsizeiptr>(Reset.size() * sizeof(DrawElementsCommand)),
+      Reset.data(), GL_DYNAMIC_STORAGE_BIT);
+  Instances = resources.createBufferStorage(
+      GL_ARRAY_BUFFER,
+      static_cast<GLsizeiptr>(objects.size() * sizeof(GLuint)), 0, 0);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void GpuCuller::clear(Resources &resources) {
+  resources.destroy(Objects);
+  resources.destroy(Commands);
+  resources.destroy(Instances);
+  Objects = Commands = Instances = BufferHandle();
+  Reset.clear();
+  ObjectCount = MeshCount = PageSize = 0;
+}
+
+size_t GpuCuller::size() const { return ObjectCount; }
+
+GLuint GpuCuller::pages() const {
+  return PageSize ? (ObjectCount + PageSize - 1) / PageSize : 0;
+}
+
+void GpuCuller::bindPage(const Resources &resources, GLuint page) const {
+  const GLuint first = page * PageSize;
+  const GLuint count = std::min(PageSize, ObjectCount - first);
+  glBindBufferRange(GL_SHADER_STORAGE_BUFFER, OBJECT_BINDING,
+                    resources.id(Objects),
+                    static_cast<GLintptr>(first) * sizeof(GpuObject),
+                    static_cast<GLsizeiptr>(count) * sizeof(GpuObject));
+}
+
+// With a divisor of 1, instance i of a command reads slot BaseInstance + i.
+void GpuCuller::enableInstanceAttribute(const Resources &resources,
+                                        GLuint index) const {
+  glBindBuffer(GL_ARRAY_BUFFER, resources.id(Instances));
+  glEnableVertexAttribArray(index);
+  glVertexAttribIPointer(index, 1, GL_UNSIGNED_INT, sizeof(GLuint), 0);
+  glVertexAttribDivisor(index, 1);
+}
+
+void GpuCuller::cull(const Resources &resources, const Bounds &view) {
+  if (ObjectCount == 0)
+    return;
+  // Only the instance counts change; the upload is one command per mesh.
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, resources.id(Commands));
+  glBufferSubData(
+      GL_DRAW_INDIRECT_BUFFER, 0,
+      static_cast<GLsizeiptr>(Reset.size() * sizeof(DrawElementsCommand)),
+      Reset.data());
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, COMMAND_BINDING,
+                   resources.id(Commands));
+  Program->bind();
+  glUniform4f(ViewId, view.Min.x, view.Min.y, view.Max.x, view.Max.y);
+  for (GLuint p = 0; p < pages(); ++p) {
+    const GLuint first = p * PageSize;
+    const GLuint count = std::min(PageSize, ObjectCount - first);
+    bindPage(resources, p);
+    glBindBufferRange(GL_SHADER_STORAGE_BUFFER, INSTANCE_BINDING,
+                      resources.id(Instances),
+                      static_cast<GLintptr>(first) * sizeof(GLuint),
+                      static_cast<GLsizeiptr>(count) * sizeof(GLuint));
+    glUniform1ui(CountId, count);
+    glUniform1ui(CommandBaseId, p * MeshCount);
+    glUniform1ui(InstanceBaseId, first);
+    glDispatchCompute((count + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE, 1, 1);
+  }
+  Program->unbind();
+  // Commands are read by the draw, instance ids by the vertex fetch, and the
+  // next frame's reset must not overtake this frame's atomics.
+  glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT |
+                  GL_BUFFER_UPDATE_BARRIER_BIT);
+}
+
+void GpuCuller::draw(const Resources &resources, GLenum mode,
+                     GLenum indexType) const {
+  if (ObjectCount == 0)
+    return;
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, resources.id(Commands));
+  for (GLuint p = 0; p < pages(); ++p) {
+    bindPage(resources, p);
+    glMultiDrawElementsIndirect(
+        mode, indexType,
+        reinterpret_cast<const GLvoid *>(static_cast<uintptr_t>(
+            size_t(p) * MeshCount * sizeof(DrawElementsCommand))),
+        static_cast<GLsizei>(MeshCount), 0);
+  }
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
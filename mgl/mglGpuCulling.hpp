@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// GPU Visibility Culling
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_GPU_CULLING_HPP
+#define MGL_GPU_CULLING_HPP
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "./mglCulling.hpp"
+#include "./mglResource.hpp"
+#include "./mglShader.hpp"
+
+namespace mgl {
+
+struct GpuObject;
+struct DrawElementsCommand;
+class GpuCuller;
+
+////////////////////////////////////////////////////////////////////// GpuObject
+
+// One object as seen by the shaders (std430 layout): its model matrix, its
+// color, its world-space bounds and the mesh it draws.
+struct GpuObject {
+  glm::mat4 ModelMatrix;
+  glm::vec4 Color;
+  Bounds Extent;
+  GLuint Mesh;
+  GLuint Padding[3];
+};
+
+// Layout fixed by glMultiDrawElementsIndirect.
+struct DrawElementsCommand {
+  GLuint Count;
+  GLuint InstanceCount;
+  GLuint FirstIndex;
+  GLint BaseVertex;
+  GLuint BaseInstance;
+};
+
+////////////////////////////////////////////////////////////////////// GpuCuller
+
+// Objects live in a shader storage buffer and are culled by a compute shader,
+// one invocation per object. There is one indirect command per mesh; each
+// mesh owns a range of the instance buffer, starting at its BaseInstance, as
+// large as the number of objects that draw it. A visible object bumps the
+// InstanceCount of its mesh's command and writes its id into the slot it got
+// back. The instance buffer is then read as a per-instance vertex attribute,
+// so the vertex shader finds its object by id, and one
+// glMultiDrawElementsIndirect draws everything: the CPU submits the same few
+// calls whatever the number of objects. Instances of a mesh come out in no
+// particular order.
+// A shader storage binding is limited in size (128MB on llvmpipe, about
+// 1.2M objects) and a dispatch in work groups, so objects are split in pages
+// that fit both. Each page has its own set of commands and ids relative to
+// the page, and is culled and drawn with its own binding: the calls grow
+// with the number of pages, which is one on most desktop GPUs.
+
+class GpuCuller {
+public:
+  static const GLuint OBJECT_BINDING = 0;
+  static const GLuint COMMAND_BINDING = 1;
+  static const GLuint INSTANCE_BINDING = 2;
+  static const GLuint WORKGROUP_SIZE = 64;
+
+  GpuCuller();
+  // Compiles the culling compute shader.
+  void create(const std::string &filename);
+  // commands holds one command per mesh with Count, FirstIndex and BaseVertex
+  // set; the rest is filled in here.
+  void build(Resources &resources, const std::vector<GpuObject> &objects,
+             const std::vector<DrawElementsCommand> &commands);
+  void clear(Resources &resources);
+  size_t size() const;
+
+  // Sets the per-instance object id attribute on the bound VAO.
+  void enableInstanceAttribute(const Resources &resources, GLuint index) const;
+  // Fills the indirect commands with the objects overlapping view.
+  void cull(const Resources &resources, const Bounds &view);
+  // Draws the culled objects with the bound VAO and program; the program may
+  // read the objects at OBJECT_BINDING.
+  void draw(const Resources &resources, GLenum mode, GLenum indexType) const;
+
+private:
+  std::unique_ptr<ShaderProgram> Program;
+  GLint ViewId, CountId, CommandBaseId, InstanceBaseId;
+  BufferHandle Objects, Commands, Instances;
+  std::vector<DrawElementsCommand> Reset; // per page, per mesh
+  GLuint ObjectCount, MeshCount, PageSize;
+
+  GLuint pages() const;
+  void bindPage(const Resources &resources, GLuint page) const;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_GPU_CULLING_HPP */
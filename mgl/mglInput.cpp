@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Input Events, Recording and Playback
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "./mglInput.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <iterator>
+
+namespace mgl {
+
+const char INPUT_MAGIC[4] = {'M', 'G', 'L', 'I'};
+const size_t INPUT_FLUSH_SIZE = 64 * 1024;
+
+template <typename T> static void put(std::vector<char> &buffer, T value) {
+  const char *bytes = reinterpret_cast<const char *>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+static bool get(const std::vector<char> &buffer, size_t &offset, T &value) {
+  if (offset + sizeof(T) > buffer.size())
+    return false;
+  std::memcpy(&value, buffer.data() + offset, sizeof(T));
+  offset += sizeof(T);
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////// InputQueue
+
+InputQueue::InputQueue() : Head(0), Tail(0), Dropped(0) {}
+
+bool InputQueue::push(const InputEvent &event) {
+  const GLuint tail = Tail.load(std::memory_order_relaxed);
+  if (tail - Head.load(std::memory_order_acquire) == CAPACITY) {
+    if (Dropped.fetch_add(1, std::memory_order_relaxed) == 0) {
+      std::cerr << "[WARNING] Input queue full, dropping events" << std::endl;
+    }
+    return false;
+  }
+  Ring[tail & (CAPACITY - 1)] = event;
+  Tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+bool InputQueue::pop(InputEvent &event) { return pop(&event, 1) == 1; }
+
+size_t InputQueue::pop(InputEvent *events, size_t max) {
+  const GLuint head = Head.load(std::memory_order_relaxed);
+  const GLuint available = Tail.load(std::memory_order_acquire) - head;
+  const GLuint n = available < max ? available : static_cast<GLuint>(max);
+  for (GLuint i = 0; i < n; ++i) {
+    events[i] = Ring[(head + i) & (CAPACITY - 1)];
+  }
+  Head.store(head + n, std::memory_order_release);
+  return n;
+}
+
+bool InputQueue::empty() const {
+  return Head.load(std::memory_order_acquire) ==
+         Tail.load(std::memory_order_acquire);
+}
+
+GLuint InputQueue::dropped() const {
+  return Dropped.load(std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////// InputRecorder
+
+InputRecorder::InputRecorder(const std::string &filename, double timestep)
+    : File(filename, std::ios::binary), Events(0) {
+  if (!File.is_open()) {
+    std::cerr << "[ERROR] Failed to open input log: " << filename << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  Buffer.reserve(INPUT_FLUSH_SIZE + 64);
+  Buffer.insert(Buffer.end(), INPUT_MAGIC, INPUT_MAGIC + 4);
+  put<GLuint>(Buffer, VERSION);
+  put<double>(Buffer, timestep);
+}
+
+InputRecorder::~InputRecorder() { flush(); }
+
+GLuint InputRecorder::events() const { return Events; }
+
+void InputRecorder::flush() {
+  File.write(Buffer.data(), Buffer.size());
+  File.flush();
+  Buffer.clear();
+}
+
+void InputRecorder::write(const InputEvent &e) {
+  put<GLubyte>(Buffer, static_cast<GLubyte>(e.Type));
+  put<GLuint>(Buffer, e.Frame);
+  switch (e.Type) {
+  case InputType::Frame:
+    put<double>(Buffer, e.X);
+    break;
+  case InputType::Key:
+    put<float>(Buffer, e.Time);
+    put<GLshort>(Buffer, static_cast<GLshort>(e.A));
+    put<GLint>(Buffer, e.B);
+    put<GLubyte>(Buffer, static_cast<GLubyte>(e.C));
+    put<GLubyte>(Buffer, static_cast<GLubyte>(e.D));
+    break;
+  case InputType::Cursor:
+  case InputType::Scroll:
+    put<float>(Buffer, e.Time);
+    put<double>(Buffer, e.X);
+    put<double>(Buffer, e.Y);
+    break;
+  case InputType::MouseButton:
+    put<float>(Buffer, e.Time);
+    put<GLubyte>(Buffer, static_cast<GLubyte>(e.A));
+    put<GLubyte>(Buffer, static_cast<GLubyte>(e.C));
+    put<GLubyte>(Buffer, static_cast<GLubyte>(e.D));
+    break;
+  case InputType::Joystick:
+  case InputType::WindowSize:
+    put<float>(Buffer, e.Time);
+    put<GLint>(Buffer, e.A);
+    put<GLint>(Buffer, e.B);
+    break;
+  }
+  ++Events;
+  if (Buffer.size() >= INPUT_FLUSH_SIZE)
+    flush();
+}
+
+//////////////////////////////////////////////////////////////////// InputPlayer
+
+InputPlayer::InputPlayer(const std::string &filename)
+    : Cursor(0), Timestep(0.0), Frames(0) {
+  std::ifstream ifile(filename, std::ios::binary);
+  if (!ifile.is_open()) {
+    std::cerr << "[ERROR] Failed to open input log: " << filename << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  const std::vector<char> buffer((std::istreambuf_iterator<char>(ifile)),
+                                 std::istreambuf_iterator<char>());
+  size_t offset = 4;
+  GLuint version = 0;
+  if (buffer.size() < 4 || std::memcmp(buffer.data(), INPUT_MAGIC, 4) != 0 ||
+      !get(buffer, offset, version) || version != InputRecorder::VERSION ||
+      !get(buffer, offset, Timestep)) {
+    std::cerr << "[ERROR] Not a valid input log: " << filename << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  GLubyte type;
+  while (get(buffer, offset, type)) {
+    InputEvent e = {static_cast<InputType>(type), 0, 0.0f, 0, 0, 0, 0, 0.0, 0.0};
+    GLshort s16 = 0;
+    GLubyte u8[3] = {0, 0, 0};
+    bool ok = get(buffer, offset, e.Frame);
+    switch (e.Type) {
+    case InputType::Frame:
+      ok = ok && get(buffer, offset, e.X);
+      Frames = e.Frame + 1;
+      break;
+    case InputType::Key:
+      ok = ok && get(buffer, offset, e.Time) && get(buffer, offset, s16) &&
+           get(buffer, offset, e.B) && get(buffer, offset, u8[0]) &&
+           get(buffer, offset, u8[1]);
+      e.A = s16, e.C = u8[0], e.D = u8[1];
+      break;
+    case InputType::Cursor:
+    case InputType::Scroll:
+      ok = ok && get(buffer, offset, e.Time) && get(buffer, offset, e.X) &&
+           get(buffer, offset, e.Y);
+      break;
+    case InputType::MouseButton:
+      ok = ok && get(buffer, offset, e.Time) && get(buffer, offset, u8[0]) &&
+           get(buffer, offset, u8[1]) && get(buffer, offset, u8[2]);
+      e.A = u8[0], e.C = u8[1], e.D = u8[2];
+      break;
+    case InputType::Joystick:
+    case InputType::WindowSize:
+      ok = ok && get(buffer, offset, e.Time) && get(buffer, offset, e.A) &&
+           get(buffer, offset, e.B);
+      break;
+    default:
+      ok = false;
+    }
+    if (!ok) {
+      std::cerr << "[WARNING] Truncated input log: " << filename << std::endl;
+      break;
+    }
+    Events.push_back(e);
+  }
+}
+
+double InputPlayer::timestep() const { return Timestep; }
+
+GLuint InputPlayer::frames() const { return Frames; }
+
+bool InputPlayer::finished() const { return Cursor >= Events.size(); }
+
+bool InputPlayer::next(GLuint frame, InputEvent &event) {
+  if (Cursor >= Events.size() || Events[Cursor].Frame != frame)
+    return false;
+  event = Events[Cursor++];
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Input Events, Recording and Playback
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_INPUT_HPP
+#define MGL_INPUT_HPP
+
+#include <GL/glew.h>
+
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace mgl {
+
+struct InputEvent;
+class InputQueue;
+class InputRecorder;
+class InputPlayer;
+
+///////////////////////////////////////////////////////////////////// InputEvent
+
+enum class InputType : GLubyte {
+  Frame,
+  Key,
+  Cursor,
+  MouseButton,
+  Scroll,
+  Joystick,
+  WindowSize
+};
+
+// Compact POD record of one GLFW callback. Field use depends on Type:
+//   Frame        X = elapsed time of the frame
+//   Key          A = key, B = scancode, C = action, D = mods
+//   Cursor       X, Y = position
+//   MouseButton  A = button, C = action, D = mods
+//   Scroll       X, Y = offset
+//   Joystick     A = jid, B = event
+//   WindowSize   A = width, B = height
+struct InputEvent {
+  InputType Type;
+  GLuint Frame;
+  float Time;
+  GLint A, B, C, D;
+  double X, Y;
+};
+
+///////////////////////////////////////////////////////////////////// InputQueue
+
+// Lock-free single-producer/single-consumer ring of input events. The engine
+// pushes from the GLFW callbacks on the main thread; the consumer may be the
+// main thread (default dispatch) or a dedicated input thread.
+
+class InputQueue {
+public:
+  static const GLuint CAPACITY = 4096; // power of two
+
+  InputQueue();
+  bool push(const InputEvent &event);
+  bool pop(InputEvent &event);
+  size_t pop(InputEvent *events, size_t max);
+  bool empty() const;
+  GLuint dropped() const;
+
+private:
+  InputEvent Ring[CAPACITY];
+  alignas(64) std::atomic<GLuint> Head; // next slot to read
+  alignas(64) std::atomic<GLuint> Tail; // next slot to write
+  std::atomic<GLuint> Dropped; // read by any thread
+};
+
+////////////////////////////////////////////////////////////////// InputRecorder
+
+// Binary log: "MGLI", version, fixed timestep (0 if variable), then one
+// variable-size record per event. Data is stored in native byte order.
+
+class InputRecorder {
+public:
+  static const GLuint VERSION = 1;
+
+  InputRecorder(const std::string &filename, double timestep);
+  ~InputRecorder();
+  void write(const InputEvent &event);
+  GLuint events() const;
+
+private:
+  std::ofstream File;
+  std::vector<char> Buffer;
+  GLuint Events;
+  void flush();
+};
+
+//////////////////////////////////////////////////////////////////// InputPlayer
+
+class InputPlayer {
+public:
+  explicit InputPlayer(const std::string &filename);
+  // Fixed timestep the log was recorded with, 0 if variable.
+  double timestep() const;
+  GLuint frames() const;
+  bool finished() const;
+  // Next recorded event of the given frame; false once the frame is exhausted.
+  bool next(GLuint frame, InputEvent &event);
+
+private:
+  std::vector<InputEvent> Events;
+  size_t Cursor;
+  double Timestep;
+  GLuint Frames;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_INPUT_HPP */
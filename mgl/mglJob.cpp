@@ -0,0 +1,235 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Work-Stealing Job System
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "./mglJob.hpp"
+
+#include <iostream>
+
+namespace mgl {
+
+static thread_local JobSystem *CurrentSystem = 0;
+static thread_local GLuint CurrentWorker = 0;
+
+///////////////////////////////////////////////////////////////////// JobCounter
+
+JobCounter::JobCounter() : Count(0) {}
+
+bool JobCounter::done() const {
+  return Count.load(std::memory_order_acquire) == 0;
+}
+
+/////////////////////////////////////////////////////////////////////// JobQueue
+
+JobQueue::JobQueue() : Top(0), Bottom(0) {
+  for (std::atomic<JobSlot *> &slot : Buffer)
+    slot.store(0, std::memory_order_relaxed);
+}
+
+bool JobQueue::push(JobSlot *job) {
+  const int64_t b = Bottom.load(std::memory_order_relaxed);
+  const int64_t t = Top.load(std::memory_order_acquire);
+  if (b - t >= CAPACITY)
+    return false;
+  Buffer[b & (CAPACITY - 1)].store(job, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  Bottom.store(b + 1, std::memory_order_relaxed);
+  return true;
+}
+
+JobSlot *JobQueue::pop() {
+  const int64_t b = Bottom.load(std::memory_order_relaxed) - 1;
+  Bottom.store(b, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t t = Top.load(std::memory_order_relaxed);
+  if (t > b) {
+    Bottom.store(b + 1, std::memory_order_relaxed);
+    return 0;
+  }
+  JobSlot *job = Buffer[b & (CAPACITY - 1)].load(std::memory_order_relaxed);
+  if (t == b) {
+    // Last job: race against thieves for it.
+    if (!Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                     std::memory_order_relaxed))
+      job = 0;
+    Bottom.store(b + 1, std::memory_order_relaxed);
+  }
+  return job;
+}
+
+JobSlot *JobQueue::steal() {
+  int64_t t = Top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const int64_t b = Bottom.load(std::memory_order_acquire);
+  if (t >= b)
+    return 0;
+  JobSlot *job = Buffer[t & (CAPACITY - 1)].load(std::memory_order_relaxed);
+  if (!Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                   std::memory_order_relaxed))
+    return 0;
+  return job;
+}
+
+////////////////////////////////////////////////////////////////////// JobSystem
+
+JobSystem::JobSystem(GLuint workers) : Quit(false), Sleeping(0) {
+  if (workers == 0)
+    workers = 1;
+  for (GLuint i = 0; i < workers; ++i) {
+    Worker *worker = new Worker;
+    for (JobSlot &slot : worker->Slots)
+      slot.Busy.store(false, std::memory_order_relaxed);
+    worker->Random = 2654435761u * (i + 1);
+    Workers.push_back(worker);
+  }
+  CurrentSystem = this;
+  CurrentWorker = 0;
+  for (GLuint i = 1; i < workers; ++i) {
+    Threads.emplace_back(&JobSystem::loop, this, i);
+  }
+}
+
+JobSystem::~JobSystem() {
+  {
+    std::lock_guard<std::mutex> lock(Lock);
+    Quit.store(true, std::memory_order_release);
+  }
+  Wake.notify_all();
+  for (std::thread &thread : Threads)
+    thread.join();
+  for (Worker *worker : Workers)
+    delete worker;
+  if (CurrentSystem == this)
+    CurrentSystem = 0;
+}
+
+GLuint JobSystem::workers() const {
+  return static_cast<GLuint>(Workers.size());
+}
+
+GLuint JobSystem::workerIndex() { return CurrentWorker; }
+
+void JobSystem::run(const Job &job) {
+  if (CurrentSystem != this) {
+    std::cerr << "[ERROR] Job submitted from a thread outside the job system"
+              << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  Worker &worker = *Workers[CurrentWorker];
+  if (job.Counter)
+    job.Counter->Count.fetch_add(1, std::memory_order_relaxed);
+  JobSlot *slot = &worker.Slots[worker.Next++ & (JobQueue::CAPACITY - 1)];
+  while (slot->Busy.load(std::memory_order_acquire)) {
+    JobSlot *pending = find(worker); // slot still in use: help drain jobs
+    if (pending)
+      execute(worker, pending);
+    else
+      std::this_thread::yield();
+  }
+  slot->Work = job;
+  slot->Busy.store(true, std::memory_order_relaxed);
+  while (!worker.Queue.push(slot)) {
+    JobSlot *pending = worker.Queue.pop(); // queue full: help drain it
+    if (pending)
+      execute(worker, pending);
+  }
+  notify();
+}
+
+// Pairs with park(): either the parking worker sees the pushed job, or this
+// sees the worker counted in Sleeping and wakes one.
+void JobSystem::notify() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (Sleeping.load(std::memory_order_relaxed) == 0)
+    return;
+  {
+    std::lock_guard<std::mutex> lock(Lock);
+    ++Signals;
+  }
+  Wake.notify_one();
+}
+
+void JobSystem::wait(const JobCounter &counter) {
+  Worker &worker = *Workers[CurrentWorker];
+  while (!counter.done()) {
+    JobSlot *job = find(worker);
+    if (job) {
+      execute(worker, job);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+JobSlot *JobSystem::find(Worker &worker) {
+  JobSlot *job = worker.Queue.pop();
+  if (job || Workers.size() == 1)
+    return job;
+  const GLuint n = static_cast<GLuint>(Workers.size());
+  for (GLuint attempt = 0; attempt < n; ++attempt) {
+    worker.Random ^= worker.Random << 13; // xorshift32
+    worker.Random ^= worker.Random >> 17;
+    worker.Random ^= worker.Random << 5;
+    Worker *victim = Workers[worker.Random % n];
+    if (victim != &worker && (job = victim->Queue.steal()))
+      return job;
+  }
+  return 0;
+}
+
+void JobSystem::execute(Worker &worker, JobSlot *slot) {
+  const Job job = slot->Work;
+  slot->Busy.store(false, std::memory_order_release);
+  if (job.Dependency)
+    wait(*job.Dependency); // runs other jobs meanwhile
+  job.Function(job);
+  if (job.Counter)
+    job.Counter->Count.fetch_sub(1, std::memory_order_release);
+}
+
+void JobSystem::loop(GLuint index) {
+  CurrentSystem = this;
+  CurrentWorker = index;
+  Worker &worker = *Workers[index];
+  GLuint idle = 0;
+  while (!Quit.load(std::memory_order_acquire)) {
+    JobSlot *job = find(worker);
+    if (job) {
+      execute(worker, job);
+      idle = 0;
+    } else if (++idle < 1024) {
+      std::this_thread::yield();
+    } else {
+      park(worker);
+      idle = 0;
+    }
+  }
+}
+
+// Counts the worker as sleeping before looking for work one last time, so a
+// job pushed meanwhile is either found here or followed by a wake-up.
+void JobSystem::park(Worker &worker) {
+  Sleeping.fetch_add(1, std::memory_order_seq_cst);
+  JobSlot *job = find(worker);
+  if (job) {
+    Sleeping.fetch_sub(1, std::memory_order_relaxed);
+    execute(worker, job);
+    return;
+  }
+  {
+    std::unique_lock<std::mutex> lock(Lock);
+    Wake.wait(lock, [this]() {
+      return Signals > 0 || Quit.load(std::memory_order_acquire);
+    });
+    if (Signals > 0)
+      --Signals;
+  }
+  Sleeping.fetch_sub(1, std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Work-Stealing Job System
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_JOB_HPP
+#define MGL_JOB_HPP
+
+#include <GL/glew.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace mgl {
+
+struct Job;
+struct JobSlot;
+class JobCounter;
+class JobQueue;
+class JobSystem;
+
+//////////////////////////////////////////////////////////////////////////// Job
+
+typedef void (*JobFunction)(const Job &job);
+
+struct Job {
+  JobFunction Function;
+  void *Data;
+  GLuint Begin, End;
+  JobCounter *Counter;              // decremented when the job completes
+  const JobCounter *Dependency = 0; // job starts once this reaches zero
+};
+
+// Storage of a submitted job. The slot stays busy until a worker has copied
+// the job out of it, so the submitting worker never overwrites a job that is
+// still queued or that a thief has stolen but not yet read.
+
+struct JobSlot {
+  Job Work;
+  std::atomic<bool> Busy;
+};
+
+///////////////////////////////////////////////////////////////////// JobCounter
+
+class JobCounter {
+public:
+  JobCounter();
+  bool done() const;
+
+private:
+  std::atomic<GLuint> Count;
+  friend class JobSystem;
+};
+
+/////////////////////////////////////////////////////////////////////// JobQueue
+
+// Chase-Lev deque: the owning worker pushes and pops at the bottom, other
+// workers steal from the top. Fixed capacity, no allocation after creation.
+
+class JobQueue {
+public:
+  static const int64_t CAPACITY = 4096; // power of two
+
+  JobQueue();
+  bool push(JobSlot *slot);
+  JobSlot *pop();
+  JobSlot *steal();
+
+private:
+  alignas(64) std::atomic<int64_t> Top;
+  alignas(64) std::atomic<int64_t> Bottom;
+  std::atomic<JobSlot *> Buffer[CAPACITY];
+};
+
+////////////////////////////////////////////////////////////////////// JobSystem
+
+// Worker 0 is the thread that creates the system; it runs jobs while it
+// waits on a counter. Jobs may only be submitted from worker threads.
+// Each worker recycles its job storage in a ring of JobQueue::CAPACITY
+// slots; when the next slot is still busy, run() executes queued jobs until
+// it is released, so any number of jobs may be submitted.
+// Idle workers spin briefly, then park until run() or the destructor wakes
+// them, so a system kept between frames costs no CPU while it has no work.
+
+class JobSystem {
+public:
+  explicit JobSystem(GLuint workers = std::thread::hardware_concurrency());
+  ~JobSystem();
+  GLuint workers() const;
+  static GLuint workerIndex();
+
+  void run(const Job &job);
+  void wait(const JobCounter &counter);
+
+  // Calls body(begin, end) over [0, count) in ranges of at most batch items
+  // and returns when all of them have completed.
+  template <typename F> void parallelFor(GLuint count, GLuint batch, F &&body);
+
+private:
+  struct Worker {
+    JobQueue Queue;
+    JobSlot Slots[JobQueue::CAPACITY];
+    GLuint Next = 0;
+    GLuint Random = 0;
+  };
+  std::vector<Worker *> Workers;
+  std::vector<std::thread> Threads;
+  std::atomic<bool> Quit;
+  std::atomic<GLuint> Sleeping; // workers parked or about to park
+  std::mutex Lock;
+  std::condition_variable Wake;
+  GLuint Signals = 0; // wake-ups not yet taken, guarded by Lock
+
+  void loop(GLuint index);
+  void park(Worker &worker);
+  void notify();
+  JobSlot *find(Worker &worker);
+  void execute(Worker &worker, JobSlot *slot);
+
+  template <typename F> static void invoke(const Job &job) {
+    (*static_cast<F *>(job.Data))(job.Begin, job.End);
+  }
+};
+
+template <typename F>
+void JobSystem::parallelFor(GLuint count, GLuint batch, F &&body) {
+  typedef typename std::remove_reference<F>::type Body;
+  JobCounter counter;
+  if (batch == 0)
+    batch = 1;
+  for (GLuint begin = 0; begin < count; begin += batch) {
+    const GLuint end = (count - begin > batch) ? begin + batch : count;
+    run({&invoke<Body>, const_cast<void *>(static_cast<const void *>(&body)),
+         begin, end, &counter});
+  }
+  wait(counter);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_JOB_HPP */
@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Streaming Asset Loader
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "./mglLoader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace mgl {
+
+//////////////////////////////////////////////////////////////// StreamingLoader
+
+StreamingLoader::StreamingLoader(GLFWwindow *window)
+    : BytesUploaded(0), BytesTotal(0), Pending(0), Quit(false) {
+  glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+  Context = glfwCreateWindow(1, 1, "", 0, window);
+  glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+  if (!Context) {
+    std::cerr << "[ERROR] Failed to create loader context" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  Thread = std::thread(&StreamingLoader::loop, this);
+}
+
+// Uploads still in flight are dropped; the window's context must be current.
+StreamingLoader::~StreamingLoader() {
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    Quit = true;
+  }
+  Wake.notify_one();
+  Thread.join();
+  for (Upload &upload : Uploaded)
+    release(upload);
+  glfwDestroyWindow(Context);
+}
+
+bool StreamingLoader::load(const std::string &filename) {
+  std::unique_ptr<AssetPack> pack = std::make_unique<AssetPack>();
+  if (!pack->open(filename))
+    return false;
+  uint64_t bytes = 0;
+  for (PackSection type : {PackSection::Vertices, PackSection::Indices}) {
+    if (const PackSectionEntry *entry = pack->section(type))
+      bytes += entry->Size;
+  }
+  BytesTotal += bytes;
+  ++Pending;
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    Queued.push_back({filename, std::move(pack), 0, 0, 0});
+  }
+  Wake.notify_one();
+  return true;
+}
+
+bool StreamingLoader::collect(Resources &resources, LoadedPack &loaded) {
+  Upload upload;
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Uploaded.empty())
+      return false;
+    const GLenum status = glClientWaitSync(Uploaded.front().Fence, 0, 0);
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+      return false;
+    upload = std::move(Uploaded.front());
+    Uploaded.pop_front();
+  }
+  glDeleteSync(upload.Fence);
+
+  loaded.Filename = upload.Filename;
+  loaded.Vertices = loaded.Indices = BufferHandle();
+  const AssetPack &pack = *upload.Pack;
+  const PackSectionEntry *vertices = pack.section(PackSection::Vertices);
+  const PackSectionEntry *indices = pack.section(PackSection::Indices);
+  if (upload.Vertices) {
+    loaded.Vertices =
+        resources.adoptBuffer(upload.Vertices, GL_ARRAY_BUFFER,
+                              static_cast<GLsizeiptr>(vertices->Size));
+  }
+  if (upload.Indices) {
+    loaded.Indices =
+        resources.adoptBuffer(upload.Indices, GL_ELEMENT_ARRAY_BUFFER,
+                              static_cast<GLsizeiptr>(indices->Size));
+  }
+  loaded.Pack = std::move(upload.Pack);
+  --Pending;
+  return true;
+}
+
+float StreamingLoader::progress() const {
+  const uint64_t total = BytesTotal.load();
+  return total ? float(double(BytesUploaded.load()) / double(total)) : 1.0f;
+}
+
+bool StreamingLoader::busy() const { return Pending.load() != 0; }
+
+void StreamingLoader::loop() {
+  glfwMakeContextCurrent(Context);
+  for (;;) {
+    Upload upload;
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      Wake.wait(lock, [this] { return Quit || !Queued.empty(); });
+      if (Quit)
+        break;
+      upload = std::move(Queued.front());
+      Queued.pop_front();
+    }
+    upload.Vertices = uploadSection(*upload.Pack, PackSection::Vertices);
+    upload.Indices = uploadSection(*upload.Pack, PackSection::Indices);
+    upload.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush(); // makes the fence visible to the other context
+    std::lock_guard<std::mutex> lock(Mutex);
+    Uploaded.push_back(std::move(upload));
+  }
+  glfwMakeContextCurrent(0);
+}
+
+// Buffers are filled through GL_COPY_WRITE_BUFFER: element array bindings
+// belong to a VAO, and the loader context has none.
+GLuint StreamingLoader::uploadSection(const AssetPack &pack,
+                                      PackSection type) {
+  const GLenum target = GL_COPY_WRITE_BUFFER;
+  const PackSectionEntry *entry = pack.section(type);
+  if (!entry || entry->Size == 0)
+    return 0;
+  const char *data = static_cast<const char *>(pack.data(type));
+  const GLsizeiptr size = static_cast<GLsizeiptr>(entry->Size);
+
+  GLuint id;
+  glGenBuffers(1, &id);
+  glBindBuffer(target, id);
+  glBufferStorage(target, size, 0,
+                  GL_MAP_WRITE_BIT | GL_DYNAMIC_STORAGE_BIT);
+  for (GLsizeiptr offset = 0; offset < size;) {
+    const GLsizeiptr chunk = std::min<GLsizeiptr>(
+        size - offset, static_cast<GLsizeiptr>(CHUNK_SIZE));
+    void *mapped = glMapBufferRange(target, offset, chunk,
+                                    GL_MAP_WRITE_BIT |
+                                        GL_MAP_INVALIDATE_RANGE_BIT |
+                                        GL_MAP_UNSYNCHRONIZED_BIT);
+    if (!mapped) {
+      std::cerr << "[WARNING] Failed to map buffer, uploading directly"
+                << std::endl;
+      glBufferSubData(target, offset, size - offset, data + offset);
+      BytesUploaded += static_cast<uint64_t>(size - offset);
+      break;
+    }
+    std::memcpy(mapped, data + offset, static_cast<size_t>(chunk));
+    glUnmapBuffer(target);
+    BytesUploaded += static_cast<uint64_t>(chunk);
+    offset += chunk;
+  }
+  glBindBuffer(target, 0);
+  return id;
+}
+
+void StreamingLoader::release(Upload &upload) {
+  glDeleteSync(upload.Fence);
+  glDeleteBuffers(1, &upload.Vertices);
+  glDeleteBuffers(1, &upload.Indices);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Streaming Asset Loader
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_LOADER_HPP
+#define MGL_LOADER_HPP
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "./mglPack.hpp"
+#include "./mglResource.hpp"
+
+namespace mgl {
+
+struct LoadedPack;
+class StreamingLoader;
+
+///////////////////////////////////////////////////////////////////// LoadedPack
+
+struct LoadedPack {
+  std::string Filename;
+  std::unique_ptr<AssetPack> Pack;
+  BufferHandle Vertices, Indices;
+};
+
+//////////////////////////////////////////////////////////////// StreamingLoader
+
+// Uploads asset packs on a background thread that owns a hidden GLFW context
+// sharing objects with the window's context. Blob sections are copied into
+// immutable buffers through mapped ranges of CHUNK_SIZE bytes, so progress()
+// moves smoothly and the pack's pages are touched a chunk at a time; a fence
+// then marks the upload as complete.
+// The render thread calls collect() between frames to take over packs whose
+// fence has signalled. Vertex array objects are not shared between contexts
+// and must be created by the render thread.
+
+class StreamingLoader {
+public:
+  static const size_t CHUNK_SIZE = 4 * 1024 * 1024;
+
+  // Must be called on the main thread with the window's context current.
+  explicit StreamingLoader(GLFWwindow *window);
+  ~StreamingLoader();
+  StreamingLoader(const StreamingLoader &) = delete;
+  void operator=(const StreamingLoader &) = delete;
+
+  // Maps the pack at once (cheap) and queues its upload.
+  bool load(const std::string &filename);
+  // Hands over the next fully uploaded pack, registering its buffers.
+  bool collect(Resources &resources, LoadedPack &loaded);
+  float progress() const;
+  bool busy() const;
+
+private:
+  struct Upload {
+    std::string Filename;
+    std::unique_ptr<AssetPack> Pack;
+    GLuint Vertices, Indices;
+    GLsync Fence;
+  };
+  GLFWwindow *Context;
+  std::thread Thread;
+  std::mutex Mutex;
+  std::condition_variable Wake;
+  std::deque<Upload> Queued, Uploaded;
+  std::atomic<uint64_t> BytesUploaded, BytesTotal;
+  std::atomic<GLuint> Pending;
+  bool Quit;
+
+  void loop();
+  GLuint uploadSection(const AssetPack &pack, PackSection type);
+  void release(Upload &upload);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_LOADER_HPP */
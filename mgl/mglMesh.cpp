@@ -0,0 +1,374 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Mesh Optimisation
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#define GLM_ENABLE_EXPERIMENTAL
+#endif
+
+#include "./mglMesh.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include <glm/gtx/hash.hpp>
+
+namespace mgl {
+
+////////////////////////////////////////////////////////////////////// MeshStats
+
+namespace {
+
+// FIFO cache simulated with timestamps: a vertex is in the cache if fewer
+// than cacheSize misses happened since it was last loaded.
+class FifoCache {
+public:
+  FifoCache(size_t vertexCount, GLuint cacheSize)
+      : Loaded(vertexCount, 0), Size(cacheSize), Time(cacheSize + 1) {}
+
+  GLuint miss(GLuint vertex) {
+    if (Time - Loaded[vertex] <= Size)
+      return 0;
+    Loaded[vertex] = Time++;
+    return 1;
+  }
+
+  GLuint miss(const GLuint *triangle) {
+    return miss(triangle[0]) + miss(triangle[1]) + miss(triangle[2]);
+  }
+
+  void flush() { Time += Size + 1; }
+  bool referenced(GLuint vertex) const { return Loaded[vertex] != 0; }
+
+private:
+  std::vector<GLuint> Loaded;
+  GLuint Size, Time;
+};
+
+} // namespace
+
+MeshStats analyzeVertexCache(const std::vector<GLuint> &indices,
+                             size_t vertexCount, GLuint cacheSize) {
+  FifoCache cache(vertexCount, cacheSize);
+  size_t misses = 0, referenced = 0;
+  for (GLuint index : indices)
+    misses += cache.miss(index);
+  for (GLuint v = 0; v < vertexCount; ++v)
+    referenced += cache.referenced(v) ? 1 : 0;
+  const size_t triangles = indices.size() / 3;
+  return {triangles ? float(misses) / float(triangles) : 0.0f,
+          referenced ? float(misses) / float(referenced) : 0.0f};
+}
+
+///////////////////////////////////////////////////////////////////////// Weld
+
+namespace {
+
+template <typename V>
+size_t weld(std::vector<V> &positions, std::vector<GLuint> &indices,
+            float epsilon) {
+  std::unordered_map<V, GLuint> cells;
+  cells.reserve(positions.size());
+  std::vector<GLuint> remap(positions.size());
+  std::vector<V> welded;
+  welded.reserve(positions.size());
+
+  for (size_t i = 0; i < positions.size(); ++i) {
+    const V key = epsilon > 0.0f ? glm::round(positions[i] / epsilon)
+                                 : positions[i];
+    auto cell = cells.emplace(key, static_cast<GLuint>(welded.size()));
+    if (cell.second)
+      welded.push_back(positions[i]);
+    remap[i] = cell.first->second;
+  }
+
+  size_t kept = 0;
+  for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+    const GLuint a = remap[indices[t]], b = remap[indices[t + 1]],
+                 c = remap[indices[t + 2]];
+    if (a == b || b == c || c == a)
+      continue;
+    indices[kept++] = a;
+    indices[kept++] = b;
+    indices[kept++] = c;
+  }
+  indices.resize(kept);
+  positions.swap(welded);
+  return positions.size();
+}
+
+} // namespace
+
+size_t weldVertices(std::vector<glm::vec2> &positions,
+                    std::vector<GLuint> &indices, float epsilon) {
+  return weld(positions, indices, epsilon);
+}
+
+size_t weldVertices(std::vector<glm::vec3> &positions,
+                    std::vector<GLuint> &indices, float epsilon) {
+  return weld(positions, indices, epsilon);
+}
+
+/////////////////////////////////////////////////////////////////// Vertex Cache
+
+namespace {
+
+const GLuint SCORE_CACHE_SIZE = 32;
+const GLuint SCORE_VALENCE_SIZE = 32;
+const GLuint NO_TRIANGLE = ~0u;
+
+// Forsyth's scoring: recently used vertices score high (the last triangle's
+// vertices a little less, to avoid strips), and vertices with few remaining
+// triangles get a boost so that they are finished off and leave no holes.
+struct ScoreTables {
+  float Cache[SCORE_CACHE_SIZE];
+  float Valence[SCORE_VALENCE_SIZE];
+
+  ScoreTables() {
+    const float CACHE_DECAY_POWER = 1.5f;
+    const float LAST_TRIANGLE_SCORE = 0.75f;
+    const float VALENCE_BOOST_SCALE = 2.0f;
+    const float VALENCE_BOOST_POWER = 0.5f;
+    for (GLuint i = 0; i < SCORE_CACHE_SIZE; ++i) {
+      Cache[i] = i < 3 ? LAST_TRIANGLE_SCORE
+                       : std::pow(1.0f - float(i - 3) / (SCORE_CACHE_SIZE - 3),
+                                  CACHE_DECAY_POWER);
+    }
+    Valence[0] = 0.0f;
+    for (GLuint i = 1; i < SCORE_VALENCE_SIZE; ++i) {
+      Valence[i] =
+          VALENCE_BOOST_SCALE * std::pow(float(i), -VALENCE_BOOST_POWER);
+    }
+  }
+
+  float score(GLint position, GLuint valence) const {
+    if (valence == 0)
+      return -1.0f;
+    return (position < 0 ? 0.0f : Cache[position]) +
+           Valence[std::min(valence, SCORE_VALENCE_SIZE - 1)];
+  }
+};
+
+} // namespace
+
+void optimizeVertexCache(std::vector<GLuint> &indices, size_t vertexCount) {
+  static const ScoreTables tables;
+  const size_t triangleCount = indices.size() / 3;
+  if (triangleCount == 0)
+    return;
+
+  // Triangles adjacent to each vertex; the first Valence[v] entries of a
+  // vertex's range are the triangles not yet emitted.
+  std::vector<GLuint> valence(vertexCount, 0), offsets(vertexCount + 1, 0);
+  for (size_t i = 0; i < triangleCount * 3; ++i)
+    ++valence[indices[i]];
+  for (size_t v = 0; v < vertexCount; ++v)
+    offsets[v + 1] = offsets[v] + valence[v];
+  std::vector<GLuint> adjacency(triangleCount * 3), fill(offsets);
+  for (size_t i = 0; i < triangleCount * 3; ++i)
+    adjacency[fill[indices[i]]++] = static_cast<GLuint>(i / 3);
+
+  std::vector<GLint> position(vertexCount, -1);
+  std::vector<float> score(vertexCount);
+  for (size_t v = 0; v < vertexCount; ++v)
+    score[v] = tables.score(-1, valence[v]);
+
+  GLuint best = 0;
+  float bestScore = -1.0f;
+  for (GLuint t = 0; t < triangleCount; ++t) {
+    const GLuint *tri = &indices[t * 3];
+    const float s = score[tri[0]] + score[tri[1]] + score[tri[2]];
+    if (s > bestScore) {
+      best = t;
+      bestScore = s;
+    }
+  }
+
+  std::vector<GLuint> output;
+  output.reserve(triangleCount * 3);
+  std::vector<GLubyte> emitted(triangleCount, 0);
+  GLuint cache[SCORE_CACHE_SIZE + 3], next[SCORE_CACHE_SIZE + 3];
+  GLuint cached = 0;
+  size_t cursor = 0;
+
+  for (size_t count = 0; count < triangleCount; ++count) {
+    if (best == NO_TRIANGLE) {
+      while (emitted[cursor])
+        ++cursor;
+      best = static_cast<GLuint>(cursor);
+    }
+    const GLuint *tri = &indices[best * 3];
+    output.insert(output.end(), tri, tri + 3);
+    emitted[best] = 1;
+
+    GLuint size = 0;
+    for (GLuint k = 0; k < 3; ++k) {
+      const GLuint v = tri[k];
+      GLuint *begin = &adjacency[offsets[v]];
+      GLuint *found = std::find(begin, begin + valence[v], best);
+      if (found != begin + valence[v]) {
+        *found = begin[--valence[v]];
+        next[size++] = v;
+      }
+    }
+    for (GLuint i = 0; i < cached; ++i) {
+      const GLuint v = cache[i];
+      if (v != tri[0] && v != tri[1] && v != tri[2])
+        next[size++] = v;
+    }
+
+    // Vertices pushed past the end of the cache are evicted; every vertex
+    // whose position changed rescores its remaining triangles.
+    best = NO_TRIANGLE;
+    bestScore = -1.0f;
+    for (GLuint i = 0; i < size; ++i) {
+      const GLuint v = next[i];
+      position[v] = i < SCORE_CACHE_SIZE ? GLint(i) : -1;
+      score[v] = tables.score(position[v], valence[v]);
+    }
+    for (GLuint i = 0; i < size; ++i) {
+      const GLuint v = next[i];
+      for (GLuint a = offsets[v], end = a + valence[v]; a < end; ++a) {
+        const GLuint t = adjacency[a];
+        const GLuint *other = &indices[t * 3];
+        const float s = score[other[0]] + score[other[1]] + score[other[2]];
+        if (s > bestScore) {
+          best = t;
+          bestScore = s;
+        }
+      }
+    }
+    cached = std::min(size, SCORE_CACHE_SIZE);
+    std::copy(next, next + cached, cache);
+  }
+  indices.swap(output);
+}
+
+/////////////////////////////////////////////////////////////////////// Overdraw
+
+void optimizeOverdraw(std::vector<GLuint> &indices,
+                      const std::vector<glm::vec3> &positions,
+                      float threshold) {
+  const GLuint triangleCount = static_cast<GLuint>(indices.size() / 3);
+  if (triangleCount == 0)
+    return;
+
+  // Hard boundaries: triangles that miss the cache on all three vertices
+  // start a new cluster anyway, so moving clusters there costs nothing.
+  FifoCache cache(positions.size(), MESH_CACHE_SIZE);
+  std::vector<GLuint> hard;
+  for (GLuint t = 0; t < triangleCount; ++t) {
+    if (cache.miss(&indices[t * 3]) == 3 || t == 0)
+      hard.push_back(t);
+  }
+  hard.push_back(triangleCount);
+
+  // Soft boundaries: split a cluster further wherever its running ACMR,
+  // restarted from an empty cache, has dropped to threshold times the ACMR of
+  // the whole cluster.
+  std::vector<GLuint> clusters;
+  for (size_t c = 0; c + 1 < hard.size(); ++c) {
+    const GLuint begin = hard[c], end = hard[c + 1];
+    cache.flush();
+    GLuint misses = 0;
+    for (GLuint t = begin; t < end; ++t)
+      misses += cache.miss(&indices[t * 3]);
+    const float limit = threshold * float(misses) / float(end - begin);
+
+    cache.flush();
+    clusters.push_back(begin);
+    GLuint start = begin;
+    misses = 0;
+    for (GLuint t = begin; t + 1 < end; ++t) {
+      misses += cache.miss(&indices[t * 3]);
+      if (float(misses) <= limit * float(t - start + 1)) {
+        start = t + 1;
+        clusters.push_back(start);
+        misses = 0;
+        cache.flush();
+      }
+    }
+  }
+  clusters.push_back(triangleCount);
+
+  glm::vec3 centre(0.0f);
+  for (const glm::vec3 &p : positions)
+    centre += p;
+  centre /= float(std::max<size_t>(positions.size(), 1));
+
+  // Sort key: how much a cluster faces outwards from the mesh centre.
+  const size_t clusterCount = clusters.size() - 1;
+  std::vector<float> keys(clusterCount);
+  for (size_t c = 0; c < clusterCount; ++c) {
+    glm::vec3 centroid(0.0f), normal(0.0f);
+    float area = 0.0f;
+    for (GLuint t = clusters[c]; t < clusters[c + 1]; ++t) {
+      const glm::vec3 &p0 = positions[indices[t * 3]];
+      const glm::vec3 &p1 = positions[indices[t * 3 + 1]];
+      const glm::vec3 &p2 = positions[indices[t * 3 + 2]];
+      const glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+      const float a = glm::length(n);
+      centroid += (p0 + p1 + p2) * (a / 3.0f);
+      normal += n;
+      area += a;
+    }
+    const float length = glm::length(normal);
+    keys[c] = (area > 0.0f && length > 0.0f)
+                  ? glm::dot(centroid / area - centre, normal / length)
+                  : 0.0f;
+  }
+
+  std::vector<GLuint> order(clusterCount);
+  for (GLuint c = 0; c < clusterCount; ++c)
+    order[c] = c;
+  std::stable_sort(order.begin(), order.end(),
+                   [&keys](GLuint a, GLuint b) { return keys[a] > keys[b]; });
+
+  std::vector<GLuint> output;
+  output.reserve(indices.size());
+  for (GLuint c : order) {
+    output.insert(output.end(), indices.begin() + clusters[c] * 3,
+                  indices.begin() + clusters[c + 1] * 3);
+  }
+  indices.swap(output);
+}
+
+/////////////////////////////////////////////////////////////////// Vertex Fetch
+
+GLuint remapVertexFetch(std::vector<GLuint> &indices, size_t vertexCount,
+                        std::vector<GLuint> &remap) {
+  remap.assign(vertexCount, ~0u);
+  GLuint next = 0;
+  for (GLuint &index : indices) {
+    if (remap[index] == ~0u)
+      remap[index] = next++;
+    index = remap[index];
+  }
+  return next;
+}
+
+///////////////////////////////////////////////////////////////////// MeshReport
+
+MeshReport optimizeMesh(std::vector<glm::vec3> &positions,
+                        std::vector<GLuint> &indices, float epsilon) {
+  MeshReport report;
+  report.VerticesBefore = positions.size();
+  report.Before = analyzeVertexCache(indices, positions.size());
+
+  weldVertices(positions, indices, epsilon);
+  optimizeVertexCache(indices, positions.size());
+  optimizeOverdraw(indices, positions);
+  optimizeVertexFetch(positions, indices);
+
+  report.VerticesAfter = positions.size();
+  report.After = analyzeVertexCache(indices, positions.size());
+  return report;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
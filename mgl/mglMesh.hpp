@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Mesh Optimisation
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_MESH_HPP
+#define MGL_MESH_HPP
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace mgl {
+
+struct MeshStats;
+struct MeshReport;
+
+////////////////////////////////////////////////////////////////////// MeshStats
+
+// Post-transform cache statistics of an indexed triangle list, simulated with
+// a FIFO cache of the given size.
+//   Acmr  cache misses per triangle (0.5 is the ideal for large grids, 3 the
+//         worst case).
+//   Atvr  cache misses per referenced vertex (1 is the ideal).
+
+struct MeshStats {
+  float Acmr;
+  float Atvr;
+};
+
+static const GLuint MESH_CACHE_SIZE = 16;
+
+MeshStats analyzeVertexCache(const std::vector<GLuint> &indices,
+                             size_t vertexCount,
+                             GLuint cacheSize = MESH_CACHE_SIZE);
+
+//////////////////////////////////////////////////////////////////// Processing
+
+// Merges vertices whose positions are equal or, if epsilon > 0, fall in the
+// same epsilon-sized grid cell, and rewrites indices to the survivors.
+// Triangles that collapse in the process are removed. Returns the new vertex
+// count.
+size_t weldVertices(std::vector<glm::vec2> &positions,
+                    std::vector<GLuint> &indices, float epsilon = 0.0f);
+size_t weldVertices(std::vector<glm::vec3> &positions,
+                    std::vector<GLuint> &indices, float epsilon = 0.0f);
+
+// Reorders triangles for post-transform cache hits (Forsyth's linear-speed
+// algorithm). Independent of the hardware cache size.
+void optimizeVertexCache(std::vector<GLuint> &indices, size_t vertexCount);
+
+// Splits a cache-optimised index list into clusters and sorts them so that
+// clusters facing away from the mesh centre are drawn first, reducing
+// overdraw with depth testing on. Clusters are only split where the cluster
+// ACMR stays within threshold times the original. Only meaningful for 3D
+// meshes; without depth testing overdraw does not depend on order.
+void optimizeOverdraw(std::vector<GLuint> &indices,
+                      const std::vector<glm::vec3> &positions,
+                      float threshold = 1.05f);
+
+// Renumbers vertices in order of first use so that vertex fetch walks memory
+// linearly. Rewrites indices, writes the old-to-new mapping to remap (~0u for
+// unreferenced vertices) and returns the number of vertices kept.
+GLuint remapVertexFetch(std::vector<GLuint> &indices, size_t vertexCount,
+                        std::vector<GLuint> &remap);
+
+template <typename Vertex>
+size_t optimizeVertexFetch(std::vector<Vertex> &vertices,
+                           std::vector<GLuint> &indices) {
+  std::vector<GLuint> remap;
+  std::vector<Vertex> reordered(
+      remapVertexFetch(indices, vertices.size(), remap));
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    if (remap[i] != ~0u)
+      reordered[remap[i]] = vertices[i];
+  }
+  vertices.swap(reordered);
+  return vertices.size();
+}
+
+///////////////////////////////////////////////////////////////////// MeshReport
+
+struct MeshReport {
+  size_t VerticesBefore, VerticesAfter;
+  MeshStats Before, After;
+};
+
+// Runs the full pipeline (weld, vertex cache, overdraw, vertex fetch) at load
+// time or offline and reports the cache statistics before and after.
+MeshReport optimizeMesh(std::vector<glm::vec3> &positions,
+                        std::vector<GLuint> &indices, float epsilon = 0.0f);
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_MESH_HPP */
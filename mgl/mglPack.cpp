@@ -0,0 +1,334 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Binary Asset Packs
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#define GLM_ENABLE_EXPERIMENTAL
+#endif
+
+#include "./mglPack.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include <glm/gtx/matrix_decompose.hpp>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mgl {
+
+const char PACK_MAGIC[4] = {'M', 'G', 'L', 'P'};
+
+static_assert(sizeof(PackHeader) == 24, "PackHeader layout");
+static_assert(sizeof(PackSectionEntry) == 24, "PackSectionEntry layout");
+static_assert(sizeof(PackMesh) == 48, "PackMesh layout");
+static_assert(sizeof(PackPiece) == 24, "PackPiece layout");
+static_assert(sizeof(PackPlacement) == 24, "PackPlacement layout");
+
+// Size of one record of each section; 1 for blobs.
+static const size_t PACK_RECORD_SIZE[] = {
+    1,
+    1,
+    sizeof(PackFormat),
+    sizeof(PackAttribute),
+    sizeof(PackMesh),
+    sizeof(PackPiece),
+    sizeof(PackLayout),
+    sizeof(PackPlacement),
+    1};
+
+static size_t align(size_t offset) {
+  return (offset + PACK_ALIGNMENT - 1) & ~(PACK_ALIGNMENT - 1);
+}
+
+////////////////////////////////////////////////////////////////// PackPlacement
+
+glm::mat4 PackPlacement::matrix() const {
+  return glm::composeTRS(
+      glm::vec3(Position, 0.0f),
+      glm::angleAxis(glm::radians(Angle), glm::vec3(0.0f, 0.0f, 1.0f)),
+      glm::vec3(Scale, 1.0f));
+}
+
+////////////////////////////////////////////////////////////////////// AssetPack
+
+AssetPack::AssetPack() : Data(0), Size(0), Sections() {
+#ifdef _WIN32
+  File = Mapping = 0;
+#endif
+}
+
+AssetPack::~AssetPack() { close(); }
+
+bool AssetPack::open(const std::string &filename) {
+  close();
+#ifdef _WIN32
+  File = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, 0,
+                     OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+  if (File == INVALID_HANDLE_VALUE)
+    File = 0;
+  LARGE_INTEGER size;
+  if (!File || !GetFileSizeEx(File, &size)) {
+    std::cerr << "[ERROR] Failed to open asset pack: " << filename
+              << std::endl;
+    close();
+    return false;
+  }
+  Size = static_cast<size_t>(size.QuadPart);
+  Mapping = CreateFileMappingA(File, 0, PAGE_READONLY, 0, 0, 0);
+  Data = Mapping ? static_cast<const char *>(
+                       MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0))
+                 : 0;
+#else
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  struct stat info;
+  if (fd < 0 || fstat(fd, &info) != 0) {
+    std::cerr << "[ERROR] Failed to open asset pack: " << filename
+              << std::endl;
+    if (fd >= 0)
+      ::close(fd);
+    return false;
+  }
+  Size = static_cast<size_t>(info.st_size);
+  void *data = Size ? mmap(0, Size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+  ::close(fd);
+  Data = data != MAP_FAILED ? static_cast<const char *>(data) : 0;
+#endif
+  if (!Data) {
+    std::cerr << "[ERROR] Failed to map asset pack: " << filename << std::endl;
+    close();
+    return false;
+  }
+
+  const PackHeader *header = reinterpret_cast<const PackHeader *>(Data);
+  if (Size < sizeof(PackHeader) ||
+      std::memcmp(header->Magic, PACK_MAGIC, 4) != 0 ||
+      header->Version != VERSION || header->Size != Size ||
+      header->SectionCount >
+          (Size - sizeof(PackHeader)) / sizeof(PackSectionEntry)) {
+    std::cerr << "[ERROR] Invalid asset pack: " << filename << std::endl;
+    close();
+    return false;
+  }
+  const PackSectionEntry *entries =
+      reinterpret_cast<const PackSectionEntry *>(header + 1);
+  for (GLuint i = 0; i < header->SectionCount; ++i) {
+    const PackSectionEntry &entry = entries[i];
+    const size_t type = static_cast<size_t>(entry.Type);
+    if (type >= static_cast<size_t>(PackSection::Count) ||
+        entry.Offset % PACK_ALIGNMENT != 0 || entry.Offset > Size ||
+        entry.Size > Size - entry.Offset ||
+        entry.Count * PACK_RECORD_SIZE[type] > entry.Size) {
+      std::cerr << "[ERROR] Invalid section " << i
+                << " in asset pack: " << filename << std::endl;
+      close();
+      return false;
+    }
+    Sections[type] = &entry;
+  }
+  if (!validate()) {
+    std::cerr << "[ERROR] Invalid records in asset pack: " << filename
+              << std::endl;
+    close();
+    return false;
+  }
+  return true;
+}
+
+// Ranges are summed in 64 bits so that no record can wrap them around.
+bool AssetPack::validate() const {
+  GLuint formats, attributes, meshes, pieces, layouts, placements;
+  const PackFormat *f = get<PackFormat>(PackSection::Formats, &formats);
+  get<PackAttribute>(PackSection::Attributes, &attributes);
+  const PackMesh *m = get<PackMesh>(PackSection::Meshes, &meshes);
+  const PackPiece *p = get<PackPiece>(PackSection::Pieces, &pieces);
+  const PackLayout *l = get<PackLayout>(PackSection::Layouts, &layouts);
+  const PackPlacement *pl =
+      get<PackPlacement>(PackSection::Placements, &placements);
+  const PackSectionEntry *vertices = section(PackSection::Vertices);
+  const PackSectionEntry *indices = section(PackSection::Indices);
+  const uint64_t vertexBytes = vertices ? vertices->Size : 0;
+  const uint64_t indexBytes = indices ? indices->Size : 0;
+
+  for (GLuint i = 0; i < formats; ++i) {
+    if (uint64_t(f[i].FirstAttribute) + f[i].AttributeCount > attributes)
+      return false;
+  }
+  for (GLuint i = 0; i < meshes; ++i) {
+    const PackMesh &mesh = m[i];
+    const GLuint indexSize = mesh.IndexType == GL_UNSIGNED_INT     ? 4
+                             : mesh.IndexType == GL_UNSIGNED_SHORT ? 2
+                             : mesh.IndexType == GL_UNSIGNED_BYTE  ? 1
+                                                                   : 0;
+    if (mesh.Format >= formats || indexSize == 0 ||
+        mesh.IndexOffset % indexSize != 0 ||
+        uint64_t(mesh.IndexOffset) + uint64_t(mesh.IndexCount) * indexSize >
+            indexBytes ||
+        (uint64_t(mesh.BaseVertex) + mesh.VertexCount) * f[mesh.Format].Stride >
+            vertexBytes)
+      return false;
+  }
+  for (GLuint i = 0; i < pieces; ++i) {
+    if (p[i].Mesh >= meshes)
+      return false;
+  }
+  for (GLuint i = 0; i < layouts; ++i) {
+    if (uint64_t(l[i].FirstPlacement) + l[i].PlacementCount > placements)
+      return false;
+  }
+  for (GLuint i = 0; i < placements; ++i) {
+    if (pl[i].Piece >= pieces)
+      return false;
+  }
+  return true;
+}
+
+void AssetPack::close() {
+#ifdef _WIN32
+  if (Data)
+    UnmapViewOfFile(Data);
+  if (Mapping)
+    CloseHandle(Mapping);
+  if (File)
+    CloseHandle(File);
+  File = Mapping = 0;
+#else
+  if (Data)
+    munmap(const_cast<char *>(Data), Size);
+#endif
+  Data = 0;
+  Size = 0;
+  for (const PackSectionEntry *&section : Sections)
+    section = 0;
+}
+
+bool AssetPack::isOpen() const { return Data != 0; }
+
+size_t AssetPack::size() const { return Size; }
+
+const PackSectionEntry *AssetPack::section(PackSection type) const {
+  return Data ? Sections[static_cast<size_t>(type)] : 0;
+}
+
+const void *AssetPack::data(PackSection type) const {
+  const PackSectionEntry *entry = section(type);
+  return entry ? Data + entry->Offset : 0;
+}
+
+const char *AssetPack::string(GLuint offset) const {
+  const PackSectionEntry *entry = section(PackSection::Strings);
+  return entry && offset < entry->Size ? Data + entry->Offset + offset : "";
+}
+
+BufferHandle AssetPack::upload(Resources &resources, PackSection type,
+                               GLenum target, GLbitfield flags) const {
+  const PackSectionEntry *entry = section(type);
+  if (!entry || entry->Size == 0)
+    return BufferHandle();
+  return resources.createBufferStorage(
+      target, static_cast<GLsizeiptr>(entry->Size), Data + entry->Offset,
+      flags);
+}
+
+void AssetPack::enableFormat(GLuint format) const {
+  GLuint formats, attributes;
+  const PackFormat *f = get<PackFormat>(PackSection::Formats, &formats);
+  const PackAttribute *a =
+      get<PackAttribute>(PackSection::Attributes, &attributes);
+  if (format >= formats ||
+      f[format].FirstAttribute + f[format].AttributeCount > attributes) {
+    std::cerr << "[WARNING] Asset pack has no vertex format " << format
+              << std::endl;
+    return;
+  }
+  for (GLuint i = 0; i < f[format].AttributeCount; ++i) {
+    const PackAttribute &attribute = a[f[format].FirstAttribute + i];
+    glEnableVertexAttribArray(attribute.Index);
+    glVertexAttribPointer(
+        attribute.Index, attribute.Components, attribute.Type,
+        static_cast<GLboolean>(attribute.Normalized), f[format].Stride,
+        reinterpret_cast<GLvoid *>(static_cast<uintptr_t>(attribute.Offset)));
+  }
+}
+
+///////////////////////////////////////////////////////////////////// PackWriter
+
+PackWriter::PackWriter() : Strings(1, '\0') {}
+
+void PackWriter::add(PackSection type, const void *data, size_t size,
+                     GLuint count) {
+  const char *bytes = static_cast<const char *>(data);
+  Entries.push_back({type, count, std::vector<char>(bytes, bytes + size)});
+}
+
+GLuint PackWriter::addString(const std::string &name) {
+  if (name.empty())
+    return 0;
+  const GLuint offset = static_cast<GLuint>(Strings.size());
+  Strings.insert(Strings.end(), name.begin(), name.end());
+  Strings.push_back('\0');
+  return offset;
+}
+
+bool PackWriter::write(const std::string &filename) const {
+  std::vector<const Entry *> entries;
+  for (const Entry &entry : Entries)
+    entries.push_back(&entry);
+  const Entry strings = {PackSection::Strings,
+                         static_cast<GLuint>(Strings.size()), Strings};
+  entries.push_back(&strings);
+
+  std::vector<PackSectionEntry> table;
+  size_t offset = align(sizeof(PackHeader) +
+                        entries.size() * sizeof(PackSectionEntry));
+  for (const Entry *entry : entries) {
+    table.push_back({entry->Type, entry->Count, offset, entry->Data.size()});
+    offset = align(offset + entry->Data.size());
+  }
+
+  PackHeader header = {{PACK_MAGIC[0], PACK_MAGIC[1], PACK_MAGIC[2],
+                        PACK_MAGIC[3]},
+                       AssetPack::VERSION,
+                       static_cast<GLuint>(table.size()),
+                       0,
+                       offset};
+  std::vector<char> buffer(offset, 0);
+  std::memcpy(buffer.data(), &header, sizeof(header));
+  std::memcpy(buffer.data() + sizeof(header), table.data(),
+              table.size() * sizeof(PackSectionEntry));
+  for (size_t i = 0; i < entries.size(); ++i) {
+    if (!entries[i]->Data.empty())
+      std::memcpy(buffer.data() + table[i].Offset, entries[i]->Data.data(),
+                  entries[i]->Data.size());
+  }
+
+  std::ofstream ofile(filename, std::ios::binary);
+  if (!ofile.is_open()) {
+    std::cerr << "[ERROR] Failed to open asset pack: " << filename
+              << std::endl;
+    return false;
+  }
+  ofile.write(buffer.data(), buffer.size());
+  return ofile.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
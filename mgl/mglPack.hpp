@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Binary Asset Packs
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_PACK_HPP
+#define MGL_PACK_HPP
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "./mglResource.hpp"
+
+namespace mgl {
+
+class AssetPack;
+class PackWriter;
+
+//////////////////////////////////////////////////////////////////// Pack Format
+
+// A pack is a PackHeader, a table of PackSection entries and the section
+// payloads, each aligned to PACK_ALIGNMENT bytes. Records refer to each other
+// by index and to blobs by byte offset, never by pointer, so a mapped pack is
+// used in place: no parsing, no fix-ups. Data is stored in native byte order.
+
+static const size_t PACK_ALIGNMENT = 64;
+
+enum class PackSection : GLuint {
+  Vertices,   // vertex blob, uploaded as is
+  Indices,    // index blob, uploaded as is
+  Formats,    // PackFormat
+  Attributes, // PackAttribute, referenced by PackFormat
+  Meshes,     // PackMesh
+  Pieces,     // PackPiece
+  Layouts,    // PackLayout
+  Placements, // PackPlacement, referenced by PackLayout
+  Strings,    // zero-terminated names, referenced by byte offset
+  Count
+};
+
+struct PackHeader {
+  char Magic[4];
+  GLuint Version;
+  GLuint SectionCount;
+  GLuint Reserved;
+  uint64_t Size;
+};
+
+struct PackSectionEntry {
+  PackSection Type;
+  GLuint Count; // records; bytes for blobs
+  uint64_t Offset;
+  uint64_t Size;
+};
+
+struct PackAttribute {
+  GLuint Index;
+  GLint Components;
+  GLenum Type;
+  GLuint Normalized;
+  GLuint Offset;
+};
+
+struct PackFormat {
+  GLuint Name;
+  GLuint FirstAttribute, AttributeCount;
+  GLuint Stride;
+};
+
+// Vertices start at BaseVertex in units of the format's stride; indices start
+// at IndexOffset bytes into the Indices section. Min and Max bound the x and y
+// of attribute 0 (the position).
+struct PackMesh {
+  GLuint Name;
+  GLuint Format;
+  GLenum Mode, IndexType;
+  GLuint BaseVertex, VertexCount;
+  GLuint IndexOffset, IndexCount;
+  glm::vec2 Min, Max;
+};
+
+struct PackPiece {
+  GLuint Name;
+  GLuint Mesh;
+  glm::vec4 Color;
+};
+
+// A layout is a board: a named list of placed pieces.
+struct PackLayout {
+  GLuint Name;
+  GLuint FirstPlacement, PlacementCount;
+};
+
+struct PackPlacement {
+  GLuint Piece;
+  float Angle; // degrees, counterclockwise
+  glm::vec2 Position;
+  glm::vec2 Scale;
+  glm::mat4 matrix() const;
+};
+
+////////////////////////////////////////////////////////////////////// AssetPack
+
+// Maps a pack read-only. open() checks the header, that every section lies
+// inside the file and that every index or offset a record holds is in range;
+// records are then read straight from the mapping.
+
+class AssetPack {
+public:
+  static const GLuint VERSION = 2;
+
+  AssetPack();
+  ~AssetPack();
+  AssetPack(const AssetPack &) = delete;
+  void operator=(const AssetPack &) = delete;
+
+  bool open(const std::string &filename);
+  void close();
+  bool isOpen() const;
+  size_t size() const;
+
+  const PackSectionEntry *section(PackSection type) const;
+  const void *data(PackSection type) const;
+  template <typename T> const T *get(PackSection type, GLuint *count = 0) const;
+  const char *string(GLuint offset) const;
+
+  // Creates an immutable buffer (glBufferStorage) from a blob section.
+  BufferHandle upload(Resources &resources, PackSection type, GLenum target,
+                      GLbitfield flags = 0) const;
+  // Sets the attribute pointers of a vertex format on the bound VAO.
+  void enableFormat(GLuint format) const;
+
+private:
+  const char *Data;
+  size_t Size;
+  bool validate() const;
+  const PackSectionEntry *Sections[static_cast<size_t>(PackSection::Count)];
+#ifdef _WIN32
+  void *File, *Mapping;
+#endif
+};
+
+template <typename T>
+const T *AssetPack::get(PackSection type, GLuint *count) const {
+  const PackSectionEntry *entry = section(type);
+  if (count)
+    *count = entry ? entry->Count : 0;
+  return entry ? reinterpret_cast<const T *>(Data + entry->Offset) : 0;
+}
+
+///////////////////////////////////////////////////////////////////// PackWriter
+
+class PackWriter {
+public:
+  PackWriter();
+  void add(PackSection type, const void *data, size_t size, GLuint count);
+  template <typename T>
+  void add(PackSection type, const std::vector<T> &records) {
+    add(type, records.data(), records.size() * sizeof(T),
+        static_cast<GLuint>(records.size()));
+  }
+  // Returns the offset of name in the Strings section, added on write().
+  GLuint addString(const std::string &name);
+  bool write(const std::string &filename) const;
+
+private:
+  struct Entry {
+    PackSection Type;
+    GLuint Count;
+    std::vector<char> Data;
+  };
+  std::vector<Entry> Entries;
+  std::vector<char> Strings;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_PACK_HPP */
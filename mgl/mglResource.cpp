@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// GPU Resource Pools and Handles
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "./mglResource.hpp"
+
+#include <iostream>
+
+namespace mgl {
+
+// Hands a new GL object to its pool; when the pool is full the object is
+// deleted again so its name does not leak, and the handle is invalid.
+template <typename Record>
+static Handle<Record> adopt(ResourcePool<Record> &pool, const Record &record,
+                            const char *kind) {
+  const Handle<Record> handle = pool.create(record);
+  if (!handle) {
+    Record::release(record.Id);
+    std::cerr << "[ERROR] " << kind << " pool full ("
+              << ResourcePool<Record>::CAPACITY << " slots)" << std::endl;
+  }
+  return handle;
+}
+
+////////////////////////////////////////////////////////////////////// Resources
+
+BufferHandle Resources::createBuffer(GLenum target, GLsizeiptr size,
+                                     const void *data, GLenum usage) {
+  GLuint id;
+  glGenBuffers(1, &id);
+  glBindBuffer(target, id);
+  if (size > 0)
+    glBufferData(target, size, data, usage);
+  return adopt(Buffers, BufferRecord{id, target, size}, "Buffer");
+}
+
+BufferHandle Resources::createBufferStorage(GLenum target, GLsizeiptr size,
+                                            const void *data,
+                                            GLbitfield flags) {
+  GLuint id;
+  glGenBuffers(1, &id);
+  glBindBuffer(target, id);
+  glBufferStorage(target, size, data, flags);
+  return adopt(Buffers, BufferRecord{id, target, size}, "Buffer");
+}
+
+BufferHandle Resources::adoptBuffer(GLuint id, GLenum target,
+                                    GLsizeiptr size) {
+  return adopt(Buffers, BufferRecord{id, target, size}, "Buffer");
+}
+
+VertexArrayHandle Resources::createVertexArray() {
+  GLuint id;
+  glGenVertexArrays(1, &id);
+  return adopt(VertexArrays, VertexArrayRecord{id}, "Vertex array");
+}
+
+ProgramHandle Resources::createProgram() {
+  return adopt(Programs, ProgramRecord{glCreateProgram()}, "Program");
+}
+
+TextureHandle Resources::createTexture(GLenum target) {
+  GLuint id;
+  glGenTextures(1, &id);
+  return adopt(Textures, TextureRecord{id, target}, "Texture");
+}
+
+GLuint Resources::id(BufferHandle handle) const { return Buffers.id(handle); }
+
+GLuint Resources::id(VertexArrayHandle handle) const {
+  return VertexArrays.id(handle);
+}
+
+GLuint Resources::id(ProgramHandle handle) const {
+  return Programs.id(handle);
+}
+
+GLuint Resources::id(TextureHandle handle) const {
+  return Textures.id(handle);
+}
+
+void Resources::destroy(BufferHandle handle) { Buffers.destroy(handle); }
+
+void Resources::destroy(VertexArrayHandle handle) {
+  VertexArrays.destroy(handle);
+}
+
+void Resources::destroy(ProgramHandle handle) { Programs.destroy(handle); }
+
+void Resources::destroy(TextureHandle handle) { Textures.destroy(handle); }
+
+void Resources::endFrame() {
+  Buffers.fence();
+  VertexArrays.fence();
+  Programs.fence();
+  Textures.fence();
+  Buffers.collect();
+  VertexArrays.collect();
+  Programs.collect();
+  Textures.collect();
+}
+
+void Resources::clear() {
+  glFinish();
+  Buffers.clear();
+  VertexArrays.clear();
+  Programs.clear();
+  Textures.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
@@ -0,0 +1,257 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// GPU Resource Pools and Handles
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_RESOURCE_HPP
+#define MGL_RESOURCE_HPP
+
+#include <GL/glew.h>
+
+#include <deque>
+#include <vector>
+
+namespace mgl {
+
+template <typename Record> class Handle;
+template <typename Record> class ResourcePool;
+class Resources;
+
+///////////////////////////////////////////////////////////////////////// Handle
+
+// 32-bit handle: 22-bit slot index and 10-bit generation. Generation 0 is
+// never issued, so a default-constructed handle is always invalid.
+
+template <typename Record> class Handle {
+public:
+  static const GLuint INDEX_BITS = 22;
+  static const GLuint INDEX_MASK = (1u << INDEX_BITS) - 1;
+  static const GLuint GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+
+  Handle() : Value(0) {}
+  Handle(GLuint index, GLuint generation)
+      : Value((generation << INDEX_BITS) | index) {}
+  GLuint index() const { return Value & INDEX_MASK; }
+  GLuint generation() const { return Value >> INDEX_BITS; }
+  explicit operator bool() const { return Value != 0; }
+  bool operator==(Handle other) const { return Value == other.Value; }
+  bool operator!=(Handle other) const { return Value != other.Value; }
+
+private:
+  GLuint Value;
+};
+
+//////////////////////////////////////////////////////////////////////// Records
+
+struct BufferRecord {
+  GLuint Id;
+  GLenum Target;
+  GLsizeiptr Size;
+  static void release(GLuint id) { glDeleteBuffers(1, &id); }
+};
+
+struct VertexArrayRecord {
+  GLuint Id;
+  static void release(GLuint id) { glDeleteVertexArrays(1, &id); }
+};
+
+struct ProgramRecord {
+  GLuint Id;
+  static void release(GLuint id) { glDeleteProgram(id); }
+};
+
+struct TextureRecord {
+  GLuint Id;
+  GLenum Target;
+  static void release(GLuint id) { glDeleteTextures(1, &id); }
+};
+
+typedef Handle<BufferRecord> BufferHandle;
+typedef Handle<VertexArrayRecord> VertexArrayHandle;
+typedef Handle<ProgramRecord> ProgramHandle;
+typedef Handle<TextureRecord> TextureHandle;
+
+/////////////////////////////////////////////////////////////////// ResourcePool
+
+// Records live in a dense array indexed by handle slot; free slots are kept
+// in a free list. destroy() invalidates the handle at once but the GL object
+// is only deleted, and its slot reused, once a fence placed after the frame
+// that destroyed it has signalled (see fence() and collect()).
+//
+// A pool holds CAPACITY (4M) records, counting destroyed ones still waiting
+// for their fence: one frame may create and destroy up to that many, minus
+// the live ones. create() returns an invalid handle once the pool is full.
+
+template <typename Record> class ResourcePool {
+public:
+  typedef Handle<Record> HandleType;
+  static const GLuint CAPACITY = HandleType::INDEX_MASK + 1;
+
+  HandleType create(const Record &record) {
+    GLuint index;
+    if (!Free.empty()) {
+      index = Free.back();
+      Free.pop_back();
+      Records[index] = record;
+    } else {
+      index = static_cast<GLuint>(Records.size());
+      if (index == CAPACITY)
+        return HandleType();
+      Records.push_back(record);
+      Generations.push_back(1);
+    }
+    ++Live;
+    return HandleType(index, Generations[index]);
+  }
+
+  bool isValid(HandleType handle) const {
+    return handle && handle.index() < Records.size() &&
+           Generations[handle.index()] == handle.generation();
+  }
+
+  Record *get(HandleType handle) {
+    return isValid(handle) ? &Records[handle.index()] : 0;
+  }
+
+  GLuint id(HandleType handle) const {
+    return isValid(handle) ? Records[handle.index()].Id : 0;
+  }
+
+  void destroy(HandleType handle) {
+    if (!isValid(handle) || !Records[handle.index()].Id)
+      return;
+    const GLuint index = handle.index();
+    GLuint generation = (Generations[index] + 1) & HandleType::GENERATION_MASK;
+    Generations[index] = generation ? generation : 1;
+    Retired.push_back({index, Records[index].Id});
+    Records[index].Id = 0; // retired records are skipped by forEach()
+    --Live;
+  }
+
+  void fence() {
+    if (Retired.empty())
+      return;
+    InFlight.push_back({glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), {}});
+    InFlight.back().Retirees.swap(Retired);
+  }
+
+  void collect() {
+    while (!InFlight.empty()) {
+      const GLenum status = glClientWaitSync(InFlight.front().Fence, 0, 0);
+      if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+        break;
+      glDeleteSync(InFlight.front().Fence);
+      release(InFlight.front().Retirees);
+      InFlight.pop_front();
+    }
+  }
+
+  // Deletes every object immediately; the caller guarantees the GPU is idle.
+  void clear() {
+    release(Retired);
+    for (Pending &pending : InFlight) {
+      glDeleteSync(pending.Fence);
+      release(pending.Retirees);
+    }
+    InFlight.clear();
+    for (GLuint index = 0; index < Records.size(); ++index) {
+      if (Records[index].Id)
+        destroy(HandleType(index, Generations[index]));
+    }
+    release(Retired);
+  }
+
+  template <typename F> void forEach(F &&f) {
+    for (Record &record : Records) {
+      if (record.Id)
+        f(record);
+    }
+  }
+
+  size_t size() const { return Live; }
+
+  // Slots in use, live or waiting for their fence.
+  size_t slots() const { return Records.size() - Free.size(); }
+
+  size_t memory() const {
+    size_t bytes = Records.capacity() * sizeof(Record) +
+                   Generations.capacity() * sizeof(GLushort) +
+                   Free.capacity() * sizeof(GLuint) +
+                   Retired.capacity() * sizeof(Retiree);
+    for (const Pending &pending : InFlight)
+      bytes += pending.Retirees.capacity() * sizeof(Retiree);
+    return bytes;
+  }
+
+private:
+  struct Retiree {
+    GLuint Index, Id;
+  };
+  struct Pending {
+    GLsync Fence;
+    std::vector<Retiree> Retirees;
+  };
+  std::vector<Record> Records;
+  std::vector<GLushort> Generations;
+  std::vector<GLuint> Free;
+  std::vector<Retiree> Retired;
+  std::deque<Pending> InFlight;
+  size_t Live = 0;
+
+  void release(std::vector<Retiree> &retirees) {
+    for (const Retiree &retiree : retirees) {
+      Record::release(retiree.Id);
+      Free.push_back(retiree.Index);
+    }
+    retirees.clear();
+  }
+};
+
+typedef ResourcePool<BufferRecord> BufferPool;
+typedef ResourcePool<VertexArrayRecord> VertexArrayPool;
+typedef ResourcePool<ProgramRecord> ProgramPool;
+typedef ResourcePool<TextureRecord> TexturePool;
+
+////////////////////////////////////////////////////////////////////// Resources
+
+class Resources {
+public:
+  BufferPool Buffers;
+  VertexArrayPool VertexArrays;
+  ProgramPool Programs;
+  TexturePool Textures;
+
+  // Creates, binds and (if size > 0) fills a buffer.
+  BufferHandle createBuffer(GLenum target, GLsizeiptr size, const void *data,
+                            GLenum usage);
+  // Creates, binds and fills an immutable buffer (glBufferStorage).
+  BufferHandle createBufferStorage(GLenum target, GLsizeiptr size,
+                                   const void *data, GLbitfield flags);
+  // Takes over a buffer created elsewhere, e.g. on a loader's context.
+  BufferHandle adoptBuffer(GLuint id, GLenum target, GLsizeiptr size);
+  VertexArrayHandle createVertexArray();
+  ProgramHandle createProgram();
+  TextureHandle createTexture(GLenum target);
+
+  GLuint id(BufferHandle handle) const;
+  GLuint id(VertexArrayHandle handle) const;
+  GLuint id(ProgramHandle handle) const;
+  GLuint id(TextureHandle handle) const;
+
+  void destroy(BufferHandle handle);
+  void destroy(VertexArrayHandle handle);
+  void destroy(ProgramHandle handle);
+  void destroy(TextureHandle handle);
+
+  // Call once per frame after the frame's draws have been submitted.
+  void endFrame();
+  void clear();
+};
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_RESOURCE_HPP */
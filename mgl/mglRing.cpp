@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Uniform Buffer Ring
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "./mglRing.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace mgl {
+
+const GLuint64 RING_WAIT_TIMEOUT = 1000000000; // ns
+
+static GLsizeiptr offsetAlignment(GLenum target) {
+  GLint alignment = 0;
+  glGetIntegerv(target == GL_SHADER_STORAGE_BUFFER
+                    ? GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT
+                    : GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT,
+                &alignment);
+  return alignment > 0 ? alignment : 256;
+}
+
+//////////////////////////////////////////////////////////////////// UniformRing
+
+UniformRing::UniformRing(Resources &resources, GLenum target,
+                         GLsizeiptr frameSize)
+    : Target(target), Alignment(offsetAlignment(target)), Head(0), Frame(0),
+      Fences() {
+  FrameSize = (frameSize + Alignment - 1) / Alignment * Alignment;
+  const GLbitfield flags =
+      GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+  Buffer = resources.createBufferStorage(Target, FrameSize * FRAMES, 0, flags);
+  Mapped = static_cast<char *>(
+      glMapBufferRange(Target, 0, FrameSize * FRAMES, flags));
+  glBindBuffer(Target, 0);
+  if (!Mapped) {
+    std::cerr << "[ERROR] Failed to map uniform ring" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+UniformRing::~UniformRing() {
+  for (GLsync &fence : Fences)
+    glDeleteSync(fence);
+}
+
+// The pool deletes the buffer once the GPU is done with it, which also
+// unmaps it.
+void UniformRing::destroy(Resources &resources) {
+  for (GLsync &fence : Fences) {
+    glDeleteSync(fence);
+    fence = 0;
+  }
+  resources.destroy(Buffer);
+  Buffer = BufferHandle();
+  Mapped = 0;
+}
+
+GLsizeiptr UniformRing::align(GLenum target, GLsizeiptr size) {
+  const GLsizeiptr alignment = offsetAlignment(target);
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+void UniformRing::beginFrame() {
+  Head = 0;
+  GLsync &fence = Fences[Frame];
+  if (!fence)
+    return;
+  GLbitfield flags = 0;
+  for (;;) {
+    const GLenum status = glClientWaitSync(fence, flags, RING_WAIT_TIMEOUT);
+    if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
+      break;
+    if (status == GL_WAIT_FAILED) {
+      std::cerr << "[WARNING] Failed to wait for uniform ring" << std::endl;
+      break;
+    }
+    flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+  }
+  glDeleteSync(fence);
+  fence = 0;
+}
+
+GLintptr UniformRing::push(const void *data, GLsizeiptr size) {
+  if (Head + size > FrameSize) {
+    std::cerr << "[ERROR] Uniform ring frame overflow (" << FrameSize
+              << " bytes)" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  const GLintptr offset = Frame * FrameSize + Head;
+  std::memcpy(Mapped + offset, data, static_cast<size_t>(size));
+  Head += (size + Alignment - 1) / Alignment * Alignment;
+  return offset;
+}
+
+void UniformRing::bind(const Resources &resources, GLuint bindingPoint,
+                       GLintptr offset, GLsizeiptr size) const {
+  glBindBufferRange(Target, bindingPoint, resources.id(Buffer), offset, size);
+}
+
+void UniformRing::endFrame() {
+  Fences[Frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  Frame = (Frame + 1) % FRAMES;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
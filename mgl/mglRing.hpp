@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Uniform Buffer Ring
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_RING_HPP
+#define MGL_RING_HPP
+
+#include <GL/glew.h>
+
+#include "./mglResource.hpp"
+
+namespace mgl {
+
+class UniformRing;
+
+//////////////////////////////////////////////////////////////////// UniformRing
+
+// A persistently mapped uniform (or shader storage) buffer split into FRAMES
+// regions, one per frame in flight. Per-draw blocks are written one after
+// the other into the current frame's region, each at an offset aligned for
+// glBindBufferRange, so a frame's data reaches the GPU as one contiguous
+// write and each draw only rebinds a range. A fence per region keeps the CPU
+// from overwriting blocks a previous frame may still be reading.
+// The buffer comes from a Resources pool and goes back to it with destroy(),
+// which must be called before the pool is cleared.
+
+class UniformRing {
+public:
+  static const GLuint FRAMES = 3;
+
+  // frameSize is the room for one frame; see align().
+  UniformRing(Resources &resources, GLenum target, GLsizeiptr frameSize);
+  ~UniformRing();
+  void destroy(Resources &resources);
+  UniformRing(const UniformRing &) = delete;
+  void operator=(const UniformRing &) = delete;
+
+  // Size a block takes in the ring: size rounded up to the offset alignment
+  // of target (GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT for uniform buffers).
+  static GLsizeiptr align(GLenum target, GLsizeiptr size);
+
+  // Waits, if needed, for the GPU to release the next region.
+  void beginFrame();
+  // Copies a block into the current region and returns its offset.
+  GLintptr push(const void *data, GLsizeiptr size);
+  template <typename T> GLintptr push(const T &block) {
+    return push(&block, sizeof(T));
+  }
+  void bind(const Resources &resources, GLuint bindingPoint, GLintptr offset,
+            GLsizeiptr size) const;
+  // Fences the current region; call after the frame's draws.
+  void endFrame();
+
+private:
+  GLenum Target;
+  BufferHandle Buffer;
+  GLsizeiptr FrameSize, Alignment, Head;
+  char *Mapped;
+  GLuint Frame;
+  GLsync Fences[FRAMES];
+};
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_RING_HPP */
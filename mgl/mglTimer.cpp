@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Frame Timer (CPU and GPU)
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "./mglTimer.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+namespace mgl {
+
+///////////////////////////////////////////////////////////////////// FrameTimer
+
+FrameTimer::FrameTimer(const std::string &filename)
+    : File(filename), Frame(0) {
+  if (!File.is_open()) {
+    std::cerr << "[ERROR] Failed to open frame log: " << filename << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  File << "frame,cpu_ms,gpu_ms" << std::endl;
+  glGenQueries(LATENCY, Queries);
+}
+
+FrameTimer::~FrameTimer() {
+  // begin() has collected every frame up to Frame - LATENCY - 1.
+  const GLuint first = Frame > LATENCY ? Frame - LATENCY : 0;
+  for (GLuint f = first; f < Frame; ++f) {
+    collect(f);
+  }
+  glDeleteQueries(LATENCY, Queries);
+  summary("CPU", CpuTotal);
+  summary("GPU", GpuTotal);
+}
+
+void FrameTimer::begin() {
+  if (Frame >= LATENCY) {
+    collect(Frame - LATENCY);
+  }
+  glBeginQuery(GL_TIME_ELAPSED, Queries[Frame % LATENCY]);
+  CpuStart = Clock::now();
+}
+
+void FrameTimer::end() {
+  const std::chrono::duration<double, std::milli> cpu = Clock::now() - CpuStart;
+  glEndQuery(GL_TIME_ELAPSED);
+  CpuMs[Frame % LATENCY] = cpu.count();
+  ++Frame;
+}
+
+void FrameTimer::collect(GLuint frame) {
+  GLuint64 ns = 0;
+  glGetQueryObjectui64v(Queries[frame % LATENCY], GL_QUERY_RESULT, &ns);
+  const double cpu = CpuMs[frame % LATENCY];
+  const double gpu = static_cast<double>(ns) * 1.0e-6;
+  CpuTotal.push_back(cpu);
+  GpuTotal.push_back(gpu);
+  File << frame << "," << cpu << "," << gpu << "\n";
+}
+
+void FrameTimer::summary(const char *name, std::vector<double> &ms) {
+  if (ms.empty())
+    return;
+  const double mean = std::accumulate(ms.begin(), ms.end(), 0.0) / ms.size();
+  std::sort(ms.begin(), ms.end());
+  std::cout << name << " frame time (ms): mean " << mean << ", median "
+            << ms[ms.size() / 2] << ", p95 " << ms[ms.size() * 95 / 100]
+            << ", max " << ms.back() << " over " << ms.size() << " frames"
+            << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
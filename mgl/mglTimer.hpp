@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Frame Timer (CPU and GPU)
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_TIMER_HPP
+#define MGL_TIMER_HPP
+
+#include <GL/glew.h>
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace mgl {
+
+class FrameTimer;
+
+///////////////////////////////////////////////////////////////////// FrameTimer
+
+// Measures the CPU time between begin() and end() and, with GL_TIME_ELAPSED
+// queries, the GPU time of the commands issued in between. Query results are
+// read LATENCY frames later so the CPU never waits for the GPU.
+// Writes "frame,cpu_ms,gpu_ms" lines to a CSV file and prints a summary.
+
+class FrameTimer {
+public:
+  static const GLuint LATENCY = 4;
+
+  explicit FrameTimer(const std::string &filename);
+  ~FrameTimer();
+  void begin();
+  void end();
+
+private:
+  typedef std::chrono::steady_clock Clock;
+
+  std::ofstream File;
+  GLuint Queries[LATENCY];
+  double CpuMs[LATENCY];
+  GLuint Frame;
+  Clock::time_point CpuStart;
+  std::vector<double> CpuTotal, GpuTotal;
+
+  void collect(GLuint frame);
+  void summary(const char *name, std::vector<double> &ms);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_TIMER_HPP */
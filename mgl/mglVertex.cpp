@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Vertex Formats and Layouts
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "./mglVertex.hpp"
+
+#include <glm/gtc/packing.hpp>
+
+namespace mgl {
+
+////////////////////////////////////////////////////////////////// Packed Types
+
+Half2 packHalf2(const glm::vec2 &v) {
+  return {glm::packHalf1x16(v.x), glm::packHalf1x16(v.y)};
+}
+
+Snorm2 packSnorm2(const glm::vec2 &v) {
+  return {static_cast<GLshort>(glm::packSnorm1x16(v.x)),
+          static_cast<GLshort>(glm::packSnorm1x16(v.y))};
+}
+
+Snorm10 packSnorm10(const glm::vec3 &v) {
+  return {glm::packSnorm3x10_1x2(glm::vec4(v, 0.0f))};
+}
+
+Unorm4 packUnorm4(const glm::vec4 &v) {
+  const glm::u8vec4 c = glm::packUnorm<glm::uint8>(v);
+  return {c.r, c.g, c.b, c.a};
+}
+
+glm::vec2 unpack(const Half2 &v) {
+  return glm::vec2(glm::unpackHalf1x16(v.X), glm::unpackHalf1x16(v.Y));
+}
+
+glm::vec2 unpack(const Snorm2 &v) {
+  return glm::vec2(glm::unpackSnorm1x16(static_cast<glm::uint16>(v.X)),
+                   glm::unpackSnorm1x16(static_cast<glm::uint16>(v.Y)));
+}
+
+glm::vec3 unpack(const Snorm10 &v) {
+  return glm::vec3(glm::unpackSnorm3x10_1x2(v.XYZW));
+}
+
+glm::vec4 unpack(const Unorm4 &v) {
+  return glm::unpackUnorm<float>(glm::u8vec4(v.R, v.G, v.B, v.A));
+}
+
+/////////////////////////////////////////////////////////////////// VertexLayout
+
+void VertexLayout::enable(GLintptr base) const {
+  for (size_t i = 0; i < Count; ++i) {
+    const VertexAttribute &a = Attributes[i];
+    glEnableVertexAttribArray(a.Index);
+    glVertexAttribPointer(a.Index, a.Components, a.Type, a.Normalized, Stride,
+                          reinterpret_cast<GLvoid *>(base + a.Offset));
+  }
+}
+
+void VertexLayout::disable() const {
+  for (size_t i = 0; i < Count; ++i) {
+    glDisableVertexAttribArray(Attributes[i].Index);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Vertex Formats and Layouts
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_VERTEX_HPP
+#define MGL_VERTEX_HPP
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+
+namespace mgl {
+
+struct VertexAttribute;
+struct VertexLayout;
+
+////////////////////////////////////////////////////////////////// Packed Types
+
+struct Half2 {           // GL_HALF_FLOAT x2
+  GLhalf X, Y;
+};
+struct Snorm2 {          // GL_SHORT x2, normalized to [-1, 1]
+  GLshort X, Y;
+};
+struct Snorm10 {         // GL_INT_2_10_10_10_REV, normalized (normals)
+  GLuint XYZW;
+};
+struct Unorm4 {          // GL_UNSIGNED_BYTE x4, normalized (colors)
+  GLubyte R, G, B, A;
+};
+
+Half2 packHalf2(const glm::vec2 &v);
+Snorm2 packSnorm2(const glm::vec2 &v);
+Snorm10 packSnorm10(const glm::vec3 &v);
+Unorm4 packUnorm4(const glm::vec4 &v);
+
+glm::vec2 unpack(const Half2 &v);
+glm::vec2 unpack(const Snorm2 &v);
+glm::vec3 unpack(const Snorm10 &v);
+glm::vec4 unpack(const Unorm4 &v);
+
+/////////////////////////////////////////////////////////////////// VertexFormat
+
+// Maps a member type to its GL attribute format.
+template <typename T> struct VertexFormat;
+
+#define MGL_VERTEX_FORMAT(TYPE, COMPONENTS, GLTYPE, NORMALIZED)                \
+  template <> struct VertexFormat<TYPE> {                                      \
+    static constexpr GLint Components = COMPONENTS;                            \
+    static constexpr GLenum Type = GLTYPE;                                     \
+    static constexpr GLboolean Normalized = NORMALIZED;                        \
+  }
+
+MGL_VERTEX_FORMAT(GLfloat, 1, GL_FLOAT, GL_FALSE);
+MGL_VERTEX_FORMAT(glm::vec2, 2, GL_FLOAT, GL_FALSE);
+MGL_VERTEX_FORMAT(glm::vec3, 3, GL_FLOAT, GL_FALSE);
+MGL_VERTEX_FORMAT(glm::vec4, 4, GL_FLOAT, GL_FALSE);
+MGL_VERTEX_FORMAT(Half2, 2, GL_HALF_FLOAT, GL_FALSE);
+MGL_VERTEX_FORMAT(Snorm2, 2, GL_SHORT, GL_TRUE);
+MGL_VERTEX_FORMAT(Snorm10, 4, GL_INT_2_10_10_10_REV, GL_TRUE);
+MGL_VERTEX_FORMAT(Unorm4, 4, GL_UNSIGNED_BYTE, GL_TRUE);
+
+#undef MGL_VERTEX_FORMAT
+
+//////////////////////////////////////////////////////////////// VertexAttribute
+
+struct VertexAttribute {
+  GLuint Index;
+  GLint Components;
+  GLenum Type;
+  GLboolean Normalized;
+  size_t Offset;
+  size_t Size;
+};
+
+// Declares attribute INDEX from member MEMBER of vertex struct VERTEX.
+#define MGL_VERTEX_ATTRIBUTE(INDEX, VERTEX, MEMBER)                            \
+  mgl::VertexAttribute {                                                       \
+    INDEX, mgl::VertexFormat<decltype(VERTEX::MEMBER)>::Components,            \
+        mgl::VertexFormat<decltype(VERTEX::MEMBER)>::Type,                     \
+        mgl::VertexFormat<decltype(VERTEX::MEMBER)>::Normalized,               \
+        offsetof(VERTEX, MEMBER), sizeof(VERTEX::MEMBER)                       \
+  }
+
+// Compile-time check: every attribute lies inside the vertex and is 4-byte
+// aligned, and the vertex size keeps consecutive vertices aligned.
+template <typename Vertex, size_t N>
+constexpr bool isValidLayout(const VertexAttribute (&attributes)[N]) {
+  if (sizeof(Vertex) % 4 != 0)
+    return false;
+  for (size_t i = 0; i < N; ++i) {
+    if (attributes[i].Offset % 4 != 0 ||
+        attributes[i].Offset + attributes[i].Size > sizeof(Vertex))
+      return false;
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////// VertexLayout
+
+// Attribute pointers are set relative to the bound GL_ARRAY_BUFFER.
+// Attributes with fewer than 4 components are expanded by GL to vec4 with
+// z = 0 and w = 1, so 2D positions feed "in vec4" shader inputs directly.
+struct VertexLayout {
+  const VertexAttribute *Attributes;
+  size_t Count;
+  GLsizei Stride;
+
+  void enable(GLintptr base = 0) const;
+  void disable() const;
+};
+
+template <typename Vertex, size_t N>
+constexpr VertexLayout makeLayout(const VertexAttribute (&attributes)[N]) {
+  return {attributes, N, sizeof(Vertex)};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace mgl
+
+#endif /* MGL_VERTEX_HPP */
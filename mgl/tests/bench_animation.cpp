@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Animation benchmark: 100k animated pieces sampled per frame, forward and
+// backward, checked against a direct evaluation of each track.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cstdio>
+#include <vector>
+
+#include "../mglAnimation.hpp"
+#include "./mglTest.hpp"
+
+const GLuint PIECES = 100000;
+const GLuint FRAMES = 120;
+const float FRAME_TIME = 1.0f / 60.0f;
+
+static std::vector<mgl::Keyframe> track(GLuint piece) {
+  const float start = 0.25f * (piece % 5);
+  const float angle = 0.01f * (piece % 628);
+  const glm::vec3 at(float(piece % 317), float(piece / 317), 0.0f);
+  return {
+      {start, at, glm::angleAxis(0.0f, glm::vec3(0, 0, 1)), glm::vec3(0.0f),
+       mgl::Easing::CubicOut},
+      {start + 0.5f, at + glm::vec3(0.5f), glm::angleAxis(angle, glm::vec3(0, 0, 1)),
+       glm::vec3(1.0f), mgl::Easing::SineInOut},
+      {start + 1.5f, at, glm::angleAxis(2.0f * angle, glm::vec3(0, 0, 1)),
+       glm::vec3(1.0f), mgl::Easing::Linear}};
+}
+
+// One track evaluated from its keyframes alone.
+static glm::mat4 reference(const std::vector<mgl::Keyframe> &keys, float time) {
+  size_t k = 0;
+  while (k + 1 < keys.size() && time >= keys[k + 1].Time)
+    ++k;
+  glm::vec3 position = keys[k].Position, scale = keys[k].Scale;
+  glm::quat rotation = keys[k].Rotation;
+  if (k + 1 < keys.size() && time > keys[k].Time) {
+    const float u = mgl::ease(keys[k].Ease, (time - keys[k].Time) /
+                                                (keys[k + 1].Time - keys[k].Time));
+    position = glm::mix(position, keys[k + 1].Position, u);
+    scale = glm::mix(scale, keys[k + 1].Scale, u);
+    rotation = glm::slerp(rotation, keys[k + 1].Rotation, u);
+  }
+  return glm::translate(glm::mat4(1.0f), position) * glm::mat4_cast(rotation) *
+         glm::scale(glm::mat4(1.0f), scale);
+}
+
+static bool same(const glm::mat4 &a, const glm::mat4 &b) {
+  for (int c = 0; c < 4; ++c)
+    for (int r = 0; r < 4; ++r)
+      if (glm::abs(a[c][r] - b[c][r]) > 1e-4f)
+        return false;
+  return true;
+}
+
+static void verify(const std::vector<glm::mat4> &matrices, float time) {
+  for (GLuint piece = 0; piece < PIECES; piece += 997)
+    CHECK(same(matrices[piece], reference(track(piece), time)));
+}
+
+int main() {
+  mgl::Animator animator;
+  for (GLuint piece = 0; piece < PIECES; ++piece)
+    animator.addTrack(track(piece));
+  std::vector<glm::mat4> matrices(PIECES);
+
+  mgl::test::Stopwatch watch;
+  for (GLuint frame = 0; frame < FRAMES; ++frame)
+    animator.sample(frame * FRAME_TIME, matrices.data());
+  const double forward = watch.ms();
+  verify(matrices, (FRAMES - 1) * FRAME_TIME);
+
+  watch.restart();
+  for (GLuint frame = FRAMES; frame-- > 0;)
+    animator.sample(frame * FRAME_TIME, matrices.data());
+  const double backward = watch.ms();
+  verify(matrices, 0.0f);
+
+  // Jumps far enough to need the binary search.
+  watch.restart();
+  for (GLuint frame = 0; frame < FRAMES; ++frame)
+    animator.sample((frame * 37 % FRAMES) * FRAME_TIME, matrices.data());
+  const double random = watch.ms();
+  verify(matrices, ((FRAMES - 1) * 37 % FRAMES) * FRAME_TIME);
+
+  std::printf("Animation, %u pieces x %u frames:\n", PIECES, FRAMES);
+  std::printf("- forward:  %.3f ms/frame\n", forward / FRAMES);
+  std::printf("- backward: %.3f ms/frame\n", backward / FRAMES);
+  std::printf("- random:   %.3f ms/frame\n", random / FRAMES);
+  return mgl::test::result();
+}
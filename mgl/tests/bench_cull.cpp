@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Culling benchmark: 1M pieces on a board, a view zooming in from the whole
+// board by halves, culled on the calling thread and with the job system.
+// Reports the cull time and the draw count, which is the visible count.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../mglArena.hpp"
+#include "../mglCulling.hpp"
+#include "../mglJob.hpp"
+#include "./mglTest.hpp"
+
+const GLuint PIECES = 1000000;
+const float BOARD = 1000.0f; // side, pieces of 0.5 to 1.5 units
+const int ZOOMS = 10;
+
+int main() {
+  std::mt19937 random(37);
+  std::uniform_real_distribution<float> position(0.0f, BOARD);
+  std::uniform_real_distribution<float> size(0.5f, 1.5f);
+  std::vector<mgl::Bounds> bounds(PIECES);
+  for (mgl::Bounds &b : bounds) {
+    b.Min = glm::vec2(position(random), position(random));
+    b.Max = b.Min + glm::vec2(size(random));
+  }
+
+  mgl::CullGrid grid;
+  const double buildMs = mgl::test::best(1, [&]() { grid.build(bounds); });
+  mgl::JobSystem jobs;
+  std::vector<GLuint> serial(grid.size()), parallel(grid.size());
+
+  std::printf("Cull %u pieces (build %.1f ms), %u workers, best of 5:\n",
+              PIECES, buildMs, jobs.workers());
+  std::printf("  zoom   serial ms   jobs ms      draws\n");
+  for (int zoom = 0; zoom < ZOOMS; ++zoom) {
+    const glm::vec2 half(0.5f * BOARD / float(1 << zoom));
+    const mgl::Bounds view = {glm::vec2(0.5f * BOARD) - half,
+                              glm::vec2(0.5f * BOARD) + half};
+    size_t serialCount = 0, parallelCount = 0;
+    const double serialMs = mgl::test::best(5, [&]() {
+      mgl::FrameArena::beginFrame();
+      serialCount = grid.cull(view, serial.data());
+    });
+    const double parallelMs = mgl::test::best(5, [&]() {
+      mgl::FrameArena::beginFrame();
+      parallelCount = grid.cull(view, parallel.data(), &jobs);
+    });
+    std::printf("  %4u %11.3f %9.3f %10zu\n", 1u << zoom, serialMs, parallelMs,
+                serialCount);
+    CHECK(serialCount == parallelCount);
+    CHECK(std::equal(serial.begin(), serial.begin() + serialCount,
+                     parallel.begin()));
+  }
+  return mgl::test::result();
+}
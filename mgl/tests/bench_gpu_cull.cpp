@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// CPU against GPU culling benchmark: boards of 10k to 10M pieces seen
+// through a view of a tenth of their side, drawn as hello-2d-world draws
+// them, one ranged uniform block per 128 visible pieces and one draw per
+// piece after CullGrid, or one compute dispatch and one multi-draw with GpuCuller.
+// Reports the frame time up to glFinish and checks both frames are equal.
+// Runs on any GL 4.5 implementation, llvmpipe included.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include "../mglArena.hpp"
+#include "../mglCamera.hpp"
+#include "../mglCulling.hpp"
+#include "../mglGpuCulling.hpp"
+#include "../mglJob.hpp"
+#include "../mglResource.hpp"
+#include "../mglRing.hpp"
+#include "../mglShader.hpp"
+#include "./mglTest.hpp"
+
+const GLuint POSITION = 0, OBJECT = 2;
+const GLuint UBO_BP = 0, OBJECT_BP = 1;
+const int SIZE = 256;
+const int FRAMES = 3;
+const float SCALE = 0.4f; // of a unit cell per piece
+
+// Same block as the Object block of clip-vs.glsl, and the same region cap
+// as hello-2d-world.
+const GLuint OBJECTS = 128;
+const GLuint REGION_BLOCKS = 64;
+struct ObjectBlock {
+  glm::mat4 ModelMatrix[OBJECTS];
+  glm::vec4 Color[OBJECTS];
+};
+
+// Two meshes, a triangle and a quad, in one vertex and one index buffer.
+const GLfloat VERTICES[] = {-0.5f, -0.5f, 0.0f, 1.0f, 0.5f, -0.5f, 0.0f, 1.0f,
+                            -0.5f, 0.5f,  0.0f, 1.0f, -0.5f, -0.5f, 0.0f, 1.0f,
+                            0.5f,  -0.5f, 0.0f, 1.0f, 0.5f,  0.5f,  0.0f, 1.0f,
+                            -0.5f, 0.5f,  0.0f, 1.0f};
+const GLushort INDICES[] = {0, 1, 2, 0, 1, 2, 0, 2, 3};
+const mgl::DrawElementsCommand MESHES[] = {{3, 0, 0, 0, 0}, {6, 0, 3, 3, 0}};
+
+struct Board {
+  GLuint Side;
+  std::vector<mgl::Bounds> Bounds;
+  glm::mat4 model(GLuint i) const {
+    const glm::vec2 centre(i % Side + 0.5f, i / Side + 0.5f);
+    return glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(centre, 0.0f)),
+                      glm::vec3(SCALE));
+  }
+  static GLuint mesh(GLuint i) { return i % 2; }
+  static glm::vec4 color(GLuint i) {
+    return glm::vec4((i * 37 % 255) / 255.0f, (i * 91 % 255) / 255.0f,
+                     (i * 173 % 255) / 255.0f, 1.0f);
+  }
+};
+
+static std::vector<unsigned char> readFrame() {
+  std::vector<unsigned char> pixels(SIZE * SIZE * 4);
+  glReadPixels(0, 0, SIZE, SIZE, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+  return pixels;
+}
+
+int main() {
+  mgl::test::Context context(SIZE, SIZE);
+  glViewport(0, 0, SIZE, SIZE);
+  glClearColor(0.1f, 0.1f, 0.3f, 1.0f);
+
+  mgl::ShaderProgram cpuProgram;
+  cpuProgram.addShader(GL_VERTEX_SHADER, "../../shaders/clip-vs.glsl");
+  cpuProgram.addShader(GL_FRAGMENT_SHADER, "../../shaders/clip-fs.glsl");
+  cpuProgram.addAttribute("inPosition", POSITION);
+  cpuProgram.addAttribute("inObject", OBJECT);
+  cpuProgram.addUniformBlock("Object", OBJECT_BP);
+  cpuProgram.addUniformBlock("Camera", UBO_BP);
+  cpuProgram.create();
+  mgl::ShaderProgram gpuProgram;
+  gpuProgram.addShader(GL_VERTEX_SHADER, "../../shaders/cull-vs.glsl");
+  gpuProgram.addShader(GL_FRAGMENT_SHADER, "../../shaders/clip-fs.glsl");
+  gpuProgram.addAttribute("inPosition", POSITION);
+  gpuProgram.addAttribute("inObject", OBJECT);
+  gpuProgram.addUniformBlock("Camera", UBO_BP);
+  gpuProgram.create();
+
+  mgl::JobSystem jobs;
+  std::printf("Frame time up to glFinish, best of %d:\n", FRAMES);
+  std::printf("    pieces      draws     CPU ms     GPU ms\n");
+  for (GLuint pieces = 10000; pieces <= 10000000; pieces *= 10) {
+    mgl::Resources resources;
+    Board board;
+    board.Side = static_cast<GLuint>(std::ceil(std::sqrt(double(pieces))));
+    board.Bounds.resize(pieces);
+    for (GLuint i = 0; i < pieces; ++i)
+      board.Bounds[i] = mgl::transformBounds(
+          {glm::vec2(-0.5f), glm::vec2(0.5f)}, board.model(i));
+    const glm::vec2 centre(0.5f * board.Side), half(0.05f * board.Side);
+    const mgl::Bounds view = {centre - half, centre + half};
+
+    mgl::Camera camera(resources, UBO_BP);
+    camera.setViewMatrix(glm::mat4(1.0f));
+    camera.setProjectionMatrix(glm::ortho(view.Min.x, view.Max.x, view.Min.y,
+                                          view.Max.y, -1.0f, 1.0f));
+
+    // Shared geometry, with the object slots as the CPU path's instance
+    // attribute and the culler's visible list as the GPU path's.
+    const mgl::BufferHandle vertices = resources.createBufferStorage(
+        GL_ARRAY_BUFFER, sizeof(VERTICES), VERTICES, 0);
+    const mgl::BufferHandle indices = resources.createBufferStorage(
+        GL_ELEMENT_ARRAY_BUFFER, sizeof(INDICES), INDICES, 0);
+    mgl::VertexArrayHandle vaos[2];
+    for (mgl::VertexArrayHandle &vao : vaos) {
+      vao = resources.createVertexArray();
+      glBindVertexArray(resources.id(vao));
+      glBindBuffer(GL_ARRAY_BUFFER, resources.id(vertices));
+      glEnableVertexAttribArray(POSITION);
+      glVertexAttribPointer(POSITION, 4, GL_FLOAT, GL_FALSE, 0, 0);
+      glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, resources.id(indices));
+    }
+    GLuint slots[OBJECTS];
+    std::iota(slots, slots + OBJECTS, 0u);
+    const mgl::BufferHandle slotBuffer = resources.createBufferStorage(
+        GL_ARRAY_BUFFER, sizeof(slots), slots, 0);
+    glBindVertexArray(resources.id(vaos[0]));
+    glEnableVertexAttribArray(OBJECT);
+    glVertexAttribIPointer(OBJECT, 1, GL_UNSIGNED_INT, sizeof(GLuint), 0);
+    glVertexAttribDivisor(OBJECT, 1);
+    glBindVertexArray(0);
+
+    // CPU path: the grid, and a ring sized for this view up to the cap.
+    mgl::CullGrid grid;
+    grid.build(board.Bounds);
+    std::vector<GLuint> visible(grid.size());
+    mgl::FrameArena::beginFrame();
+    const size_t draws = grid.cull(view, visible.data());
+    const GLsizeiptr stride =
+        mgl::UniformRing::align(GL_UNIFORM_BUFFER, sizeof(ObjectBlock));
+    const GLuint regionBlocks = std::max<GLuint>(
+        std::min<GLuint>(GLuint((draws + OBJECTS - 1) / OBJECTS),
+                         REGION_BLOCKS),
+        1);
+    mgl::UniformRing ring(resources, GL_UNIFORM_BUFFER, stride * regionBlocks);
+
+    // GPU path: the objects only live in the culler's buffer.
+    mgl::GpuCuller culler;
+    culler.create("../../shaders/cull-cs.glsl");
+    {
+      std::vector<mgl::GpuObject> objects(pieces);
+      for (GLuint i = 0; i < pieces; ++i)
+        objects[i] = {board.model(i), Board::color(i), board.Bounds[i],
+                      Board::mesh(i), {}};
+      culler.build(resources,
+                   objects, std::vector<mgl::DrawElementsCommand>(
+                                std::begin(MESHES), std::end(MESHES)));
+    }
+    glBindVertexArray(resources.id(vaos[1]));
+    culler.enableInstanceAttribute(resources, OBJECT);
+    glBindVertexArray(0);
+    board.Bounds = std::vector<mgl::Bounds>();
+
+    const double cpuMs = mgl::test::best(FRAMES + 1, [&]() {
+      glClear(GL_COLOR_BUFFER_BIT);
+      mgl::FrameArena::beginFrame();
+      const size_t count = grid.cull(view, visible.data(), &jobs);
+      std::sort(visible.begin(), visible.begin() + count);
+      camera.upload(resources);
+      ObjectBlock block = {};
+      GLuint blocks = 0;
+      ring.beginFrame();
+      glBindVertexArray(resources.id(vaos[0]));
+      cpuProgram.bind();
+      for (size_t first = 0; first < count; first += OBJECTS) {
+        const GLuint n =
+            static_cast<GLuint>(std::min<size_t>(count - first, OBJECTS));
+        for (GLuint k = 0; k < n; ++k) {
+          block.ModelMatrix[k] = board.model(visible[first + k]);
+          block.Color[k] = Board::color(visible[first + k]);
+        }
+        if (blocks++ == regionBlocks) {
+          ring.endFrame();
+          ring.beginFrame();
+          blocks = 1;
+        }
+        ring.bind(resources, OBJECT_BP, ring.push(block), sizeof(ObjectBlock));
+        for (GLuint k = 0; k < n; ++k) {
+          const mgl::DrawElementsCommand &mesh =
+              MESHES[Board::mesh(visible[first + k])];
+          glDrawElementsInstancedBaseVertexBaseInstance(
+              GL_TRIANGLES, mesh.Count, GL_UNSIGNED_SHORT,
+              reinterpret_cast<GLvoid *>(mesh.FirstIndex * sizeof(GLushort)),
+              1, mesh.BaseVertex, k);
+        }
+      }
+      cpuProgram.unbind();
+      glBindVertexArray(0);
+      ring.endFrame();
+      glFinish();
+    });
+    const std::vector<unsigned char> cpuFrame = readFrame();
+
+    const double gpuMs = mgl::test::best(FRAMES + 1, [&]() {
+      glClear(GL_COLOR_BUFFER_BIT);
+      camera.upload(resources);
+      culler.cull(resources, view);
+      glBindVertexArray(resources.id(vaos[1]));
+      gpuProgram.bind();
+      culler.draw(resources, GL_TRIANGLES, GL_UNSIGNED_SHORT);
+      gpuProgram.unbind();
+      glBindVertexArray(0);
+      glFinish();
+    });
+    const std::vector<unsigned char> gpuFrame = readFrame();
+
+    std::printf("  %8u %10zu %10.2f %10.2f\n", pieces, draws, cpuMs, gpuMs);
+    CHECK(cpuFrame == gpuFrame);
+    CHECK(glGetError() == GL_NO_ERROR);
+    culler.clear(resources);
+    ring.destroy(resources);
+    resources.clear();
+  }
+  return mgl::test::result();
+}
@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Job system benchmark: cost of spawning an empty job, CPU time used by idle
+// workers, and parallelFor scaling from 1 to 64 workers over a fixed amount
+// of arithmetic.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+#include "../mglJob.hpp"
+#include "./mglTest.hpp"
+
+const GLuint SPAWNS = 1000000;
+const GLuint ITEMS = 1 << 20;
+const GLuint BATCH = 1024;
+const GLuint IDLE_WORKERS = 8;
+const int IDLE_MS = 200;
+
+static void empty(const mgl::Job &) {}
+
+static float work(GLuint i) {
+  float x = static_cast<float>(i);
+  for (int k = 0; k < 16; ++k)
+    x = std::sqrt(x * 1.0001f + 1.0f);
+  return x;
+}
+
+int main() {
+  {
+    mgl::JobSystem jobs(1);
+    const double ms = mgl::test::best(3, [&]() {
+      mgl::JobCounter counter;
+      for (GLuint i = 0; i < SPAWNS; ++i)
+        jobs.run({&empty, 0, 0, 0, &counter});
+      jobs.wait(counter);
+    });
+    std::printf("Spawn and run, 1 worker: %.1f ns/job\n", ms * 1.0e6 / SPAWNS);
+  }
+
+  // Workers between frames: after a short spin they park, so a system kept
+  // for the whole run uses next to no CPU while the main thread waits.
+  {
+    mgl::JobSystem jobs(IDLE_WORKERS);
+    jobs.parallelFor(IDLE_WORKERS * BATCH, BATCH, [](GLuint, GLuint) {});
+    const std::clock_t start = std::clock();
+    std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_MS));
+    const double cpuMs = 1000.0 * (std::clock() - start) / CLOCKS_PER_SEC;
+    std::printf("Idle, %u workers: %.1f ms CPU over %d ms\n", IDLE_WORKERS,
+                cpuMs, IDLE_MS);
+    CHECK(cpuMs < 0.05 * IDLE_MS);
+  }
+
+  std::vector<float> serial(ITEMS), results(ITEMS);
+  const double base = mgl::test::best(3, [&]() {
+    for (GLuint i = 0; i < ITEMS; ++i)
+      serial[i] = work(i);
+  });
+  std::printf("parallelFor, %u items in batches of %u (%u hardware threads):\n",
+              ITEMS, BATCH, std::thread::hardware_concurrency());
+  std::printf("- serial loop: %.2f ms\n", base);
+  for (GLuint workers = 1; workers <= 64; workers *= 2) {
+    mgl::JobSystem jobs(workers);
+    const double ms = mgl::test::best(3, [&]() {
+      jobs.parallelFor(ITEMS, BATCH, [&](GLuint begin, GLuint end) {
+        for (GLuint i = begin; i < end; ++i)
+          results[i] = work(i);
+      });
+    });
+    CHECK(results == serial);
+    std::printf("- %2u workers: %.2f ms, speedup %.2f\n", workers, ms,
+                base / ms);
+  }
+  return mgl::test::result();
+}
@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Mesh optimiser benchmark: a 1M-triangle grid in scrambled triangle order,
+// without shared vertices, through each step of the pipeline, reporting time,
+// ACMR and the GPU time to draw the mesh before and after.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../mglMesh.hpp"
+#include "./mglTest.hpp"
+
+const GLuint SIDE = 708; // (SIDE - 1)^2 * 2, about 1M triangles
+const GLuint DRAWS = 10;
+
+typedef std::vector<glm::vec3> Positions;
+typedef std::vector<GLuint> Indices;
+
+// Triangle soup: three vertices of their own per triangle.
+static void makeMesh(Positions &positions, Indices &indices) {
+  std::vector<glm::uvec3> triangles;
+  for (GLuint y = 0; y + 1 < SIDE; ++y) {
+    for (GLuint x = 0; x + 1 < SIDE; ++x) {
+      const GLuint i = y * SIDE + x;
+      triangles.push_back({i, i + 1, i + SIDE});
+      triangles.push_back({i + 1, i + SIDE + 1, i + SIDE});
+    }
+  }
+  std::shuffle(triangles.begin(), triangles.end(), std::mt19937(7));
+  for (const glm::uvec3 &t : triangles) {
+    for (int k = 0; k < 3; ++k) {
+      const float x = float(t[k] % SIDE) / (SIDE - 1) * 2.0f - 1.0f;
+      const float y = float(t[k] / SIDE) / (SIDE - 1) * 2.0f - 1.0f;
+      indices.push_back(static_cast<GLuint>(positions.size()));
+      positions.push_back({x, y, 0.1f * std::sin(8.0f * x) * std::cos(8.0f * y)});
+    }
+  }
+}
+
+// Triangles as sorted position triples, rotation-independent.
+static std::vector<std::array<float, 9>> triangleSet(const Positions &positions,
+                                                     const Indices &indices) {
+  std::vector<std::array<float, 9>> set;
+  for (size_t t = 0; t < indices.size(); t += 3) {
+    size_t first = 0;
+    for (size_t k = 1; k < 3; ++k) {
+      const glm::vec3 &a = positions[indices[t + k]];
+      const glm::vec3 &b = positions[indices[t + first]];
+      if (a.x < b.x || (a.x == b.x && a.y < b.y))
+        first = k;
+    }
+    std::array<float, 9> tri;
+    for (size_t k = 0; k < 3; ++k) {
+      const glm::vec3 &p = positions[indices[t + (first + k) % 3]];
+      tri[k * 3] = p.x;
+      tri[k * 3 + 1] = p.y;
+      tri[k * 3 + 2] = p.z;
+    }
+    set.push_back(tri);
+  }
+  std::sort(set.begin(), set.end());
+  return set;
+}
+
+static void report(const char *step, double ms, const Positions &positions,
+                   const Indices &indices) {
+  const mgl::MeshStats stats = mgl::analyzeVertexCache(indices, positions.size());
+  std::printf("- %-14s %8.1f ms  %8zu vertices  ACMR %.3f  ATVR %.3f\n", step,
+              ms, positions.size(), stats.Acmr, stats.Atvr);
+}
+
+// GPU time of DRAWS draws of the whole mesh, best of three.
+static double drawTime(const Positions &positions, const Indices &indices) {
+  const char *vs = "#version 330 core\n"
+                   "in vec3 inPosition;\n"
+                   "void main() { gl_Position = vec4(inPosition, 1.0); }\n";
+  const char *fs = "#version 330 core\n"
+                   "out vec4 outColor;\n"
+                   "void main() { outColor = vec4(1.0); }\n";
+  const GLuint program = glCreateProgram();
+  const char *sources[] = {vs, fs};
+  const GLenum types[] = {GL_VERTEX_SHADER, GL_FRAGMENT_SHADER};
+  for (int s = 0; s < 2; ++s) {
+    const GLuint shader = glCreateShader(types[s]);
+    glShaderSource(shader, 1, &sources[s], 0);
+    glCompileShader(shader);
+    glAttachShader(program, shader);
+    glDeleteShader(shader);
+  }
+  glBindAttribLocation(program, 0, "inPosition");
+  glLinkProgram(program);
+
+  GLuint vao, buffers[2], query;
+  glGenVertexArrays(1, &vao);
+  glGenBuffers(2, buffers);
+  glGenQueries(1, &query);
+  glBindVertexArray(vao);
+  glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+  glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(glm::vec3),
+               positions.data(), GL_STATIC_DRAW);
+  glEnableVertexAttribArray(0);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint),
+               indices.data(), GL_STATIC_DRAW);
+  glUseProgram(program);
+  glEnable(GL_DEPTH_TEST);
+
+  double best = 0.0;
+  for (int run = 0; run < 3; ++run) {
+    glBeginQuery(GL_TIME_ELAPSED, query);
+    for (GLuint d = 0; d < DRAWS; ++d) {
+      glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+      glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()),
+                     GL_UNSIGNED_INT, 0);
+    }
+    glEndQuery(GL_TIME_ELAPSED);
+    GLuint64 ns = 0;
+    glGetQueryObjectui64v(query, GL_QUERY_RESULT, &ns);
+    const double ms = ns * 1.0e-6 / DRAWS;
+    if (run == 0 || ms < best)
+      best = ms;
+  }
+  CHECK(glGetError() == GL_NO_ERROR);
+
+  glDisable(GL_DEPTH_TEST);
+  glUseProgram(0);
+  glBindVertexArray(0);
+  glDeleteQueries(1, &query);
+  glDeleteBuffers(2, buffers);
+  glDeleteVertexArrays(1, &vao);
+  glDeleteProgram(program);
+  return best;
+}
+
+int main() {
+  Positions positions;
+  Indices indices;
+  makeMesh(positions, indices);
+  const Positions original = positions;
+  const Indices originalIndices = indices;
+
+  std::printf("Mesh optimiser, %zu triangles:\n", indices.size() / 3);
+  report("input", 0.0, positions, indices);
+  mgl::test::Stopwatch watch;
+  mgl::weldVertices(positions, indices);
+  report("weld", watch.ms(), positions, indices);
+  const Indices welded = indices;
+  watch.restart();
+  mgl::optimizeVertexCache(indices, positions.size());
+  report("vertex cache", watch.ms(), positions, indices);
+  watch.restart();
+  mgl::optimizeOverdraw(indices, positions);
+  report("overdraw", watch.ms(), positions, indices);
+  watch.restart();
+  mgl::optimizeVertexFetch(positions, indices);
+  report("vertex fetch", watch.ms(), positions, indices);
+
+  CHECK(indices.size() == originalIndices.size());
+  CHECK(positions.size() == size_t(SIDE) * SIDE);
+  CHECK(triangleSet(positions, indices) ==
+        triangleSet(original, originalIndices));
+
+  mgl::test::Context context(512, 512);
+  const Positions weldedPositions = [&]() {
+    Positions p = original;
+    Indices i = originalIndices;
+    mgl::weldVertices(p, i);
+    return p;
+  }();
+  std::printf("Draw, GPU time per draw:\n");
+  std::printf("- input:     %.2f ms\n", drawTime(original, originalIndices));
+  std::printf("- welded:    %.2f ms\n", drawTime(weldedPositions, welded));
+  std::printf("- optimised: %.2f ms\n", drawTime(positions, indices));
+  return mgl::test::result();
+}
@@ -0,0 +1,328 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Asset pack benchmark: 10k layouts of tangram placements loaded from a pack,
+// mapped and used in place, against the same layouts parsed from JSON into a
+// document and converted into records.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../mglPack.hpp"
+#include "./mglTest.hpp"
+
+const GLuint LAYOUTS = 10000;
+const GLuint PLACEMENTS = 7; // per layout
+const char *PACK_FILE = "bench_pack.pack";
+const char *JSON_FILE = "bench_pack.json";
+
+const char *PIECE_NAMES[] = {"parallelogram",        "square",
+                             "medium-triangle",      "small-triangle-left",
+                             "small-triangle-right", "large-triangle-side",
+                             "large-triangle-top"};
+
+/////////////////////////////////////////////////////////////////////////// Data
+
+struct Board {
+  std::vector<mgl::PackLayout> Layouts;
+  std::vector<mgl::PackPlacement> Placements;
+};
+
+static Board makeBoard() {
+  Board board;
+  std::mt19937 random(35);
+  std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+  for (GLuint l = 0; l < LAYOUTS; ++l) {
+    board.Layouts.push_back(
+        {0, static_cast<GLuint>(board.Placements.size()), PLACEMENTS});
+    for (GLuint p = 0; p < PLACEMENTS; ++p) {
+      const float scale = 0.4f + 0.2f * unit(random);
+      board.Placements.push_back({static_cast<GLuint>(random() % PLACEMENTS),
+                                  45.0f * static_cast<int>(random() % 8),
+                                  {unit(random), unit(random)},
+                                  {scale, scale}});
+    }
+  }
+  return board;
+}
+
+static void writePack(const Board &board) {
+  const float vertices[] = {0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f};
+  const GLushort indices[] = {0, 1, 2};
+  const std::vector<mgl::PackFormat> formats = {{0, 0, 1, 8}};
+  const std::vector<mgl::PackAttribute> attributes = {{0, 2, GL_FLOAT, 0, 0}};
+  const std::vector<mgl::PackMesh> meshes = {
+      {0, 0, GL_TRIANGLES, GL_UNSIGNED_SHORT, 0, 3, 0, 3, {0, 0}, {1, 1}}};
+
+  mgl::PackWriter writer;
+  std::vector<mgl::PackPiece> pieces;
+  for (const char *name : PIECE_NAMES)
+    pieces.push_back({writer.addString(name), 0, glm::vec4(1.0f)});
+  std::vector<mgl::PackLayout> layouts = board.Layouts;
+  for (GLuint l = 0; l < LAYOUTS; ++l)
+    layouts[l].Name = writer.addString("layout-" + std::to_string(l));
+  writer.add(mgl::PackSection::Vertices, vertices, sizeof(vertices),
+             sizeof(vertices));
+  writer.add(mgl::PackSection::Indices, indices, sizeof(indices),
+             sizeof(indices));
+  writer.add(mgl::PackSection::Formats, formats);
+  writer.add(mgl::PackSection::Attributes, attributes);
+  writer.add(mgl::PackSection::Meshes, meshes);
+  writer.add(mgl::PackSection::Pieces, pieces);
+  writer.add(mgl::PackSection::Layouts, layouts);
+  writer.add(mgl::PackSection::Placements, board.Placements);
+  CHECK(writer.write(PACK_FILE));
+}
+
+static void writeJson(const Board &board) {
+  std::ofstream out(JSON_FILE);
+  out.precision(9);
+  out << "{\n  \"layouts\": [\n";
+  for (GLuint l = 0; l < LAYOUTS; ++l) {
+    const mgl::PackLayout &layout = board.Layouts[l];
+    out << "    {\n      \"name\": \"layout-" << l
+        << "\",\n      \"placements\": [\n";
+    for (GLuint p = 0; p < layout.PlacementCount; ++p) {
+      const mgl::PackPlacement &placement =
+          board.Placements[layout.FirstPlacement + p];
+      out << "        {\"piece\": \"" << PIECE_NAMES[placement.Piece]
+          << "\", \"position\": [" << placement.Position.x << ", "
+          << placement.Position.y << "], \"angle\": " << placement.Angle
+          << ", \"scale\": [" << placement.Scale.x << ", "
+          << placement.Scale.y << "]}"
+          << (p + 1 < layout.PlacementCount ? ",\n" : "\n");
+    }
+    out << "      ]\n    }" << (l + 1 < LAYOUTS ? ",\n" : "\n");
+  }
+  out << "  ]\n}\n";
+  CHECK(out.good());
+}
+
+/////////////////////////////////////////////////////////////////////////// JSON
+
+// A plain document parser, as a JSON loader would use: the whole file is
+// read, parsed into values and then converted into records.
+
+struct Value {
+  enum Type { Null, Bool, Number, String, Array, Object } Kind = Null;
+  double Numeric = 0.0;
+  std::string Text;
+  std::vector<Value> Items;
+  std::vector<std::pair<std::string, Value>> Members;
+
+  const Value &operator[](const std::string &key) const {
+    static const Value none;
+    for (const auto &member : Members)
+      if (member.first == key)
+        return member.second;
+    return none;
+  }
+};
+
+class Parser {
+public:
+  explicit Parser(const std::string &text) : At(text.c_str()) {}
+
+  bool parse(Value &value) {
+    skip();
+    switch (*At) {
+    case '{':
+      return object(value);
+    case '[':
+      return array(value);
+    case '"':
+      value.Kind = Value::String;
+      return string(value.Text);
+    case 't':
+    case 'f':
+    case 'n':
+      return literal(value);
+    default:
+      return number(value);
+    }
+  }
+
+private:
+  const char *At;
+
+  void skip() {
+    while (std::isspace(static_cast<unsigned char>(*At)))
+      ++At;
+  }
+
+  bool object(Value &value) {
+    value.Kind = Value::Object;
+    ++At;
+    skip();
+    if (*At == '}')
+      return ++At, true;
+    while (true) {
+      std::pair<std::string, Value> member;
+      skip();
+      if (!string(member.first))
+        return false;
+      skip();
+      if (*At++ != ':' || !parse(member.second))
+        return false;
+      value.Members.push_back(std::move(member));
+      skip();
+      if (*At == '}')
+        return ++At, true;
+      if (*At++ != ',')
+        return false;
+    }
+  }
+
+  bool array(Value &value) {
+    value.Kind = Value::Array;
+    ++At;
+    skip();
+    if (*At == ']')
+      return ++At, true;
+    while (true) {
+      value.Items.emplace_back();
+      if (!parse(value.Items.back()))
+        return false;
+      skip();
+      if (*At == ']')
+        return ++At, true;
+      if (*At++ != ',')
+        return false;
+    }
+  }
+
+  bool string(std::string &text) {
+    if (*At++ != '"')
+      return false;
+    while (*At && *At != '"') {
+      if (*At == '\\' && At[1])
+        ++At;
+      text.push_back(*At++);
+    }
+    return *At++ == '"';
+  }
+
+  bool literal(Value &value) {
+    const std::string word(At, At + (*At == 'f' ? 5 : 4));
+    At += word.size();
+    value.Kind = word == "null" ? Value::Null : Value::Bool;
+    value.Numeric = word == "true" ? 1.0 : 0.0;
+    return word == "null" || word == "true" || word == "false";
+  }
+
+  bool number(Value &value) {
+    char *end;
+    value.Kind = Value::Number;
+    value.Numeric = std::strtod(At, &end);
+    const bool parsed = end != At;
+    At = end;
+    return parsed;
+  }
+};
+
+static bool loadJson(Board &board) {
+  std::ifstream in(JSON_FILE);
+  std::stringstream text;
+  text << in.rdbuf();
+  Value document;
+  if (!Parser(text.str()).parse(document))
+    return false;
+
+  board.Layouts.clear();
+  board.Placements.clear();
+  for (const Value &layout : document["layouts"].Items) {
+    board.Layouts.push_back({0, static_cast<GLuint>(board.Placements.size()),
+                             0});
+    for (const Value &placement : layout["placements"].Items) {
+      GLuint piece = 0;
+      while (piece < PLACEMENTS &&
+             placement["piece"].Text != PIECE_NAMES[piece])
+        ++piece;
+      const Value &position = placement["position"];
+      const Value &scale = placement["scale"];
+      if (piece == PLACEMENTS || position.Items.size() != 2 ||
+          scale.Items.size() != 2)
+        return false;
+      board.Placements.push_back(
+          {piece,
+           static_cast<float>(placement["angle"].Numeric),
+           {static_cast<float>(position.Items[0].Numeric),
+            static_cast<float>(position.Items[1].Numeric)},
+           {static_cast<float>(scale.Items[0].Numeric),
+            static_cast<float>(scale.Items[1].Numeric)}});
+      ++board.Layouts.back().PlacementCount;
+    }
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////// Checksum
+
+static double checksum(const mgl::PackLayout *layouts, GLuint layoutCount,
+                       const mgl::PackPlacement *placements) {
+  double sum = 0.0;
+  for (GLuint l = 0; l < layoutCount; ++l) {
+    for (GLuint p = 0; p < layouts[l].PlacementCount; ++p) {
+      const mgl::PackPlacement &placement =
+          placements[layouts[l].FirstPlacement + p];
+      sum += placement.Piece + placement.Angle + placement.Position.x +
+             placement.Position.y + placement.Scale.x + placement.Scale.y;
+    }
+  }
+  return sum;
+}
+
+static size_t fileSize(const char *filename) {
+  std::ifstream in(filename, std::ios::binary | std::ios::ate);
+  return static_cast<size_t>(in.tellg());
+}
+
+int main() {
+  const Board board = makeBoard();
+  writePack(board);
+  writeJson(board);
+  const double expected = checksum(board.Layouts.data(), LAYOUTS,
+                                   board.Placements.data());
+
+  double packSum = 0.0;
+  const double packMs = mgl::test::best(5, [&]() {
+    mgl::AssetPack pack;
+    CHECK(pack.open(PACK_FILE));
+    GLuint count;
+    const mgl::PackLayout *layouts =
+        pack.get<mgl::PackLayout>(mgl::PackSection::Layouts, &count);
+    packSum = checksum(layouts, count,
+                       pack.get<mgl::PackPlacement>(
+                           mgl::PackSection::Placements));
+  });
+
+  double jsonSum = 0.0;
+  const double jsonMs = mgl::test::best(5, [&]() {
+    Board loaded;
+    CHECK(loadJson(loaded));
+    jsonSum = checksum(loaded.Layouts.data(),
+                       static_cast<GLuint>(loaded.Layouts.size()),
+                       loaded.Placements.data());
+  });
+
+  std::printf("Load %u layouts of %u placements, best of 5:\n", LAYOUTS,
+              PLACEMENTS);
+  std::printf("- pack: %8.2f ms, %5.2f MB, mapped and validated\n", packMs,
+              fileSize(PACK_FILE) / 1.0e6);
+  std::printf("- JSON: %8.2f ms, %5.2f MB, parsed and converted\n", jsonMs,
+              fileSize(JSON_FILE) / 1.0e6);
+  CHECK(packSum == expected);
+  CHECK(jsonSum == expected);
+
+  std::remove(PACK_FILE);
+  std::remove(JSON_FILE);
+  return mgl::test::result();
+}
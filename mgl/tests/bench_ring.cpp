@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Per-draw uniform benchmark: a board of quads, one draw per quad, with the
+// quad's matrix and color set by glUniformMatrix4fv and glUniform4f, by one
+// UniformRing block and one glBindBufferRange per draw, and by the packed
+// blocks of clip-vs.glsl, 128 quads a binding picked by base instance.
+// Reports the frame time up to glFinish and checks all frames are equal.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include "../mglCamera.hpp"
+#include "../mglResource.hpp"
+#include "../mglRing.hpp"
+#include "../mglShader.hpp"
+#include "./mglTest.hpp"
+
+const GLuint POSITION = 0, OBJECT = 2;
+const GLuint UBO_BP = 0, OBJECT_BP = 1;
+const int SIZE = 256;
+const int FRAMES = 5;
+const GLuint OBJECTS = 128;
+
+// One object a block, for the ring baseline.
+struct SingleBlock {
+  glm::mat4 ModelMatrix;
+  glm::vec4 Color;
+};
+
+// Same block as the Object block of clip-vs.glsl.
+struct ObjectBlock {
+  glm::mat4 ModelMatrix[OBJECTS];
+  glm::vec4 Color[OBJECTS];
+};
+
+// clip-vs.glsl with the object as plain uniforms or as a one-object block.
+const char *UNIFORM_VS = R"(#version 330 core
+in vec4 inPosition;
+out vec4 exColor;
+uniform mat4 ModelMatrix;
+uniform vec4 Color;
+layout(std140) uniform Camera { mat4 ViewMatrix; mat4 ProjectionMatrix; };
+void main(void) {
+    gl_Position = ProjectionMatrix * ViewMatrix * ModelMatrix * inPosition;
+    exColor = Color;
+})";
+const char *BLOCK_VS = R"(#version 330 core
+in vec4 inPosition;
+out vec4 exColor;
+layout(std140) uniform Object { mat4 ModelMatrix; vec4 Color; };
+layout(std140) uniform Camera { mat4 ViewMatrix; mat4 ProjectionMatrix; };
+void main(void) {
+    gl_Position = ProjectionMatrix * ViewMatrix * ModelMatrix * inPosition;
+    exColor = Color;
+})";
+const char *FS = R"(#version 330 core
+in vec4 exColor;
+out vec4 outColor;
+void main(void) { outColor = exColor; })";
+
+const GLfloat VERTICES[] = {-0.5f, -0.5f, 0.0f, 1.0f, 0.5f,  -0.5f,
+                            0.0f,  1.0f,  0.5f, 0.5f, 0.0f,  1.0f,
+                            -0.5f, 0.5f,  0.0f, 1.0f};
+const GLushort INDICES[] = {0, 1, 2, 0, 2, 3};
+
+static GLuint compile(GLenum type, const char *source) {
+  const GLuint shader = glCreateShader(type);
+  glShaderSource(shader, 1, &source, 0);
+  glCompileShader(shader);
+  GLint compiled;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+  CHECK(compiled == GL_TRUE);
+  return shader;
+}
+
+static GLuint link(const char *vertex) {
+  const GLuint program = glCreateProgram();
+  const GLuint vs = compile(GL_VERTEX_SHADER, vertex);
+  const GLuint fs = compile(GL_FRAGMENT_SHADER, FS);
+  glAttachShader(program, vs);
+  glAttachShader(program, fs);
+  glBindAttribLocation(program, POSITION, "inPosition");
+  glLinkProgram(program);
+  GLint linked;
+  glGetProgramiv(program, GL_LINK_STATUS, &linked);
+  CHECK(linked == GL_TRUE);
+  glDeleteShader(vs);
+  glDeleteShader(fs);
+  glUniformBlockBinding(program, glGetUniformBlockIndex(program, "Camera"),
+                        UBO_BP);
+  const GLuint object = glGetUniformBlockIndex(program, "Object");
+  if (object != GL_INVALID_INDEX)
+    glUniformBlockBinding(program, object, OBJECT_BP);
+  return program;
+}
+
+static glm::mat4 model(GLuint i, GLuint side) {
+  const glm::vec2 centre(i % side + 0.5f, i / side + 0.5f);
+  return glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(centre, 0.0f)),
+                    glm::vec3(0.8f));
+}
+
+static glm::vec4 color(GLuint i) {
+  return glm::vec4((i * 37 % 255) / 255.0f, (i * 91 % 255) / 255.0f,
+                   (i * 173 % 255) / 255.0f, 1.0f);
+}
+
+static std::vector<unsigned char> readFrame() {
+  std::vector<unsigned char> pixels(SIZE * SIZE * 4);
+  glReadPixels(0, 0, SIZE, SIZE, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+  return pixels;
+}
+
+static void drawQuad() {
+  glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, 0);
+}
+
+int main() {
+  mgl::test::Context context(SIZE, SIZE);
+  glViewport(0, 0, SIZE, SIZE);
+  glClearColor(0.1f, 0.1f, 0.3f, 1.0f);
+
+  const GLuint uniformProgram = link(UNIFORM_VS);
+  const GLint modelLocation =
+      glGetUniformLocation(uniformProgram, "ModelMatrix");
+  const GLint colorLocation = glGetUniformLocation(uniformProgram, "Color");
+  const GLuint blockProgram = link(BLOCK_VS);
+  mgl::ShaderProgram packedProgram;
+  packedProgram.addShader(GL_VERTEX_SHADER, "../../shaders/clip-vs.glsl");
+  packedProgram.addShader(GL_FRAGMENT_SHADER, "../../shaders/clip-fs.glsl");
+  packedProgram.addAttribute("inPosition", POSITION);
+  packedProgram.addAttribute("inObject", OBJECT);
+  packedProgram.addUniformBlock("Object", OBJECT_BP);
+  packedProgram.addUniformBlock("Camera", UBO_BP);
+  packedProgram.create();
+
+  std::printf("Frame time up to glFinish, best of %d:\n", FRAMES);
+  std::printf("     draws    uniform ms    ring ms  packed ms\n");
+  for (GLuint side = 64; side <= 512; side *= 2) {
+    const GLuint draws = side * side;
+    mgl::Resources resources;
+    mgl::Camera camera(resources, UBO_BP);
+    camera.setViewMatrix(glm::mat4(1.0f));
+    camera.setProjectionMatrix(
+        glm::ortho(0.0f, float(side), 0.0f, float(side), -1.0f, 1.0f));
+    camera.upload(resources);
+
+    GLuint slots[OBJECTS];
+    std::iota(slots, slots + OBJECTS, 0u);
+    const mgl::BufferHandle vertices = resources.createBufferStorage(
+        GL_ARRAY_BUFFER, sizeof(VERTICES), VERTICES, 0);
+    const mgl::BufferHandle slotBuffer = resources.createBufferStorage(
+        GL_ARRAY_BUFFER, sizeof(slots), slots, 0);
+    const mgl::BufferHandle indices = resources.createBufferStorage(
+        GL_ELEMENT_ARRAY_BUFFER, sizeof(INDICES), INDICES, 0);
+    const mgl::VertexArrayHandle vao = resources.createVertexArray();
+    glBindVertexArray(resources.id(vao));
+    glBindBuffer(GL_ARRAY_BUFFER, resources.id(vertices));
+    glEnableVertexAttribArray(POSITION);
+    glVertexAttribPointer(POSITION, 4, GL_FLOAT, GL_FALSE, 0, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, resources.id(slotBuffer));
+    glEnableVertexAttribArray(OBJECT);
+    glVertexAttribIPointer(OBJECT, 1, GL_UNSIGNED_INT, sizeof(GLuint), 0);
+    glVertexAttribDivisor(OBJECT, 1);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, resources.id(indices));
+
+    mgl::UniformRing singleRing(
+        resources, GL_UNIFORM_BUFFER,
+        mgl::UniformRing::align(GL_UNIFORM_BUFFER, sizeof(SingleBlock)) *
+            draws);
+    const GLuint blocks = (draws + OBJECTS - 1) / OBJECTS;
+    mgl::UniformRing packedRing(
+        resources, GL_UNIFORM_BUFFER,
+        mgl::UniformRing::align(GL_UNIFORM_BUFFER, sizeof(ObjectBlock)) *
+            blocks);
+
+    const double uniformMs = mgl::test::best(FRAMES + 1, [&]() {
+      glClear(GL_COLOR_BUFFER_BIT);
+      glUseProgram(uniformProgram);
+      for (GLuint i = 0; i < draws; ++i) {
+        glUniformMatrix4fv(modelLocation, 1, GL_FALSE,
+                           glm::value_ptr(model(i, side)));
+        const glm::vec4 c = color(i);
+        glUniform4f(colorLocation, c.r, c.g, c.b, c.a);
+        drawQuad();
+      }
+      glUseProgram(0);
+      glFinish();
+    });
+    const std::vector<unsigned char> uniformFrame = readFrame();
+
+    const double ringMs = mgl::test::best(FRAMES + 1, [&]() {
+      glClear(GL_COLOR_BUFFER_BIT);
+      singleRing.beginFrame();
+      glUseProgram(blockProgram);
+      for (GLuint i = 0; i < draws; ++i) {
+        const GLintptr offset =
+            singleRing.push(SingleBlock{model(i, side), color(i)});
+        singleRing.bind(resources, OBJECT_BP, offset, sizeof(SingleBlock));
+        drawQuad();
+      }
+      glUseProgram(0);
+      singleRing.endFrame();
+      glFinish();
+    });
+    const std::vector<unsigned char> ringFrame = readFrame();
+
+    ObjectBlock block = {};
+    const double packedMs = mgl::test::best(FRAMES + 1, [&]() {
+      glClear(GL_COLOR_BUFFER_BIT);
+      packedRing.beginFrame();
+      packedProgram.bind();
+      for (GLuint first = 0; first < draws; first += OBJECTS) {
+        const GLuint n = std::min(draws - first, OBJECTS);
+        for (GLuint k = 0; k < n; ++k) {
+          block.ModelMatrix[k] = model(first + k, side);
+          block.Color[k] = color(first + k);
+        }
+        packedRing.bind(resources, OBJECT_BP, packedRing.push(block),
+                        sizeof(ObjectBlock));
+        for (GLuint k = 0; k < n; ++k)
+          glDrawElementsInstancedBaseVertexBaseInstance(
+              GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, 0, 1, 0, k);
+      }
+      packedProgram.unbind();
+      packedRing.endFrame();
+      glFinish();
+    });
+    const std::vector<unsigned char> packedFrame = readFrame();
+    glBindVertexArray(0);
+
+    std::printf("  %8u %13.2f %10.2f %10.2f\n", draws, uniformMs, ringMs,
+                packedMs);
+    CHECK(ringFrame == uniformFrame);
+    CHECK(packedFrame == uniformFrame);
+    CHECK(glGetError() == GL_NO_ERROR);
+    singleRing.destroy(resources);
+    packedRing.destroy(resources);
+    camera.destroy(resources);
+    resources.clear();
+  }
+  glDeleteProgram(uniformProgram);
+  glDeleteProgram(blockProgram);
+  return mgl::test::result();
+}
@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Test and Benchmark Helpers
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MGL_TEST_HPP
+#define MGL_TEST_HPP
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace mgl {
+namespace test {
+
+////////////////////////////////////////////////////////////////////////// Check
+
+// CHECK counts a failure and reports where it happened; result() is the exit
+// status of the test.
+
+inline int &failures() {
+  static int count = 0;
+  return count;
+}
+
+inline bool check(bool passed, const char *expression, const char *file,
+                  int line) {
+  if (!passed) {
+    std::cerr << "[FAIL] " << file << ":" << line << ": " << expression
+              << std::endl;
+    ++failures();
+  }
+  return passed;
+}
+
+#define CHECK(expression)                                                      \
+  mgl::test::check(static_cast<bool>(expression), #expression, __FILE__,       \
+                   __LINE__)
+
+inline int result() { return failures() > 0 ? EXIT_FAILURE : EXIT_SUCCESS; }
+
+////////////////////////////////////////////////////////////////////// Stopwatch
+
+class Stopwatch {
+public:
+  Stopwatch() : Start(Clock::now()) {}
+  void restart() { Start = Clock::now(); }
+  double ms() const {
+    return std::chrono::duration<double, std::milli>(Clock::now() - Start)
+        .count();
+  }
+
+private:
+  typedef std::chrono::steady_clock Clock;
+  Clock::time_point Start;
+};
+
+// Best time of runs calls, in milliseconds.
+template <typename F> double best(int runs, F f) {
+  double best = 0.0;
+  for (int i = 0; i < runs; ++i) {
+    Stopwatch watch;
+    f();
+    const double ms = watch.ms();
+    if (i == 0 || ms < best)
+      best = ms;
+  }
+  return best;
+}
+
+//////////////////////////////////////////////////////////////////////// Context
+
+// Hidden window whose core profile context is current while it lives, for
+// tests and benchmarks that need GL.
+
+class Context {
+public:
+  explicit Context(int width = 64, int height = 64, int major = 4,
+                   int minor = 5) {
+    if (!glfwInit()) {
+      std::cerr << "[ERROR] Failed to initialize GLFW" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, major);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, minor);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    Window = glfwCreateWindow(width, height, "mgl test", 0, 0);
+    if (!Window) {
+      std::cerr << "[ERROR] Failed to create a GL " << major << "." << minor
+                << " context" << std::endl;
+      glfwTerminate();
+      exit(EXIT_FAILURE);
+    }
+    glfwMakeContextCurrent(Window);
+    glewExperimental = GL_TRUE;
+    if (glewInit() != GLEW_OK) {
+      std::cerr << "[ERROR] Failed to initialize GLEW" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    glGetError();
+  }
+  ~Context() {
+    glfwDestroyWindow(Window);
+    glfwTerminate();
+  }
+  Context(const Context &) = delete;
+  void operator=(const Context &) = delete;
+
+  GLFWwindow *window() const { return Window; }
+
+private:
+  GLFWwindow *Window;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+} // namespace test
+} // namespace mgl
+
+#endif /* MGL_TEST_HPP */
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Frame arena tests: alignment, overflow and growth, and no heap allocation
+// in steady-state frames of the per-frame paths (arena vectors, command lists,
+// culling), counted by replacing the global operator new.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "../mglArena.hpp"
+#include "../mglCommand.hpp"
+#include "../mglCulling.hpp"
+#include "./mglTest.hpp"
+
+static std::atomic<size_t> Allocations(0);
+
+void *operator new(size_t size) {
+  Allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+void operator delete[](void *p, size_t) noexcept { std::free(p); }
+
+static void alignment() {
+  mgl::FrameArena arena(1024);
+  for (size_t a = 1; a <= 256; a *= 2) {
+    const uintptr_t p = reinterpret_cast<uintptr_t>(arena.allocate(3, a));
+    CHECK(p % a == 0);
+  }
+}
+
+static void growth() {
+  mgl::FrameArena arena(1024);
+  for (int i = 0; i < 100; ++i)
+    arena.allocate(100, 16);
+  CHECK(arena.used() >= 100 * 100);
+  arena.reset();
+  CHECK(arena.used() == 0);
+  CHECK(arena.capacity() >= 100 * 100);
+
+  // The next frame of the same size fits in the grown block.
+  const size_t before = Allocations.load();
+  for (int i = 0; i < 100; ++i)
+    arena.allocate(100, 16);
+  arena.reset();
+  CHECK(Allocations.load() == before);
+}
+
+static void destroyWithOverflow() {
+  mgl::FrameArena *arena = new mgl::FrameArena(64);
+  for (int i = 0; i < 10; ++i)
+    arena->allocate(1000);
+  const size_t before = Allocations.load();
+  delete arena;
+  CHECK(Allocations.load() == before);
+}
+
+// A frame as the app runs it: transient vectors, a reused command list and a
+// culling query.
+static void frame(mgl::CommandList &commands, const mgl::CullGrid &grid,
+                  std::vector<GLuint> &visible, GLuint n) {
+  mgl::FrameArena::beginFrame();
+  mgl::FrameVector<glm::mat4> matrices;
+  for (GLuint i = 0; i < n; ++i)
+    matrices.push_back(glm::mat4(float(i)));
+  commands.reset();
+  commands.clear(GL_COLOR_BUFFER_BIT);
+  for (GLuint i = 0; i < n; ++i) {
+    commands.uniform(0, matrices[i]);
+    commands.drawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, 0);
+  }
+  const float side = 10.0f + float(n % 7);
+  grid.cull({glm::vec2(-side), glm::vec2(side)}, visible.data());
+}
+
+static void steadyState() {
+  std::vector<mgl::Bounds> bounds;
+  for (int y = -50; y < 50; ++y)
+    for (int x = -50; x < 50; ++x)
+      bounds.push_back({glm::vec2(x, y), glm::vec2(x + 0.5f, y + 0.5f)});
+  mgl::CullGrid grid;
+  grid.build(bounds);
+  std::vector<GLuint> visible(grid.size());
+  mgl::CommandList commands;
+
+  for (GLuint i = 0; i < 8; ++i) // warm up to the working size
+    frame(commands, grid, visible, 1000);
+  const size_t before = Allocations.load();
+  for (GLuint i = 0; i < 100; ++i)
+    frame(commands, grid, visible, 1000 - i);
+  CHECK(Allocations.load() == before);
+}
+
+int main() {
+  alignment();
+  growth();
+  destroyWithOverflow();
+  steadyState();
+  return mgl::test::result();
+}
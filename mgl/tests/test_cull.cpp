@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Culling grid tests: results against a brute-force overlap test, with and
+// without a job system, and views that are NaN, infinite or far outside the
+// board.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "../mglArena.hpp"
+#include "../mglCulling.hpp"
+#include "../mglJob.hpp"
+#include "./mglTest.hpp"
+
+static std::vector<mgl::Bounds> makeBoard(size_t count) {
+  std::mt19937 random(37);
+  std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+  std::uniform_real_distribution<float> size(0.1f, 2.0f);
+  std::vector<mgl::Bounds> bounds(count);
+  for (mgl::Bounds &b : bounds) {
+    b.Min = glm::vec2(position(random), position(random));
+    b.Max = b.Min + glm::vec2(size(random), size(random));
+  }
+  return bounds;
+}
+
+static std::vector<GLuint> cull(const mgl::CullGrid &grid,
+                                const mgl::Bounds &view,
+                                mgl::JobSystem *jobs = 0) {
+  mgl::FrameArena::beginFrame();
+  std::vector<GLuint> visible(grid.size());
+  visible.resize(grid.cull(view, visible.data(), jobs));
+  std::sort(visible.begin(), visible.end());
+  return visible;
+}
+
+static std::vector<GLuint> bruteForce(const std::vector<mgl::Bounds> &bounds,
+                                      const mgl::Bounds &view) {
+  std::vector<GLuint> visible;
+  for (GLuint i = 0; i < bounds.size(); ++i)
+    if (mgl::overlaps(bounds[i], view))
+      visible.push_back(i);
+  return visible;
+}
+
+static void matchesBruteForce() {
+  const std::vector<mgl::Bounds> bounds = makeBoard(100000);
+  mgl::CullGrid grid;
+  grid.build(bounds);
+  mgl::JobSystem jobs(4);
+  std::mt19937 random(7);
+  std::uniform_real_distribution<float> centre(-120.0f, 120.0f);
+  std::uniform_real_distribution<float> half(0.5f, 80.0f);
+  for (int i = 0; i < 50; ++i) {
+    const glm::vec2 c(centre(random), centre(random));
+    const glm::vec2 h(half(random), half(random));
+    const mgl::Bounds view = {c - h, c + h};
+    const std::vector<GLuint> expected = bruteForce(bounds, view);
+    CHECK(cull(grid, view) == expected);
+    CHECK(cull(grid, view, &jobs) == expected);
+  }
+}
+
+static void degenerateViews() {
+  const std::vector<mgl::Bounds> bounds = makeBoard(10000);
+  mgl::CullGrid grid;
+  grid.build(bounds);
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const float inf = std::numeric_limits<float>::infinity();
+  const float huge = 1e30f;
+
+  CHECK(cull(grid, {glm::vec2(nan), glm::vec2(nan)}).empty());
+  CHECK(cull(grid, {glm::vec2(-1.0f), glm::vec2(nan, 1.0f)}).empty());
+  CHECK(cull(grid, {glm::vec2(nan, -1.0f), glm::vec2(1.0f)}).empty());
+  CHECK(cull(grid, {glm::vec2(-inf), glm::vec2(inf)}).size() == bounds.size());
+  CHECK(cull(grid, {glm::vec2(-huge), glm::vec2(huge)}).size() ==
+        bounds.size());
+  CHECK(cull(grid, {glm::vec2(-huge), glm::vec2(-huge * 0.5f)}).empty());
+  CHECK(cull(grid, {glm::vec2(huge * 0.5f), glm::vec2(huge)}).empty());
+  CHECK(cull(grid, {glm::vec2(-huge, 0.0f), glm::vec2(huge, 1.0f)}) ==
+        bruteForce(bounds, {glm::vec2(-huge, 0.0f), glm::vec2(huge, 1.0f)}));
+}
+
+int main() {
+  matchesBruteForce();
+  degenerateViews();
+  return mgl::test::result();
+}
@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Job system tests: every range of a parallelFor runs exactly once, with more
+// jobs in flight than a worker's queue holds, nested and with dependencies.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <vector>
+
+#include "../mglJob.hpp"
+#include "./mglTest.hpp"
+
+static void exactlyOnce(GLuint workers, GLuint count, GLuint batch) {
+  mgl::JobSystem jobs(workers);
+  std::vector<std::atomic<GLuint>> runs(count);
+  for (std::atomic<GLuint> &r : runs)
+    r.store(0);
+  jobs.parallelFor(count, batch, [&](GLuint begin, GLuint end) {
+    for (GLuint i = begin; i < end; ++i)
+      runs[i].fetch_add(1);
+  });
+  GLuint wrong = 0;
+  for (std::atomic<GLuint> &r : runs)
+    wrong += r.load() != 1;
+  CHECK(wrong == 0);
+}
+
+static void nested(GLuint workers) {
+  const GLuint OUTER = 64, INNER = 1000;
+  mgl::JobSystem jobs(workers);
+  std::vector<std::atomic<GLuint>> runs(OUTER * INNER);
+  for (std::atomic<GLuint> &r : runs)
+    r.store(0);
+  jobs.parallelFor(OUTER, 1, [&](GLuint outer, GLuint) {
+    jobs.parallelFor(INNER, 1, [&](GLuint begin, GLuint end) {
+      for (GLuint i = begin; i < end; ++i)
+        runs[outer * INNER + i].fetch_add(1);
+    });
+  });
+  GLuint wrong = 0;
+  for (std::atomic<GLuint> &r : runs)
+    wrong += r.load() != 1;
+  CHECK(wrong == 0);
+}
+
+struct Ordered {
+  std::atomic<GLuint> First, Second, Late;
+};
+
+static void first(const mgl::Job &job) {
+  static_cast<Ordered *>(job.Data)->First.fetch_add(1);
+}
+
+static void second(const mgl::Job &job) {
+  Ordered &o = *static_cast<Ordered *>(job.Data);
+  if (o.First.load() != job.End)
+    o.Late.fetch_add(1);
+  o.Second.fetch_add(1);
+}
+
+static void dependency(GLuint workers) {
+  const GLuint COUNT = 10000;
+  mgl::JobSystem jobs(workers);
+  Ordered o;
+  o.First = o.Second = o.Late = 0;
+  mgl::JobCounter a, b;
+  for (GLuint i = 0; i < COUNT; ++i)
+    jobs.run({&first, &o, i, COUNT, &a});
+  for (GLuint i = 0; i < COUNT; ++i)
+    jobs.run({&second, &o, i, COUNT, &b, &a});
+  jobs.wait(b);
+  CHECK(a.done());
+  CHECK(o.Second.load() == COUNT);
+  CHECK(o.Late.load() == 0);
+}
+
+int main() {
+  const GLuint CAPACITY = static_cast<GLuint>(mgl::JobQueue::CAPACITY);
+  exactlyOnce(1, 10000, 1);
+  exactlyOnce(1, 4 * CAPACITY + 1, 1);
+  exactlyOnce(4, 100000, 1);
+  exactlyOnce(8, 100000, 7);
+  nested(1);
+  nested(4);
+  dependency(1);
+  dependency(4);
+  return mgl::test::result();
+}
@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Asset pack tests: a small pack round trip, and packs whose records refer
+// out of their sections being rejected by open().
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <vector>
+
+#include "../mglPack.hpp"
+#include "./mglTest.hpp"
+
+const char *FILENAME = "test_pack.pack";
+
+// One triangle mesh on one piece, placed once by one layout.
+struct Records {
+  std::vector<float> Vertices = {0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f};
+  std::vector<GLushort> Indices = {0, 1, 2};
+  std::vector<mgl::PackFormat> Formats = {{0, 0, 1, 8}};
+  std::vector<mgl::PackAttribute> Attributes = {{0, 2, GL_FLOAT, 0, 0}};
+  std::vector<mgl::PackMesh> Meshes = {{0, 0, GL_TRIANGLES, GL_UNSIGNED_SHORT,
+                                        0, 3, 0, 3, {0.0f, 0.0f},
+                                        {1.0f, 1.0f}}};
+  std::vector<mgl::PackPiece> Pieces = {{0, 0, {1.0f, 0.0f, 0.0f, 1.0f}}};
+  std::vector<mgl::PackLayout> Layouts = {{0, 0, 1}};
+  std::vector<mgl::PackPlacement> Placements = {
+      {0, 90.0f, {0.5f, 0.5f}, {1.0f, 1.0f}}};
+};
+
+static void write(const Records &records) {
+  mgl::PackWriter writer;
+  writer.add(mgl::PackSection::Vertices, records.Vertices.data(),
+             records.Vertices.size() * sizeof(float),
+             static_cast<GLuint>(records.Vertices.size() * sizeof(float)));
+  writer.add(mgl::PackSection::Indices, records.Indices.data(),
+             records.Indices.size() * sizeof(GLushort),
+             static_cast<GLuint>(records.Indices.size() * sizeof(GLushort)));
+  writer.add(mgl::PackSection::Formats, records.Formats);
+  writer.add(mgl::PackSection::Attributes, records.Attributes);
+  writer.add(mgl::PackSection::Meshes, records.Meshes);
+  writer.add(mgl::PackSection::Pieces, records.Pieces);
+  writer.add(mgl::PackSection::Layouts, records.Layouts);
+  writer.add(mgl::PackSection::Placements, records.Placements);
+  CHECK(writer.write(FILENAME));
+}
+
+static bool opens(const Records &records) {
+  write(records);
+  mgl::AssetPack pack;
+  const bool opened = pack.open(FILENAME);
+  std::remove(FILENAME);
+  return opened;
+}
+
+static void roundTrip() {
+  write(Records());
+  mgl::AssetPack pack;
+  CHECK(pack.open(FILENAME));
+  GLuint count;
+  const mgl::PackPlacement *placements =
+      pack.get<mgl::PackPlacement>(mgl::PackSection::Placements, &count);
+  CHECK(count == 1 && placements[0].Angle == 90.0f);
+  const mgl::PackMesh *meshes =
+      pack.get<mgl::PackMesh>(mgl::PackSection::Meshes, &count);
+  CHECK(count == 1 && meshes[0].IndexCount == 3);
+  pack.close();
+  std::remove(FILENAME);
+
+  // Sections are optional; a board without placements needs no pieces.
+  Records empty;
+  empty.Layouts[0].PlacementCount = 0;
+  mgl::PackWriter writer;
+  writer.add(mgl::PackSection::Layouts, empty.Layouts);
+  CHECK(writer.write(FILENAME));
+  CHECK(pack.open(FILENAME));
+  CHECK(pack.get<mgl::PackMesh>(mgl::PackSection::Meshes, &count) == 0);
+  CHECK(count == 0);
+  pack.close();
+  std::remove(FILENAME);
+}
+
+static void outOfRange() {
+  Records records;
+  records.Layouts[0].PlacementCount = 2;
+  CHECK(!opens(records));
+
+  records = Records();
+  records.Layouts[0].FirstPlacement = 0xFFFFFFFFu; // wraps around in 32 bits
+  records.Layouts[0].PlacementCount = 2;
+  CHECK(!opens(records));
+
+  records = Records();
+  records.Placements[0].Piece = 1;
+  CHECK(!opens(records));
+
+  records = Records();
+  records.Pieces[0].Mesh = 1;
+  CHECK(!opens(records));
+
+  records = Records();
+  records.Meshes[0].Format = 1;
+  CHECK(!opens(records));
+
+  records = Records();
+  records.Formats[0].AttributeCount = 2;
+  CHECK(!opens(records));
+
+  records = Records();
+  records.Meshes[0].IndexCount = 4;
+  CHECK(!opens(records));
+
+  records = Records();
+  records.Meshes[0].IndexOffset = 2;
+  CHECK(!opens(records));
+
+  records = Records();
+  records.Meshes[0].IndexOffset = 1; // not a whole index
+  records.Meshes[0].IndexCount = 2;
+  CHECK(!opens(records));
+
+  records = Records();
+  records.Meshes[0].IndexType = GL_FLOAT;
+  CHECK(!opens(records));
+
+  records = Records();
+  records.Meshes[0].BaseVertex = 1;
+  CHECK(!opens(records));
+}
+
+int main() {
+  roundTrip();
+  outOfRange();
+  return mgl::test::result();
+}
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Resource pool tests on a record type without GL objects: handle validity
+// and reuse, retired records, a full pool, and 1M creations and destructions
+// in one frame.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <vector>
+
+#include "../mglResource.hpp"
+#include "./mglTest.hpp"
+
+struct FakeRecord {
+  GLuint Id;
+  static size_t Released;
+  static void release(GLuint) { ++Released; }
+};
+size_t FakeRecord::Released = 0;
+
+typedef mgl::ResourcePool<FakeRecord> FakePool;
+typedef FakePool::HandleType FakeHandle;
+
+// Pools are large once filled; tests share static storage.
+static FakePool &fresh() {
+  static FakePool *pool = 0;
+  delete pool;
+  pool = new FakePool;
+  FakeRecord::Released = 0;
+  return *pool;
+}
+
+static void handles() {
+  FakePool &pool = fresh();
+  const FakeHandle a = pool.create({1});
+  const FakeHandle b = pool.create({2});
+  CHECK(pool.id(a) == 1 && pool.id(b) == 2);
+  CHECK(!pool.isValid(FakeHandle()));
+
+  pool.destroy(a);
+  CHECK(!pool.isValid(a));
+  CHECK(pool.id(a) == 0);
+  CHECK(pool.size() == 1 && pool.slots() == 2);
+  pool.destroy(a); // stale handles are ignored
+  CHECK(FakeRecord::Released == 0);
+
+  size_t visited = 0;
+  pool.forEach([&](FakeRecord &record) {
+    CHECK(record.Id == 2);
+    ++visited;
+  });
+  CHECK(visited == 1);
+
+  pool.clear();
+  CHECK(FakeRecord::Released == 2);
+  CHECK(pool.size() == 0 && pool.slots() == 0);
+
+  // A reused slot gets a new generation.
+  const FakeHandle c = pool.create({3});
+  CHECK(c.index() == a.index() || c.index() == b.index());
+  CHECK(c != a && c != b);
+  CHECK(!pool.isValid(a) && !pool.isValid(b) && pool.id(c) == 3);
+}
+
+static void full() {
+  FakePool &pool = fresh();
+  for (GLuint i = 0; i < FakePool::CAPACITY; ++i)
+    pool.create({i + 1});
+  CHECK(pool.size() == FakePool::CAPACITY);
+  CHECK(!pool.create({1}));
+  pool.clear();
+  CHECK(FakeRecord::Released == FakePool::CAPACITY);
+  CHECK(pool.create({1}));
+}
+
+static void churn() {
+  const GLuint COUNT = 1000000;
+  FakePool &pool = fresh();
+  std::vector<FakeHandle> handles(COUNT);
+  size_t memory = 0;
+  for (GLuint frame = 0; frame < 3; ++frame) {
+    mgl::test::Stopwatch watch;
+    for (GLuint i = 0; i < COUNT; ++i)
+      handles[i] = pool.create({i + 1});
+    for (GLuint i = 0; i < COUNT; ++i)
+      pool.destroy(handles[i]);
+    const double ms = watch.ms();
+    CHECK(pool.size() == 0);
+    CHECK(pool.slots() == COUNT); // retired, waiting for the GPU
+    GLuint valid = 0;
+    for (GLuint i = 0; i < COUNT; ++i)
+      valid += pool.isValid(handles[i]);
+    CHECK(valid == 0);
+    pool.clear(); // the GPU is idle: retired objects are released
+    CHECK(pool.slots() == 0);
+    CHECK(FakeRecord::Released == size_t(COUNT) * (frame + 1));
+    if (frame == 0)
+      memory = pool.memory();
+    CHECK(pool.memory() == memory); // slots are reused, storage stays put
+    std::printf("1M create + destroy, frame %u: %.1f ms, %.1f MB\n", frame, ms,
+                pool.memory() / (1024.0 * 1024.0));
+  }
+}
+
+int main() {
+  handles();
+  full();
+  churn();
+  return mgl::test::result();
+}
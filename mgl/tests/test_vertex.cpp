@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Vertex format tests: every packed type round-trips through pack/unpack
+// within its precision, layouts are checked at compile time, and GL decodes
+// each format as unpack() does (read back through transform feedback).
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+
+#include <cstdio>
+#include <vector>
+
+#include "../mglVertex.hpp"
+#include "./mglTest.hpp"
+
+struct PackedVertex {
+  mgl::Half2 Position;
+  mgl::Snorm2 TexCoord;
+  mgl::Snorm10 Normal;
+  mgl::Unorm4 Color;
+};
+
+constexpr mgl::VertexAttribute PACKED_ATTRIBUTES[] = {
+    MGL_VERTEX_ATTRIBUTE(0, PackedVertex, Position),
+    MGL_VERTEX_ATTRIBUTE(1, PackedVertex, TexCoord),
+    MGL_VERTEX_ATTRIBUTE(2, PackedVertex, Normal),
+    MGL_VERTEX_ATTRIBUTE(3, PackedVertex, Color)};
+
+struct Misaligned {
+  GLubyte Flag;
+  mgl::Half2 Position;
+};
+
+constexpr mgl::VertexAttribute MISALIGNED_ATTRIBUTES[] = {
+    MGL_VERTEX_ATTRIBUTE(0, Misaligned, Position)};
+
+static_assert(mgl::isValidLayout<PackedVertex>(PACKED_ATTRIBUTES),
+              "packed vertex layout");
+static_assert(!mgl::isValidLayout<Misaligned>(MISALIGNED_ATTRIBUTES),
+              "half2 at offset 2");
+static_assert(sizeof(PackedVertex) == 16, "packed vertex size");
+static_assert(mgl::VertexFormat<mgl::Snorm10>::Type == GL_INT_2_10_10_10_REV,
+              "snorm10 format");
+static_assert(mgl::VertexFormat<mgl::Unorm4>::Normalized == GL_TRUE,
+              "unorm4 format");
+
+static bool near(const glm::vec4 &a, const glm::vec4 &b, float tolerance) {
+  return glm::all(glm::lessThanEqual(glm::abs(a - b), glm::vec4(tolerance)));
+}
+
+static std::vector<glm::vec4> samples() {
+  std::vector<glm::vec4> values = {
+      glm::vec4(0.0f), glm::vec4(1.0f), glm::vec4(-1.0f),
+      glm::vec4(0.5f, -0.5f, 0.25f, 0.75f), glm::vec4(2.0f, -2.0f, 1.5f, -1.5f)};
+  for (int i = 0; i < 251; ++i) {
+    const float t = float(i) / 125.0f - 1.0f;
+    values.push_back(glm::vec4(t, -t, t * t, 1.0f - t * t));
+  }
+  return values;
+}
+
+static void roundTrip() {
+  for (const glm::vec4 &v : samples()) {
+    const glm::vec4 clamped = glm::clamp(v, -1.0f, 1.0f);
+    const glm::vec4 unit = glm::clamp(v, 0.0f, 1.0f);
+    // Halves keep 11 significant bits.
+    const glm::vec2 h = mgl::unpack(mgl::packHalf2(glm::vec2(v)));
+    CHECK(near(glm::vec4(h, 0, 0), glm::vec4(glm::vec2(v), 0, 0),
+               glm::max(glm::abs(v.x), glm::abs(v.y)) / 1024.0f));
+    const glm::vec2 s = mgl::unpack(mgl::packSnorm2(glm::vec2(v)));
+    CHECK(near(glm::vec4(s, 0, 0), glm::vec4(glm::vec2(clamped), 0, 0),
+               0.5f / 32767.0f + 1.0e-6f));
+    const glm::vec3 n = mgl::unpack(mgl::packSnorm10(glm::vec3(v)));
+    CHECK(near(glm::vec4(n, 0), glm::vec4(glm::vec3(clamped), 0),
+               0.5f / 511.0f + 1.0e-6f));
+    const glm::vec4 c = mgl::unpack(mgl::packUnorm4(v));
+    CHECK(near(c, unit, 0.5f / 255.0f + 1.0e-6f));
+  }
+}
+
+static GLuint compile(GLenum type, const char *source) {
+  const GLuint shader = glCreateShader(type);
+  glShaderSource(shader, 1, &source, 0);
+  glCompileShader(shader);
+  GLint ok = GL_FALSE;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+  CHECK(ok == GL_TRUE);
+  return shader;
+}
+
+// Each attribute is copied to an output and captured, as GL decoded it.
+static void decodedByGL() {
+  mgl::test::Context context;
+  const char *source = "#version 330 core\n"
+                       "in vec4 inPosition, inTexCoord, inNormal, inColor;\n"
+                       "out vec4 Position, TexCoord, Normal, Color;\n"
+                       "void main() {\n"
+                       "  Position = inPosition; TexCoord = inTexCoord;\n"
+                       "  Normal = inNormal; Color = inColor;\n"
+                       "}\n";
+  const GLuint program = glCreateProgram();
+  const GLuint shader = compile(GL_VERTEX_SHADER, source);
+  glAttachShader(program, shader);
+  const char *names[] = {"inPosition", "inTexCoord", "inNormal", "inColor"};
+  for (GLuint i = 0; i < 4; ++i)
+    glBindAttribLocation(program, i, names[i]);
+  const char *varyings[] = {"Position", "TexCoord", "Normal", "Color"};
+  glTransformFeedbackVaryings(program, 4, varyings, GL_INTERLEAVED_ATTRIBS);
+  glLinkProgram(program);
+  GLint linked = GL_FALSE;
+  glGetProgramiv(program, GL_LINK_STATUS, &linked);
+  CHECK(linked == GL_TRUE);
+
+  const std::vector<glm::vec4> values = samples();
+  std::vector<PackedVertex> vertices;
+  for (const glm::vec4 &v : values)
+    vertices.push_back({mgl::packHalf2(glm::vec2(v)),
+                        mgl::packSnorm2(glm::vec2(v.z, v.w)),
+                        mgl::packSnorm10(glm::vec3(v)), mgl::packUnorm4(v)});
+  const GLsizei count = static_cast<GLsizei>(vertices.size());
+
+  GLuint vao, buffers[2];
+  glGenVertexArrays(1, &vao);
+  glGenBuffers(2, buffers);
+  glBindVertexArray(vao);
+  glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+  glBufferData(GL_ARRAY_BUFFER, count * sizeof(PackedVertex), vertices.data(),
+               GL_STATIC_DRAW);
+  mgl::makeLayout<PackedVertex>(PACKED_ATTRIBUTES).enable();
+  glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, buffers[1]);
+  glBufferData(GL_TRANSFORM_FEEDBACK_BUFFER, count * 4 * sizeof(glm::vec4), 0,
+               GL_STATIC_READ);
+  glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, buffers[1]);
+
+  glUseProgram(program);
+  glEnable(GL_RASTERIZER_DISCARD);
+  glBeginTransformFeedback(GL_POINTS);
+  glDrawArrays(GL_POINTS, 0, count);
+  glEndTransformFeedback();
+  glDisable(GL_RASTERIZER_DISCARD);
+
+  std::vector<glm::vec4> decoded(count * 4);
+  glGetBufferSubData(GL_TRANSFORM_FEEDBACK_BUFFER, 0,
+                     decoded.size() * sizeof(glm::vec4), decoded.data());
+  CHECK(glGetError() == GL_NO_ERROR);
+
+  // Missing components read as z = 0, w = 1.
+  GLsizei wrong[4] = {0, 0, 0, 0};
+  const float exact = 1.0e-6f;
+  for (GLsizei i = 0; i < count; ++i) {
+    const PackedVertex &v = vertices[i];
+    const glm::vec4 *gl = &decoded[i * 4];
+    wrong[0] += !near(gl[0], glm::vec4(mgl::unpack(v.Position), 0, 1), exact);
+    wrong[1] += !near(gl[1], glm::vec4(mgl::unpack(v.TexCoord), 0, 1), exact);
+    wrong[2] += !near(gl[2], glm::vec4(mgl::unpack(v.Normal), 0), exact);
+    wrong[3] += !near(gl[3], mgl::unpack(v.Color), exact);
+  }
+  const char *formats[] = {"half2", "snorm16 x2", "2_10_10_10_REV",
+                           "unorm8 x4"};
+  for (int f = 0; f < 4; ++f) {
+    if (wrong[f])
+      std::printf("%s: %d of %d vertices decoded differently by GL\n",
+                  formats[f], wrong[f], count);
+    CHECK(wrong[f] == 0);
+  }
+
+  glDeleteBuffers(2, buffers);
+  glDeleteVertexArrays(1, &vao);
+  glDeleteShader(shader);
+  glDeleteProgram(program);
+}
+
+int main() {
+  roundTrip();
+  decodedByGL();
+  return mgl::test::result();
+}
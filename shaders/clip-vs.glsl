@@ -2,12 +2,24 @@
 
 in vec4 inPosition;
 in vec4 inColor;
+in uint inObject;
 out vec4 exColor;
 
-uniform mat4 Matrix;
-uniform vec4 objectColor; 
+// One binding holds OBJECTS draws; each draw's base instance picks its slot
+// through inObject. Must match ObjectBlock in the application.
+const int OBJECTS = 128;
+
+layout(std140) uniform Object {
+    mat4 ModelMatrix[OBJECTS];
+    vec4 Color[OBJECTS];
+};
+
+layout(std140) uniform Camera {
+    mat4 ViewMatrix;
+    mat4 ProjectionMatrix;
+};
 
 void main(void) {
-    gl_Position = Matrix * inPosition;
-    exColor = objectColor;
+    gl_Position = ProjectionMatrix * ViewMatrix * ModelMatrix[inObject] * inPosition;
+    exColor = Color[inObject];
 }
@@ -0,0 +1,39 @@
+#version 430 core
+
+layout(local_size_x = 64) in;
+
+struct Object {
+    mat4 ModelMatrix;
+    vec4 Color;
+    vec4 Bounds; // min x, min y, max x, max y
+    uint Mesh;
+};
+
+struct Command {
+    uint Count;
+    uint InstanceCount;
+    uint FirstIndex;
+    int BaseVertex;
+    uint BaseInstance;
+};
+
+layout(std430, binding = 0) readonly buffer Objects { Object objects[]; };
+layout(std430, binding = 1) buffer Commands { Command commands[]; };
+layout(std430, binding = 2) writeonly buffer Instances { uint instances[]; };
+
+// One page of objects: ids, and the bindings of objects and instances, are
+// relative to the page.
+uniform vec4 View; // min x, min y, max x, max y
+uniform uint ObjectCount;
+uniform uint CommandBase;  // first command of the page
+uniform uint InstanceBase; // first instance slot of the page
+
+void main(void) {
+    uint id = gl_GlobalInvocationID.x;
+    if (id >= ObjectCount) return;
+    vec4 b = objects[id].Bounds;
+    if (b.z < View.x || b.x > View.z || b.w < View.y || b.y > View.w) return;
+    uint command = CommandBase + objects[id].Mesh;
+    uint slot = atomicAdd(commands[command].InstanceCount, 1u);
+    instances[commands[command].BaseInstance - InstanceBase + slot] = id;
+}
@@ -0,0 +1,24 @@
+#version 430 core
+
+in vec4 inPosition;
+in uint inObject;
+out vec4 exColor;
+
+struct Object {
+    mat4 ModelMatrix;
+    vec4 Color;
+    vec4 Bounds;
+    uint Mesh;
+};
+
+layout(std430, binding = 0) readonly buffer Objects { Object objects[]; };
+
+layout(std140) uniform Camera {
+    mat4 ViewMatrix;
+    mat4 ProjectionMatrix;
+};
+
+void main(void) {
+    gl_Position = ProjectionMatrix * ViewMatrix * objects[inObject].ModelMatrix * inPosition;
+    exColor = objects[inObject].Color;
+}
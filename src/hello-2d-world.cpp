@@ -14,7 +14,16 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtx/transform.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
 #include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
 
 #include "../mgl/mgl.hpp"
 
@@ -24,270 +33,491 @@
 
 ////////////////////////////////////////////////////////////////////////// MYAPP
 
+const GLuint POSITION = 0, COLOR = 1, OBJECT = 2;
+const GLuint UBO_BP = 0, OBJECT_BP = 1;
+
+// Per-draw data of OBJECTS draws, std140: matches the Object block of
+// clip-vs.glsl. A draw's base instance is its slot, read back through the
+// per-instance OBJECT attribute, so one binding serves OBJECTS draws.
+const GLuint OBJECTS = 128;
+struct ObjectBlock {
+    glm::mat4 ModelMatrix[OBJECTS];
+    glm::vec4 Color[OBJECTS];
+};
+
+// Blocks a frame writes before it starts over in a fresh region, which caps
+// the object buffer at 640KB a region however many pieces are visible.
+const GLuint REGION_BLOCKS = 64;
+
 class MyApp : public mgl::App {
 public:
+    MyApp(bool gpuCulling, bool threaded) : GpuCulling(gpuCulling && !threaded), Threaded(threaded) {}
     void initCallback(GLFWwindow* win) override;
     void displayCallback(GLFWwindow* win, double elapsed) override;
+    void recordCallback(GLFWwindow* win, mgl::CommandList& commands, double elapsed) override;
     void windowCloseCallback(GLFWwindow* win) override;
     void windowSizeCallback(GLFWwindow* win, int width, int height) override;
+    void cursorCallback(GLFWwindow* win, double xpos, double ypos) override;
+    void mouseButtonCallback(GLFWwindow* win, int button, int action, int mods) override;
+    void scrollCallback(GLFWwindow* win, double xoffset, double yoffset) override;
 
 private:
-    const GLuint POSITION = 0, COLOR = 1;
-    GLuint VaoId, VboId[2];
-    GLuint ParallelogramVaoId, SquareVaoId, RightTriangleVaoId;
-    GLuint ParallelogramVboId[2], SquareVboId[2], RightTriangleVboId[2];
+    mgl::Resources Resources;
+    std::unique_ptr<mgl::StreamingLoader> Loader;
+    mgl::LoadedPack Board;
+    const mgl::PackPlacement* Placements = nullptr; // the board layout's
+    const mgl::PackPiece* Pieces = nullptr;
+    const mgl::PackMesh* Meshes = nullptr;
+    GLuint PlacementCount = 0, MeshCount = 0;
+    mgl::VertexArrayHandle Vao;
+    mgl::CullGrid Grid;
+    std::unique_ptr<mgl::JobSystem> Jobs; // culls rows of cells in parallel
+    std::vector<GLuint> Visible;
+    bool GpuCulling, Threaded;
+    mgl::GpuCuller Culler;
+    GLenum DrawMode, IndexType;
     std::unique_ptr<mgl::ShaderProgram> Shaders;
-    GLint MatrixId;
+    std::unique_ptr<mgl::UniformRing> Objects;
+    mgl::BufferHandle ObjectBuffer; // render thread: replaces the ring
+    mgl::BufferHandle ObjectSlots; // 0..OBJECTS-1, one per instance
+    GLsizeiptr ObjectStride = 0;
+    GLuint RegionBlocks = 0;
+    std::vector<char> Staging;
+    std::unique_ptr<mgl::Camera> Camera;
+    mgl::PanZoom View;
+    glm::vec2 Cursor;
+    bool Dragging = false;
+    glm::ivec2 Viewport = glm::ivec2(0);
+    mgl::Animator Reveal;
+    std::vector<glm::mat4> Poses;
+    float RevealTime = 0.0f, RevealEnd = 0.0f;
 
     void createShaderProgram();
+    void createCamera(GLFWwindow* win);
+    void updateCamera();
+    glm::vec2 toNdc(GLFWwindow* win, const glm::vec2& cursor) const;
     void createBufferObjects();
+    void createVertexArray();
+    void openBoard();
+    void createCullGrid();
+    void createGpuCuller(const std::vector<mgl::Bounds>& bounds);
     void destroyBufferObjects();
+    void createReveal();
+    void animateReveal(double elapsed);
+    void drawProgress(GLFWwindow* win, float progress);
     void drawScene();
+    void recordScene(mgl::CommandList& commands);
 };
 
 //////////////////////////////////////////////////////////////////////// SHADERs
 
 void MyApp::createShaderProgram() {
     Shaders = std::make_unique<mgl::ShaderProgram>();
+    if (GpuCulling) {
+        // Matrix and color are read from the culler's object buffer.
+        Shaders->addShader(GL_VERTEX_SHADER, "shaders/cull-vs.glsl");
+        Shaders->addShader(GL_FRAGMENT_SHADER, "shaders/clip-fs.glsl");
+        Shaders->addAttribute(mgl::POSITION_ATTRIBUTE, POSITION);
+        Shaders->addAttribute("inObject", OBJECT);
+        Shaders->addUniformBlock(mgl::CAMERA_BLOCK, UBO_BP);
+        Shaders->create();
+        Culler.create("shaders/cull-cs.glsl");
+        return;
+    }
     Shaders->addShader(GL_VERTEX_SHADER, "shaders/clip-vs.glsl");
     Shaders->addShader(GL_FRAGMENT_SHADER, "shaders/clip-fs.glsl");
 
     Shaders->addAttribute(mgl::POSITION_ATTRIBUTE, POSITION);
     Shaders->addAttribute(mgl::COLOR_ATTRIBUTE, COLOR);
-    Shaders->addUniform("Matrix");
-    Shaders->addUniform("objectColor"); // Add uniform for object color
+    Shaders->addAttribute("inObject", OBJECT);
+    Shaders->addUniformBlock(mgl::OBJECT_BLOCK, OBJECT_BP);
+    Shaders->addUniformBlock(mgl::CAMERA_BLOCK, UBO_BP);
 
     Shaders->create();
-
-    MatrixId = Shaders->Uniforms["Matrix"].index;
-    // Add uniform location for the object color
-    GLuint colorId = Shaders->Uniforms["objectColor"].index;
 }
 
+//////////////////////////////////////////////////////////////////////// CAMERA
 
-//////////////////////////////////////////////////////////////////// VAOs & VBOs
-
-typedef struct {
-    GLfloat XYZW[4];
-} Vertex;
-
-const Vertex ParallelogramVertices[] = {
-    {{ 0.0f,  0.0f, 0.0f, 1.0f}},
-    {{ glm::sqrt(2.0f),  0.0f, 0.0f, 1.0f}},
-    {{ -0.707f,  glm::sqrt(2.0f) / 2, 0.0f, 1.0f}},
-    {{ glm::sqrt(2.0f) - 0.707f ,  glm::sqrt(2.0f) / 2, 0.0f, 1.0f}}
-};
+// The board is seen through a pan and zoom view of the xy plane: drag with the
+// left button to pan, scroll to zoom around the cursor. Initially the view
+// shows [-1, 1] vertically, as clip space did, and keeps square pixels.
 
-const GLubyte ParallelogramIndices[] = {
-    0, 1, 2,
-    2, 1, 3
-};
+void MyApp::createCamera(GLFWwindow* win) {
+    int width, height;
+    glfwGetFramebufferSize(win, &width, &height);
+    View.Aspect = height > 0 ? float(width) / float(height) : 1.0f;
+    Camera = std::make_unique<mgl::Camera>(Resources, UBO_BP);
+    updateCamera();
+}
 
-const Vertex SquareVertices[] = {
-    {{-0.5f, -0.5f, 0.0f, 1.0f}},
-    {{ 0.5f, -0.5f, 0.0f, 1.0f}},
-    {{-0.5f,  0.5f, 0.0f, 1.0f}},
-    {{ 0.5f,  0.5f, 0.0f, 1.0f}}
-};
+void MyApp::updateCamera() {
+    if (!Camera) return;
+    Camera->setViewMatrix(View.viewMatrix());
+    Camera->setProjectionMatrix(View.projectionMatrix());
+}
 
-const GLubyte SquareIndices[] = {
-    0, 1, 2,
-    2, 1, 3
-};
+glm::vec2 MyApp::toNdc(GLFWwindow* win, const glm::vec2& cursor) const {
+    int width, height;
+    glfwGetWindowSize(win, &width, &height);
+    if (width <= 0 || height <= 0) return glm::vec2(0.0f);
+    return glm::vec2(2.0f * cursor.x / width - 1.0f, 1.0f - 2.0f * cursor.y / height);
+}
 
-const Vertex RightTriangleVertices[] = {
-    {{-0.5f, -0.5f, 0.0f, 1.0f}},
-    {{ 0.5f, -0.5f, 0.0f, 1.0f}},
-    {{-0.5f,  0.5f, 0.0f, 1.0f}}
-};
+//////////////////////////////////////////////////////////////////// VAOs & VBOs
 
-const GLubyte RightTriangleIndices[] = {
-    0, 1, 2
-};
+// Pieces, their meshes and vertex formats, and the board layout come from an
+// asset pack built by tools/mglpack from assets/tangram.txt. Geometry of all
+// meshes shares one vertex and one index buffer, uploaded in the background
+// by the streaming loader while a progress bar is shown.
 
 void MyApp::createBufferObjects() {
-    //Parallelogram
-    glGenVertexArrays(1, &ParallelogramVaoId);
-    glBindVertexArray(ParallelogramVaoId);
-    glGenBuffers(2, ParallelogramVboId);
-
-    glBindBuffer(GL_ARRAY_BUFFER, ParallelogramVboId[0]);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(ParallelogramVertices), ParallelogramVertices, GL_STATIC_DRAW);
-    glEnableVertexAttribArray(POSITION);
-    glVertexAttribPointer(POSITION, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(0));
-    glEnableVertexAttribArray(COLOR);
-    glVertexAttribPointer(COLOR, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(sizeof(ParallelogramVertices[0].XYZW)));
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ParallelogramVboId[1]);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(ParallelogramIndices), ParallelogramIndices, GL_STATIC_DRAW);
-    glBindVertexArray(0);
-
-    //Square
-    glGenVertexArrays(1, &SquareVaoId);
-    glBindVertexArray(SquareVaoId);
-    glGenBuffers(2, SquareVboId);
-
-    glBindBuffer(GL_ARRAY_BUFFER, SquareVboId[0]);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(SquareVertices), SquareVertices, GL_STATIC_DRAW);
-    glEnableVertexAttribArray(POSITION);
-    glVertexAttribPointer(POSITION, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(0));
-    glEnableVertexAttribArray(COLOR);
-    glVertexAttribPointer(COLOR, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(sizeof(SquareVertices[0].XYZW)));
+    Loader = std::make_unique<mgl::StreamingLoader>(glfwGetCurrentContext());
+    if (!Loader->load("assets/tangram.pack")) exit(EXIT_FAILURE);
+}
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, SquareVboId[1]);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(SquareIndices), SquareIndices, GL_STATIC_DRAW);
+// VAOs are not shared between contexts, so the render thread builds it once
+// the loader has handed over the board's buffers.
+void MyApp::createVertexArray() {
+    Vao = Resources.createVertexArray();
+    glBindVertexArray(Resources.id(Vao));
+
+    glBindBuffer(GL_ARRAY_BUFFER, Resources.id(Board.Vertices));
+    Board.Pack->enableFormat(0);
+
+    if (GpuCulling) {
+        Culler.enableInstanceAttribute(Resources, OBJECT);
+    } else {
+        // Instance i reads slot i, so drawing with base instance k gives the
+        // draw slot k of the bound Object block.
+        GLuint slots[OBJECTS];
+        std::iota(slots, slots + OBJECTS, 0u);
+        ObjectSlots = Resources.createBufferStorage(GL_ARRAY_BUFFER, sizeof(slots), slots, 0);
+        glEnableVertexAttribArray(OBJECT);
+        glVertexAttribIPointer(OBJECT, 1, GL_UNSIGNED_INT, sizeof(GLuint), 0);
+        glVertexAttribDivisor(OBJECT, 1);
+    }
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, Resources.id(Board.Indices));
     glBindVertexArray(0);
+}
 
-    //Triangles
-    glGenVertexArrays(1, &RightTriangleVaoId);
-    glBindVertexArray(RightTriangleVaoId);
-    glGenBuffers(2, RightTriangleVboId);
+// The board is the pack's first layout. AssetPack::open() has checked that its
+// placements, their pieces and the pieces' meshes are all in range, so only
+// the layout itself has to be there.
+void MyApp::openBoard() {
+    const mgl::AssetPack& pack = *Board.Pack;
+    GLuint layouts;
+    const mgl::PackLayout* layout = pack.get<mgl::PackLayout>(mgl::PackSection::Layouts, &layouts);
+    if (layouts == 0) {
+        std::cerr << "[ERROR] Asset pack has no board layout" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    Placements = pack.get<mgl::PackPlacement>(mgl::PackSection::Placements) + layout->FirstPlacement;
+    Pieces = pack.get<mgl::PackPiece>(mgl::PackSection::Pieces);
+    Meshes = pack.get<mgl::PackMesh>(mgl::PackSection::Meshes, &MeshCount);
+    PlacementCount = layout->PlacementCount;
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, RightTriangleVboId[0]);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(RightTriangleVertices), RightTriangleVertices, GL_STATIC_DRAW);
-    glEnableVertexAttribArray(POSITION);
-    glVertexAttribPointer(POSITION, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(0));
-    glEnableVertexAttribArray(COLOR);
-    glVertexAttribPointer(COLOR, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(sizeof(RightTriangleVertices[0].XYZW)));
+// World-space bounds of every placed piece, for visibility culling.
+void MyApp::createCullGrid() {
+    std::vector<mgl::Bounds> bounds(PlacementCount);
+    for (GLuint i = 0; i < PlacementCount; ++i) {
+        const mgl::PackPlacement& placement = Placements[i];
+        const mgl::PackMesh& mesh = Meshes[Pieces[placement.Piece].Mesh];
+        bounds[i] = mgl::transformBounds({mesh.Min, mesh.Max}, placement.matrix());
+    }
+    Grid.build(bounds);
+    Visible.resize(Grid.size());
+    // Room for the blocks of every piece, up to REGION_BLOCKS; frames with
+    // more visible pieces go on from the start of a fresh region. The ring's
+    // fences need the context, so the render thread gets a plain buffer
+    // refilled by each frame's command list instead.
+    ObjectStride = mgl::UniformRing::align(GL_UNIFORM_BUFFER, sizeof(ObjectBlock));
+    RegionBlocks = std::max<GLuint>(std::min<GLuint>((Grid.size() + OBJECTS - 1) / OBJECTS, REGION_BLOCKS), 1);
+    const GLsizeiptr size = ObjectStride * RegionBlocks;
+    if (Threaded) ObjectBuffer = Resources.createBuffer(GL_UNIFORM_BUFFER, size, 0, GL_STREAM_DRAW);
+    else Objects = std::make_unique<mgl::UniformRing>(Resources, GL_UNIFORM_BUFFER, size);
+    if (GpuCulling) createGpuCuller(bounds);
+}
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, RightTriangleVboId[1]);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(RightTriangleIndices), RightTriangleIndices, GL_STATIC_DRAW);
-    glBindVertexArray(0);
+// One multi-draw needs one primitive mode and one index type for all meshes;
+// boards that mix them are culled on the CPU.
+void MyApp::createGpuCuller(const std::vector<mgl::Bounds>& bounds) {
+    std::vector<mgl::DrawElementsCommand> commands(MeshCount);
+    DrawMode = MeshCount ? Meshes[0].Mode : GL_TRIANGLES;
+    IndexType = MeshCount ? Meshes[0].IndexType : GL_UNSIGNED_SHORT;
+    const GLuint indexSize = IndexType == GL_UNSIGNED_INT ? 4 : IndexType == GL_UNSIGNED_SHORT ? 2 : 1;
+    for (GLuint m = 0; m < MeshCount; ++m) {
+        if (Meshes[m].Mode != DrawMode || Meshes[m].IndexType != IndexType) {
+            std::cerr << "[WARNING] Meshes differ in mode or index type, culling on the CPU" << std::endl;
+            GpuCulling = false;
+            createShaderProgram();
+            return;
+        }
+        commands[m] = {Meshes[m].IndexCount, 0, Meshes[m].IndexOffset / indexSize,
+            static_cast<GLint>(Meshes[m].BaseVertex), 0};
+    }
+
+    std::vector<mgl::GpuObject> objects(PlacementCount);
+    for (GLuint i = 0; i < PlacementCount; ++i) {
+        const mgl::PackPlacement& placement = Placements[i];
+        const mgl::PackPiece& piece = Pieces[placement.Piece];
+        objects[i] = {placement.matrix(), piece.Color, bounds[i], piece.Mesh, {}};
+    }
+    Culler.build(Resources, objects, commands);
 }
 
 void MyApp::destroyBufferObjects() {
-    glBindVertexArray(ParallelogramVaoId);
-    glDisableVertexAttribArray(POSITION);
-    glDisableVertexAttribArray(COLOR);
-    glDeleteVertexArrays(1, &ParallelogramVaoId);
-
-    glBindVertexArray(SquareVaoId);
-    glDisableVertexAttribArray(POSITION);
-    glDisableVertexAttribArray(COLOR);
-    glDeleteVertexArrays(1, &SquareVaoId);
-
-    glBindVertexArray(RightTriangleVaoId);
-    glDisableVertexAttribArray(POSITION);
-    glDisableVertexAttribArray(COLOR);
-    glDeleteVertexArrays(1, &RightTriangleVaoId);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    Loader.reset(); // drops uploads not yet collected
+    Culler.clear(Resources);
+    Camera->destroy(Resources);
+    if (Objects) Objects->destroy(Resources);
+    Resources.clear(); // VAOs and all of their VBOs
+    Board.Pack.reset();
+    Placements = nullptr;
+    Pieces = nullptr;
+    Meshes = nullptr;
+    PlacementCount = MeshCount = 0;
+    Grid.clear();
+    Camera.reset();
+    Objects.reset();
+    Reveal.clear();
 }
 
-////////////////////////////////////////////////////////////////////////// SCENE
-
-const glm::mat4 I(1.0f);
-
-const float scaleFactor = 0.4f;
-
-// Parallelogram
-const glm::mat4 M_parallelogram = glm::translate(glm::vec3(-0.8845f, 0.4f, 0.0f)) *
-glm::rotate(glm::radians(-45.0f), glm::vec3(0.0f, 0.0f, 1.0f)) *
-glm::scale(glm::vec3(1.0f * scaleFactor, 1.0f * scaleFactor, 1.0f));
-
-// Medium Triangle
-const glm::mat4 M_right_triangle_1 = glm::translate(glm::vec3(0.5975f, 0.2825f, 0.0f)) *
-glm::rotate(glm::radians(180.0f), glm::vec3(0.0f, 0.0f, 1.0f)) *
-glm::scale(glm::vec3(glm::sqrt(2.0f) * scaleFactor, glm::sqrt(2.0f) * scaleFactor, 1.0f));
-
-// Small Triangle LEFT
-const glm::mat4 M_right_triangle_2 = glm::translate(glm::vec3(-0.6250f, -0.5900f, 0.0f)) *
-glm::rotate(glm::radians(-90.0f), glm::vec3(0.0f, 0.0f, 1.0f)) *
-glm::scale(glm::vec3(1.0f * scaleFactor, 1.0f * scaleFactor, 1.0f));
-
-// Small Triangle RIGHT
-const glm::mat4 M_right_triangle_3 = glm::translate(glm::vec3(0.1215f, -0.5935f, 0.0f)) *
-glm::rotate(glm::radians(0.0f), glm::vec3(0.0f, 0.0f, 1.0f)) *
-glm::scale(glm::vec3(1.0f * scaleFactor, 1.0f * scaleFactor, 1.0f));
-
-// Large Triangle BOTTOM
-const glm::mat4 M_large_triangle_1 = glm::translate(glm::vec3(-0.2500f, 0.0f, 0.0f)) *
-glm::rotate(glm::radians(45.0f), glm::vec3(0.0f, 0.0f, 1.0f)) *
-glm::scale(glm::vec3(2.0f * scaleFactor, 2.0f * scaleFactor, 1.0f));
+////////////////////////////////////////////////////////////////////// ANIMATION
+
+// Once the board is in, pieces grow from their centres one after the other,
+// the whole cascade taking about a second. Tracks only scale in mesh space,
+// without overshoot, so pieces stay inside their culling bounds. The GPU
+// culler keeps its objects static, so it shows the board as is.
+void MyApp::createReveal() {
+    const GLuint count = PlacementCount;
+    const float delay = std::min(0.05f, 1.0f / std::max<GLuint>(count, 1));
+    const glm::quat identity(1.0f, 0.0f, 0.0f, 0.0f);
+    for (GLuint i = 0; i < count; ++i) {
+        const mgl::PackPlacement& placement = Placements[i];
+        const mgl::PackMesh& mesh = Meshes[Pieces[placement.Piece].Mesh];
+        const glm::vec3 centre(0.5f * (mesh.Min + mesh.Max), 0.0f);
+        Reveal.addTrack({{i * delay, centre, identity, glm::vec3(0.0f), mgl::Easing::CubicOut},
+                         {i * delay + 0.4f, glm::vec3(0.0f), identity, glm::vec3(1.0f), mgl::Easing::Linear}});
+    }
+    Poses.resize(count, glm::mat4(0.0f));
+    RevealTime = 0.0f;
+    RevealEnd = count > 0 ? (count - 1) * delay + 0.4f : 0.0f;
+}
 
-// Large Triangle TOP
-const glm::mat4 M_large_triangle_2 = glm::translate(glm::vec3(-0.0850f, 0.4f, 0.0f)) *
-glm::rotate(glm::radians(0.0f), glm::vec3(0.0f, 0.0f, 1.0f)) *
-glm::scale(glm::vec3(2.0f * scaleFactor, 2.0f * scaleFactor, 1.0f));
+void MyApp::animateReveal(double elapsed) {
+    if (Reveal.size() == 0) return;
+    RevealTime += static_cast<float>(elapsed);
+    Reveal.sample(RevealTime, Poses.data());
+    if (RevealTime >= RevealEnd) Reveal.clear(); // poses are identities now
+}
 
-// Square
-const glm::mat4 M_square = glm::translate(glm::vec3(0.3150f, 0.2825f, 0.0f)) *
-glm::rotate(glm::radians(45.0f), glm::vec3(0.0f, 0.0f, 1.0f)) *
-glm::scale(glm::vec3(1.0f * scaleFactor, 1.0f * scaleFactor, 1.0f));
+////////////////////////////////////////////////////////////////////////// SCENE
 
+// Loading frame: a progress bar drawn with scissored clears, no geometry.
+void MyApp::drawProgress(GLFWwindow* win, float progress) {
+    int width, height;
+    GLfloat clearColor[4];
+    glfwGetFramebufferSize(win, &width, &height);
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(width / 8, height / 2 - 8, static_cast<GLsizei>(width * 3 / 4 * progress), 16);
+    glClearColor(0.7f, 0.9f, 0.5f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDisable(GL_SCISSOR_TEST);
+    glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+}
 
 void MyApp::drawScene() {
-    // Parallelogram 
-    glBindVertexArray(ParallelogramVaoId);
+    const mgl::Bounds view = mgl::viewBounds(Camera->getViewProjection());
+    if (GpuCulling) {
+        Culler.cull(Resources, view);
+        glBindVertexArray(Resources.id(Vao));
+        Shaders->bind();
+        Culler.draw(Resources, DrawMode, IndexType);
+        Shaders->unbind();
+        glBindVertexArray(0);
+        return;
+    }
+
+    const size_t count = Grid.cull(view, Visible.data(), Jobs.get());
+    std::sort(Visible.begin(), Visible.begin() + count); // board draw order
+
+    // Visible pieces go OBJECTS at a time into a block in this frame's region
+    // of the ring, one binding per block; a full region is fenced and the
+    // frame goes on in the next one.
+    ObjectBlock block = {};
+    GLuint blocks = 0;
+    Objects->beginFrame();
+    glBindVertexArray(Resources.id(Vao));
     Shaders->bind();
-    glUniformMatrix4fv(MatrixId, 1, GL_FALSE, glm::value_ptr(M_parallelogram));
-    glUniform4f(Shaders->Uniforms["objectColor"].index, 1.0f, 0.3f, 0.3f, 1.0f); // Red
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, reinterpret_cast<GLvoid*>(0));
-
-    // Square 
-    glBindVertexArray(SquareVaoId);
-    glUniformMatrix4fv(MatrixId, 1, GL_FALSE, glm::value_ptr(M_square));
-    glUniform4f(Shaders->Uniforms["objectColor"].index, 0.7f, 0.6f, 1.0f, 1.0f); //Purple
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, reinterpret_cast<GLvoid*>(0));
-
-    // Medium Triangle
-    glBindVertexArray(RightTriangleVaoId);
-    glUniformMatrix4fv(MatrixId, 1, GL_FALSE, glm::value_ptr(M_right_triangle_1));
-    glUniform4f(Shaders->Uniforms["objectColor"].index, 1.0f, 1.0f, 0.6f, 1.0f); //Yellow
-    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_BYTE, reinterpret_cast<GLvoid*>(0));
-
-    // Small Triangle LEFT 
-    glBindVertexArray(RightTriangleVaoId);
-    glUniformMatrix4fv(MatrixId, 1, GL_FALSE, glm::value_ptr(M_right_triangle_2));
-    glUniform4f(Shaders->Uniforms["objectColor"].index, 1.0f, 0.75f, 0.85f, 1.0f); //Pink
-    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_BYTE, reinterpret_cast<GLvoid*>(0));
-
-    // Small Triangle RIGHT 
-    glBindVertexArray(RightTriangleVaoId);
-    glUniformMatrix4fv(MatrixId, 1, GL_FALSE, glm::value_ptr(M_right_triangle_3));
-    glUniform4f(Shaders->Uniforms["objectColor"].index, 0.85f, 0.6f, 0.4f, 1.0); //Orange
-    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_BYTE, reinterpret_cast<GLvoid*>(0));
-
-    // Large Triangle SIDE
-    glBindVertexArray(RightTriangleVaoId);
-    glUniformMatrix4fv(MatrixId, 1, GL_FALSE, glm::value_ptr(M_large_triangle_1));
-    glUniform4f(Shaders->Uniforms["objectColor"].index, 0.6f, 0.7f, 1.0f, 1.0f); //Blue
-    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_BYTE, reinterpret_cast<GLvoid*>(0));
-
-    // Large Triangle TOP 
-    glBindVertexArray(RightTriangleVaoId);
-    glUniformMatrix4fv(MatrixId, 1, GL_FALSE, glm::value_ptr(M_large_triangle_2));
-    glUniform4f(Shaders->Uniforms["objectColor"].index, 0.7f, 0.9f, 0.5f, 1.0f); //Green
-    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_BYTE, reinterpret_cast<GLvoid*>(0));
-
+    for (size_t first = 0; first < count; first += OBJECTS) {
+        const GLuint n = static_cast<GLuint>(std::min<size_t>(count - first, OBJECTS));
+        for (GLuint k = 0; k < n; ++k) {
+            const mgl::PackPlacement& placement = Placements[Visible[first + k]];
+            block.ModelMatrix[k] = Reveal.size() ? placement.matrix() * Poses[Visible[first + k]] : placement.matrix();
+            block.Color[k] = Pieces[placement.Piece].Color;
+        }
+        if (blocks++ == RegionBlocks) {
+            Objects->endFrame();
+            Objects->beginFrame();
+            blocks = 1;
+        }
+        Objects->bind(Resources, OBJECT_BP, Objects->push(block), sizeof(ObjectBlock));
+        for (GLuint k = 0; k < n; ++k) {
+            const mgl::PackMesh& mesh = Meshes[Pieces[Placements[Visible[first + k]].Piece].Mesh];
+            glDrawElementsInstancedBaseVertexBaseInstance(mesh.Mode, mesh.IndexCount, mesh.IndexType,
+                reinterpret_cast<GLvoid*>(static_cast<uintptr_t>(mesh.IndexOffset)), 1, mesh.BaseVertex, k);
+        }
+    }
     Shaders->unbind();
     glBindVertexArray(0);
+    Objects->endFrame();
 }
 
-
-
-
+// Render thread: the same frame as drawScene() on the CPU-culled path, as
+// commands. Each region's worth of object blocks is gathered in Staging and
+// uploaded in one go to the start of the buffer, after the draws of the
+// previous region have been recorded.
+void MyApp::recordScene(mgl::CommandList& commands) {
+    const size_t count = Grid.cull(mgl::viewBounds(Camera->getViewProjection()), Visible.data(), Jobs.get());
+    std::sort(Visible.begin(), Visible.begin() + count);
+
+    const size_t stride = static_cast<size_t>(ObjectStride);
+    const size_t region = size_t(RegionBlocks) * OBJECTS;
+    const GLuint buffer = Resources.id(ObjectBuffer);
+    commands.bindVertexArray(Resources.id(Vao));
+    commands.bindProgram(Shaders->ProgramId);
+    for (size_t start = 0; start < count; start += region) {
+        const size_t end = std::min(count, start + region);
+        const size_t blocks = (end - start + OBJECTS - 1) / OBJECTS;
+        Staging.resize(blocks * stride);
+        for (size_t b = 0; b < blocks; ++b) {
+            ObjectBlock block = {};
+            for (size_t i = start + b * OBJECTS, k = 0; i < end && k < OBJECTS; ++i, ++k) {
+                const mgl::PackPlacement& placement = Placements[Visible[i]];
+                block.ModelMatrix[k] = Reveal.size() ? placement.matrix() * Poses[Visible[i]] : placement.matrix();
+                block.Color[k] = Pieces[placement.Piece].Color;
+            }
+            std::memcpy(&Staging[b * stride], &block, sizeof(ObjectBlock));
+        }
+        commands.bufferSubData(GL_UNIFORM_BUFFER, buffer, 0, Staging.data(), Staging.size());
+        for (size_t b = 0; b < blocks; ++b) {
+            commands.bindBufferRange(GL_UNIFORM_BUFFER, OBJECT_BP, buffer, b * stride, sizeof(ObjectBlock));
+            for (size_t i = start + b * OBJECTS, k = 0; i < end && k < OBJECTS; ++i, ++k) {
+                const mgl::PackMesh& mesh = Meshes[Pieces[Placements[Visible[i]].Piece].Mesh];
+                commands.drawElements(mesh.Mode, mesh.IndexCount, mesh.IndexType, mesh.IndexOffset, 1,
+                    mesh.BaseVertex, static_cast<GLuint>(k));
+            }
+        }
+    }
+    commands.bindProgram(0);
+    commands.bindVertexArray(0);
+}
 
 ////////////////////////////////////////////////////////////////////// CALLBACKS
 
+// The job system lives on the main thread, which records or draws each frame.
 void MyApp::initCallback(GLFWwindow* win) {
+    Jobs = std::make_unique<mgl::JobSystem>();
     createBufferObjects();
     createShaderProgram();
+    createCamera(win);
+    if (!Threaded) return;
+    // Only this callback may touch the context before the render thread
+    // takes it over, so the board is loaded here, without a progress bar.
+    while (!Loader->collect(Resources, Board)) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    openBoard();
+    createCullGrid();
+    createVertexArray();
+    createReveal();
 }
 
 void MyApp::windowCloseCallback(GLFWwindow* win) { destroyBufferObjects(); }
 
+// Input is dispatched on the main thread, which does not own the context
+// when a render thread runs: the viewport is set with the next frame.
 void MyApp::windowSizeCallback(GLFWwindow* win, int winx, int winy) {
-    glViewport(0, 0, winx, winy);
+    Viewport = glm::ivec2(winx, winy);
+    if (winy > 0) {
+        View.Aspect = float(winx) / float(winy);
+        updateCamera();
+    }
 }
 
-void MyApp::displayCallback(GLFWwindow* win, double elapsed) { drawScene(); }
+void MyApp::cursorCallback(GLFWwindow* win, double xpos, double ypos) {
+    const glm::vec2 cursor(xpos, ypos);
+    if (Dragging) {
+        View.pan(toNdc(win, cursor) - toNdc(win, Cursor));
+        updateCamera();
+    }
+    Cursor = cursor;
+}
+
+void MyApp::mouseButtonCallback(GLFWwindow* win, int button, int action, int mods) {
+    if (button == GLFW_MOUSE_BUTTON_LEFT) Dragging = action == GLFW_PRESS;
+}
+
+void MyApp::scrollCallback(GLFWwindow* win, double xoffset, double yoffset) {
+    View.zoom(std::pow(0.9f, static_cast<float>(yoffset)), toNdc(win, Cursor));
+    updateCamera();
+}
+
+void MyApp::displayCallback(GLFWwindow* win, double elapsed) {
+    if (Viewport.x > 0) {
+        glViewport(0, 0, Viewport.x, Viewport.y);
+        Viewport = glm::ivec2(0);
+    }
+    if (!Board.Pack) {
+        if (!Loader->collect(Resources, Board)) {
+            drawProgress(win, Loader->progress());
+            return;
+        }
+        openBoard();
+        createCullGrid();
+        createVertexArray();
+        if (!GpuCulling) createReveal();
+    }
+    animateReveal(elapsed);
+    Camera->upload(Resources);
+    drawScene();
+    Resources.endFrame();
+}
+
+void MyApp::recordCallback(GLFWwindow* win, mgl::CommandList& commands, double elapsed) {
+    if (Viewport.x > 0) {
+        commands.viewport(0, 0, Viewport.x, Viewport.y);
+        Viewport = glm::ivec2(0);
+    }
+    animateReveal(elapsed);
+    Camera->record(Resources, commands);
+    recordScene(commands);
+}
 
 /////////////////////////////////////////////////////////////////////////// MAIN
 
 int main(int argc, char* argv[]) {
     mgl::Engine& engine = mgl::Engine::getInstance();
-    engine.setApp(new MyApp());
+    bool gpuCulling = false, threaded = false;
     engine.setOpenGL(4, 6);
     engine.setWindow(600, 600, "Hello Modern 2D World", 0, 1);
+    // --record <log> | --replay <log> | --frames <csv> | --timestep <seconds>
+    // | --culling cpu|gpu | --render direct|thread
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        if (option == "--record") engine.setRecording(argv[i + 1]);
+        else if (option == "--replay") engine.setReplay(argv[i + 1]);
+        else if (option == "--frames") engine.setFrameLog(argv[i + 1]);
+        else if (option == "--timestep") engine.setFixedTimestep(std::atof(argv[i + 1]));
+        else if (option == "--culling") gpuCulling = std::string(argv[i + 1]) == "gpu";
+        else if (option == "--render") threaded = std::string(argv[i + 1]) == "thread";
+    }
+    // The render thread draws the CPU-culled path only.
+    engine.setRenderThread(threaded);
+    engine.setApp(new MyApp(gpuCulling, threaded));
     engine.init();
     engine.run();
     exit(EXIT_SUCCESS);
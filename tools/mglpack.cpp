@@ -0,0 +1,331 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Asset Pack Builder
+//
+// Copyright (c)2022-24 by Carlos Martinho
+//
+// Builds a binary asset pack (mglPack.hpp) from a text source:
+//
+//   mglpack <source> <pack>
+//
+// One statement per line; '#' starts a comment.
+//   format <name> <stride>
+//   attribute <index> <type> <offset>   float|float2|float3|float4|half2|
+//                                       snorm2|snorm10|unorm4
+//   mesh <name> <format>
+//   v <value>...                        all components, in attribute order
+//   t <a> <b> <c>
+//   piece <name> <mesh> <r> <g> <b> <a>
+//   layout <name>
+//   place <piece> <x> <y> <angle> <sx> <sy>
+//
+// Meshes are reordered for the vertex cache and for vertex fetch on the way.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../mgl/mglMesh.hpp"
+#include "../mgl/mglPack.hpp"
+#include "../mgl/mglVertex.hpp"
+
+//////////////////////////////////////////////////////////////////////// SOURCE
+
+struct AttributeType {
+  const char *Name;
+  GLint Components;
+  GLenum Type;
+  GLboolean Normalized;
+  GLuint Size, Values;
+};
+
+const AttributeType ATTRIBUTE_TYPES[] = {
+    {"float", 1, GL_FLOAT, GL_FALSE, 4, 1},
+    {"float2", 2, GL_FLOAT, GL_FALSE, 8, 2},
+    {"float3", 3, GL_FLOAT, GL_FALSE, 12, 3},
+    {"float4", 4, GL_FLOAT, GL_FALSE, 16, 4},
+    {"half2", 2, GL_HALF_FLOAT, GL_FALSE, 4, 2},
+    {"snorm2", 2, GL_SHORT, GL_TRUE, 4, 2},
+    {"snorm10", 4, GL_INT_2_10_10_10_REV, GL_TRUE, 4, 3},
+    {"unorm4", 4, GL_UNSIGNED_BYTE, GL_TRUE, 4, 4}};
+
+struct Mesh {
+  GLuint Name, Format;
+  std::vector<char> Vertices;
+  std::vector<GLuint> Indices;
+  glm::vec2 Min, Max;
+};
+
+struct Source {
+  std::vector<mgl::PackFormat> Formats;
+  std::vector<mgl::PackAttribute> Attributes;
+  std::vector<const AttributeType *> AttributeTypes;
+  std::vector<Mesh> Meshes;
+  std::vector<mgl::PackPiece> Pieces;
+  std::vector<mgl::PackLayout> Layouts;
+  std::vector<mgl::PackPlacement> Placements;
+  std::map<std::string, GLuint> FormatNames, MeshNames, PieceNames;
+};
+
+static std::string Filename;
+static GLuint Line = 0;
+
+static void fail(const std::string &message) {
+  std::cerr << "[ERROR] " << Filename << ":" << Line << ": " << message
+            << std::endl;
+  exit(EXIT_FAILURE);
+}
+
+static GLuint lookup(const std::map<std::string, GLuint> &names,
+                     const std::string &name) {
+  auto it = names.find(name);
+  if (it == names.end())
+    fail("unknown name '" + name + "'");
+  return it->second;
+}
+
+template <typename T> static void put(std::vector<char> &bytes, const T &v) {
+  const char *p = reinterpret_cast<const char *>(&v);
+  bytes.insert(bytes.end(), p, p + sizeof(T));
+}
+
+static void parseVertex(std::istringstream &in, Source &source, Mesh &mesh) {
+  const mgl::PackFormat &format = source.Formats[mesh.Format];
+  std::vector<char> vertex(format.Stride, 0);
+  for (GLuint i = 0; i < format.AttributeCount; ++i) {
+    const GLuint a = format.FirstAttribute + i;
+    const AttributeType &type = *source.AttributeTypes[a];
+    float v[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    for (GLuint k = 0; k < type.Values; ++k) {
+      if (!(in >> v[k]))
+        fail(std::string("missing value for ") + type.Name + " attribute");
+    }
+    if (source.Attributes[a].Index == 0) {
+      mesh.Min = glm::min(mesh.Min, glm::vec2(v[0], v[1]));
+      mesh.Max = glm::max(mesh.Max, glm::vec2(v[0], v[1]));
+    }
+    std::vector<char> bytes;
+    if (type.Type == GL_FLOAT) {
+      for (GLint k = 0; k < type.Components; ++k)
+        put(bytes, v[k]);
+    } else if (type.Type == GL_HALF_FLOAT) {
+      put(bytes, mgl::packHalf2({v[0], v[1]}));
+    } else if (type.Type == GL_SHORT) {
+      put(bytes, mgl::packSnorm2({v[0], v[1]}));
+    } else if (type.Type == GL_INT_2_10_10_10_REV) {
+      put(bytes, mgl::packSnorm10({v[0], v[1], v[2]}));
+    } else {
+      put(bytes, mgl::packUnorm4({v[0], v[1], v[2], v[3]}));
+    }
+    std::memcpy(vertex.data() + source.Attributes[a].Offset, bytes.data(),
+                bytes.size());
+  }
+  mesh.Vertices.insert(mesh.Vertices.end(), vertex.begin(), vertex.end());
+}
+
+static void parse(const std::string &filename, Source &source,
+                  mgl::PackWriter &writer) {
+  Filename = filename;
+  std::ifstream ifile(filename);
+  if (!ifile.is_open()) {
+    std::cerr << "[ERROR] Failed to open source: " << filename << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  std::string text;
+  while (std::getline(ifile, text)) {
+    ++Line;
+    std::istringstream in(text.substr(0, text.find('#')));
+    std::string keyword, name;
+    if (!(in >> keyword))
+      continue;
+
+    if (keyword == "format") {
+      mgl::PackFormat format = {};
+      if (!(in >> name >> format.Stride) || format.Stride % 4 != 0)
+        fail("expected 'format <name> <stride>', stride a multiple of 4");
+      format.Name = writer.addString(name);
+      format.FirstAttribute = static_cast<GLuint>(source.Attributes.size());
+      source.FormatNames[name] = static_cast<GLuint>(source.Formats.size());
+      source.Formats.push_back(format);
+
+    } else if (keyword == "attribute") {
+      mgl::PackAttribute attribute = {};
+      std::string type;
+      if (source.Formats.empty() ||
+          !(in >> attribute.Index >> type >> attribute.Offset))
+        fail("expected 'attribute <index> <type> <offset>' after a format");
+      const AttributeType *found = 0;
+      for (const AttributeType &t : ATTRIBUTE_TYPES) {
+        if (type == t.Name)
+          found = &t;
+      }
+      mgl::PackFormat &format = source.Formats.back();
+      if (!found)
+        fail("unknown attribute type '" + type + "'");
+      if (attribute.Offset % 4 != 0 ||
+          attribute.Offset + found->Size > format.Stride)
+        fail("attribute does not fit the vertex");
+      attribute.Components = found->Components;
+      attribute.Type = found->Type;
+      attribute.Normalized = found->Normalized;
+      source.Attributes.push_back(attribute);
+      source.AttributeTypes.push_back(found);
+      ++format.AttributeCount;
+
+    } else if (keyword == "mesh") {
+      std::string format;
+      if (!(in >> name >> format))
+        fail("expected 'mesh <name> <format>'");
+      source.MeshNames[name] = static_cast<GLuint>(source.Meshes.size());
+      source.Meshes.push_back(
+          {writer.addString(name), lookup(source.FormatNames, format), {}, {},
+           glm::vec2(FLT_MAX), glm::vec2(-FLT_MAX)});
+
+    } else if (keyword == "v") {
+      if (source.Meshes.empty())
+        fail("vertex outside of a mesh");
+      parseVertex(in, source, source.Meshes.back());
+
+    } else if (keyword == "t") {
+      GLuint t[3];
+      if (source.Meshes.empty() || !(in >> t[0] >> t[1] >> t[2]))
+        fail("expected 't <a> <b> <c>' inside a mesh");
+      Mesh &mesh = source.Meshes.back();
+      const GLuint count = static_cast<GLuint>(
+          mesh.Vertices.size() / source.Formats[mesh.Format].Stride);
+      if (t[0] >= count || t[1] >= count || t[2] >= count)
+        fail("triangle index out of range");
+      mesh.Indices.insert(mesh.Indices.end(), t, t + 3);
+
+    } else if (keyword == "piece") {
+      std::string mesh;
+      mgl::PackPiece piece = {};
+      if (!(in >> name >> mesh >> piece.Color.r >> piece.Color.g >>
+            piece.Color.b >> piece.Color.a))
+        fail("expected 'piece <name> <mesh> <r> <g> <b> <a>'");
+      piece.Name = writer.addString(name);
+      piece.Mesh = lookup(source.MeshNames, mesh);
+      source.PieceNames[name] = static_cast<GLuint>(source.Pieces.size());
+      source.Pieces.push_back(piece);
+
+    } else if (keyword == "layout") {
+      if (!(in >> name))
+        fail("expected 'layout <name>'");
+      source.Layouts.push_back(
+          {writer.addString(name),
+           static_cast<GLuint>(source.Placements.size()), 0});
+
+    } else if (keyword == "place") {
+      std::string piece;
+      mgl::PackPlacement placement = {};
+      if (source.Layouts.empty() ||
+          !(in >> piece >> placement.Position.x >> placement.Position.y >>
+            placement.Angle >> placement.Scale.x >> placement.Scale.y))
+        fail("expected 'place <piece> <x> <y> <angle> <sx> <sy>' in a layout");
+      placement.Piece = lookup(source.PieceNames, piece);
+      source.Placements.push_back(placement);
+      ++source.Layouts.back().PlacementCount;
+
+    } else {
+      fail("unknown statement '" + keyword + "'");
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////// PACK
+
+static void pack(Source &source, mgl::PackWriter &writer) {
+  std::vector<mgl::PackMesh> meshes;
+  std::vector<char> vertices, indices;
+  mgl::MeshStats before = {0.0f, 0.0f}, after = {0.0f, 0.0f};
+
+  for (Mesh &mesh : source.Meshes) {
+    const GLuint stride = source.Formats[mesh.Format].Stride;
+    const GLuint count = static_cast<GLuint>(mesh.Vertices.size() / stride);
+    before.Acmr += mgl::analyzeVertexCache(mesh.Indices, count).Acmr;
+
+    std::vector<GLuint> remap;
+    mgl::optimizeVertexCache(mesh.Indices, count);
+    const GLuint used = mgl::remapVertexFetch(mesh.Indices, count, remap);
+    after.Acmr += mgl::analyzeVertexCache(mesh.Indices, used).Acmr;
+
+    // Vertex data of each mesh starts on a multiple of its stride, so it can
+    // be drawn with a base vertex from a buffer shared by all formats.
+    while (vertices.size() % stride != 0)
+      vertices.push_back(0);
+    mgl::PackMesh packed = {};
+    packed.Name = mesh.Name;
+    packed.Format = mesh.Format;
+    packed.Mode = GL_TRIANGLES;
+    packed.BaseVertex = static_cast<GLuint>(vertices.size() / stride);
+    packed.VertexCount = used;
+    packed.Min = mesh.Min;
+    packed.Max = mesh.Max;
+    vertices.resize(vertices.size() + size_t(used) * stride);
+    char *base = vertices.data() + size_t(packed.BaseVertex) * stride;
+    for (GLuint v = 0; v < count; ++v) {
+      if (remap[v] != ~0u)
+        std::memcpy(base + size_t(remap[v]) * stride,
+                    mesh.Vertices.data() + size_t(v) * stride, stride);
+    }
+
+    while (indices.size() % 4 != 0)
+      indices.push_back(0);
+    packed.IndexOffset = static_cast<GLuint>(indices.size());
+    packed.IndexCount = static_cast<GLuint>(mesh.Indices.size());
+    packed.IndexType = used <= 0x10000 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    for (GLuint index : mesh.Indices) {
+      if (packed.IndexType == GL_UNSIGNED_SHORT)
+        put(indices, static_cast<GLushort>(index));
+      else
+        put(indices, index);
+    }
+    meshes.push_back(packed);
+  }
+
+  writer.add(mgl::PackSection::Vertices, vertices.data(), vertices.size(),
+             static_cast<GLuint>(vertices.size()));
+  writer.add(mgl::PackSection::Indices, indices.data(), indices.size(),
+             static_cast<GLuint>(indices.size()));
+  writer.add(mgl::PackSection::Formats, source.Formats);
+  writer.add(mgl::PackSection::Attributes, source.Attributes);
+  writer.add(mgl::PackSection::Meshes, meshes);
+  writer.add(mgl::PackSection::Pieces, source.Pieces);
+  writer.add(mgl::PackSection::Layouts, source.Layouts);
+  writer.add(mgl::PackSection::Placements, source.Placements);
+
+  const float n = float(std::max<size_t>(meshes.size(), 1));
+  std::cout << meshes.size() << " meshes, " << source.Pieces.size()
+            << " pieces, " << source.Layouts.size() << " layouts, "
+            << vertices.size() + indices.size() << " bytes of geometry"
+            << std::endl;
+  std::cout << "mean ACMR " << before.Acmr / n << " -> " << after.Acmr / n
+            << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////// MAIN
+
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    std::cerr << "usage: mglpack <source> <pack>" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  Source source;
+  mgl::PackWriter writer;
+  parse(argv[1], source, writer);
+  pack(source, writer);
+  if (!writer.write(argv[2]))
+    exit(EXIT_FAILURE);
+  exit(EXIT_SUCCESS);
+}
+
+////////////////////////////////////////////////////////////////////////////////